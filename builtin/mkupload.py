@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+#
+# mkupload.py
+#
+# Create src/upload.h with the builtin pages /$setup, /$upload and /$update
+# from the minimized html files in this folder.
+#
+# The pages are stored gzip compressed in PROGMEM and are sent by the BuiltinHandler
+# using Content-Encoding gzip without copying them into RAM.
+#
+# usage: python3 builtin/mkupload.py
+#
+# Changelog:
+# * 18.10.2026 created by Matthias Hertel
+
+import gzip
+import os
+import sys
+
+# max. size of a compressed page in bytes.
+MAX_SIZE = 2048
+
+# page name, source file, description
+PAGES = [
+  ("setupContent", "setup.htm", "configure the network"),
+  ("uploadContent", "upload.htm", "upload files"),
+  ("updateContent", "boot.htm", "update from GitHub"),
+]
+
+folder = os.path.dirname(os.path.abspath(__file__))
+target = os.path.join(folder, "..", "src", "upload.h")
+
+out = []
+out.append("// file: upload.h")
+out.append("// contains the minimal html pages gzip compressed.")
+out.append("// created by builtin/mkupload.py, do not edit.")
+out.append("")
+out.append("#pragma once")
+
+failed = False
+
+for name, file, info in PAGES:
+  with open(os.path.join(folder, file), "rb") as f:
+    html = f.read().rstrip(b"\r\n")
+
+  # mtime=0 for reproducible output.
+  data = gzip.compress(html, compresslevel=9, mtime=0)
+  print("%-10s %5d -> %5d bytes" % (file, len(html), len(data)))
+  if len(data) > MAX_SIZE:
+    print("  ERROR: more than %d bytes." % MAX_SIZE)
+    failed = True
+
+  out.append("")
+  out.append("// %s: %s (%d bytes)" % (file, info, len(html)))
+  out.append("static const uint8_t %s[] PROGMEM = {" % name)
+  for n in range(0, len(data), 20):
+    out.append("  " + ",".join("0x%02x" % b for b in data[n:n + 20]) + ",")
+  out.append("};")
+
+if failed:
+  sys.exit(1)
+
+with open(target, "w", newline="\r\n") as f:
+  f.write("\n".join(out) + "\n")
+
+# End
@@ -19,6 +19,8 @@
 
 #include "DisplayPathElement.h"
 
+#include <displays/SpanDraw.h>
+
 #include <gfxDraw.h>
 #include <gfxDrawPathWidget.h>
 
@@ -106,9 +108,16 @@ void DisplayPathElement::draw() {
   dWidget->scale(_scale);
   dWidget->move(box.x_min + _centerX, box.y_min + _centerY);
 
-  HomeDing::displayAdapter->startWrite();
-  dWidget->draw(HomeDing::draw);
-  HomeDing::displayAdapter->endWrite();
+  DisplayAdapter *da = HomeDing::displayAdapter;
+  da->startWrite();
+  {
+    // the pixels of the widget are passed to the adapter as spans.
+    SpanDraw::PixelSpans spans(da);
+    dWidget->draw([&spans](int16_t x, int16_t y, uint32_t color) {
+      spans.add(x, y, color);
+    });
+  }
+  da->endWrite();
 
   // the bounding box of dObj is now correct
   // dWidget->bbox;
@@ -13,6 +13,7 @@
  *
  * Changelog:
  * * 05.01.2024 created by Matthias Hertel
+ * * 18.10.2026 the pixels of the path are passed to the display adapter as spans.
  */
 
 
@@ -17,15 +17,73 @@
 
 #include "AnalogClockElement.h"
 
-#include <gfxDraw.h>
+#include <displays/SpanDraw.h>
 
 // enable TRACE for sending detailed output from this Element
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
 /* ===== Define local constants and often used strings ===== */
 
-// like:
-// #define ANYCONSTANT 1000
+// number of spans passed to the adapter at once when restoring.
+#define CLOCK_SPANS 32
+
+// sin() of 0...90 degrees in 2.14 fixed point format.
+static const int16_t sinTable[91] PROGMEM = {
+  0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563, 2845, 3126, 3406, 3686, 3964, 4240,
+  4516, 4790, 5063, 5334, 5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943, 8192, 8438,
+  8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311, 10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982,
+  12176, 12365, 12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044, 14189, 14330, 14466, 14598,
+  14726, 14849, 14968, 15082, 15191, 15296, 15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382, 16384
+};
+
+// colors of the scale ticks at the quarters, hours and minutes.
+static const uint32_t tickColors[3] = { RGB_BLUE, RGB_GREEN, RGB_GRAY };
+
+// length of the hands in 1/12 of the radius and width in pixels.
+static const uint8_t handLength[3] = { 6, 8, 9 };
+static const uint8_t handWidth[3] = { 5, 3, 1 };
+
+// sin() of an angle in degrees in 2.14 fixed point format.
+static int32_t _sin(int16_t deg) {
+  deg = ((deg % 360) + 360) % 360;
+  if (deg <= 90) return (pgm_read_word(&sinTable[deg]));
+  if (deg <= 180) return (pgm_read_word(&sinTable[180 - deg]));
+  if (deg <= 270) return (-(int16_t)pgm_read_word(&sinTable[deg - 180]));
+  return (-(int16_t)pgm_read_word(&sinTable[360 - deg]));
+}  // _sin()
+
+// x offset of the point with distance d from the center at the angle, rounded.
+static int16_t _dx(int16_t deg, int32_t d) {
+  return ((d * _sin(deg) + 8192) >> 14);
+}
+
+// y offset of the point with distance d from the center at the angle, rounded.
+static int16_t _dy(int16_t deg, int32_t d) {
+  return (-((d * _sin(deg + 90) + 8192) >> 14));
+}
+
+
+/// @brief A DisplayAdapter that records the spans of the ticks instead of drawing them.
+class TickRecorder : public DisplayAdapter {
+public:
+  TickRecorder(std::vector<AnalogClockElement::TickSpan> &spans, BoundingBox &clip)
+    : _spans(spans) {
+    displayBox = clip;
+  }
+
+  void writeSpans(const DisplaySpan *spans, uint16_t count, uint32_t /* color */) override {
+    for (uint16_t n = 0; n < count; n++) {
+      _spans.push_back({ spans[n].y, spans[n].x0, spans[n].x1, color });
+    }
+  }
+
+  /// @brief index of the color of the recorded spans.
+  uint8_t color = 0;
+
+private:
+  std::vector<AnalogClockElement::TickSpan> &_spans;
+};
 
 
 /* ===== Static factory function ===== */
@@ -89,6 +147,15 @@ bool AnalogClockElement::set(const char *name, const char *value) {
     ret = false;
   }  // if
 
+  if (name == HomeDing::Actions::Redraw) {
+    _fullDraw = true;
+
+  } else if (ret && (name != HomeDing::Actions::Value)) {
+    // other changes may change the dial.
+    _fullDraw = true;
+    _dial.clear();
+  }
+
   box.x_min = _cx - _radius;
   box.x_max = _cx + _radius;
   box.y_min = _cy - _radius;
@@ -104,41 +171,69 @@ bool AnalogClockElement::set(const char *name, const char *value) {
 void AnalogClockElement::start() {
   TRACE("start()");
   DisplayOutputElement::start();
-  _drawClock();
+  isOpaque = true;  // the background is drawn with the dial.
+  cache = false;    // incremental drawing requires the content of the display.
+  _fullDraw = true;
 }  // start()
 
 
 void AnalogClockElement::draw() {
   TRACE("draw()");
+  DisplayAdapter *da = HomeDing::displayAdapter;
   DisplayOutputElement::draw();
 
   time_t now = time(nullptr);
   struct tm *lt = localtime(&now);
-  time_t secs = lt->tm_sec + (lt->tm_min * 60) + (lt->tm_hour * 60 * 60);
+  int32_t secs = lt->tm_sec + (lt->tm_min * 60) + (lt->tm_hour * 60 * 60);
 
   // calculate angles in 360°
-  uint16_t aSec = lt->tm_sec * 6;
-  uint16_t aHour = secs / 120;
-  uint16_t aMin = (secs % (60 * 60)) / 10;
-
-  // _gfx->startWrite();
-
-  _drawHand(_last_a_sec, 9, 1, _backgroundColor);
-  if (aMin != _last_a_min)
-    _drawHand(_last_a_min, 8, 3, _backgroundColor);
-  if (aHour != _last_a_hour)
-    _drawHand(_last_a_hour, 8, 5, _backgroundColor);
-
-  _drawHand(aHour, 6, 5, _hand_color_h);
-  _drawHand(aMin, 8, 3, _hand_color_m);
-  _drawHand(aSec, 9, 1, _hand_color_s);
-
-  _last_a_sec = aSec;
-  _last_a_min = aMin;
-  _last_a_hour = aHour;
-  HomeDing::displayAdapter->setFlush();
+  int16_t angle[HANDS] = {
+    (int16_t)((secs / 120) % 360),
+    (int16_t)((secs % (60 * 60)) / 10),
+    (int16_t)(lt->tm_sec * 6)
+  };
+  int16_t xy[HANDS][8];
+  BoundingBox handBox[HANDS];
+
+  if (_dial.empty()) {
+    _createDial();
+    _fullDraw = true;
+  }
+
+  for (int i = 0; i < HANDS; i++) {
+    handBox[i] = _handPolygon(i, angle[i], xy[i]);
+  }
+
+  da->startWrite();
+  if (_fullDraw) {
+    da->fillRect(box, HomeDing::displayConfig.backgroundColor);
+    SpanDraw::drawCircle(da, _cx, _cy, _radius, _strokeColor, _backgroundColor, true);
+    _drawTicks(box);
+    _fullDraw = false;
+
+  } else {
+    // restore the union of the old and new area of the moved hands only.
+    for (int i = 0; i < HANDS; i++) {
+      if (angle[i] != _angle[i]) {
+        BoundingBox area = _handBox[i];
+        area.extend(handBox[i]);
+        _restore(area);
+      }
+    }
+  }
+
+  // all hands start in the center and are drawn again.
+  for (int i = 0; i < HANDS; i++) {
+    uint32_t color = (i == 0) ? _hand_color_h : (i == 1) ? _hand_color_m : _hand_color_s;
+    SpanDraw::fillPolygonAA(da, xy[i], 4, color, _backgroundColor);
+    _angle[i] = angle[i];
+    _handBox[i] = handBox[i];
+  }
+  da->endWrite();
+
+  da->setFlush();
   _shown_time = now;
-}
+}  // draw()
 
 /**
  * @brief Give some processing time to the Element to check for next actions.
@@ -159,124 +254,101 @@ void AnalogClockElement::term() {
 }  // term()
 
 
-void AnalogClockElement::_drawClock() {
-  // LOGGER_ETRACE("drawClock()");
-  float rad1 = (M_TWOPI / 60);
-  int16_t x0, y0, x1, y1;
-  BoundingBox box(_cx - _radius, _cy - _radius, _cx + _radius, _cy + _radius);
-
-  HomeDing::displayAdapter->startWrite();
-
-  gfxDraw::drawCircle(
-    gfxDraw::Point((_x0 + _x1) / 2, (_y0 + _y1) / 2),
-    (_x1 - _x0) / 2,
-    HomeDing::writeColor(_strokeColor),
-    HomeDing::writeColor(_backgroundColor));
+// ===== private functions
 
-  for (uint8_t i = 0; i < 60; i++) {
-    uint32_t scaleColor;
-    float deg = (rad1 * i);
+/// @brief Create the cached spans of the dial.
+void AnalogClockElement::_createDial() {
+  _dial.clear();
+  TickRecorder rec(_dial, HomeDing::displayAdapter->displayBox);
 
-    x0 = sin(deg) * _radius;
-    y0 = -cos(deg) * _radius;
+  for (int16_t i = 0; i < 60; i++) {
+    int16_t deg = i * 6;
+    int16_t len;
 
     if ((i % 15) == 0) {
-      x1 = (x0 * 9.0) / 12.0;
-      y1 = (y0 * 9.0) / 12.0;
-      scaleColor = RGB_BLUE;
+      len = (_radius * 9) / 12;
+      rec.color = 0;
 
     } else if ((i % 5) == 0) {
-      x1 = (x0 * 10.0) / 12.0;
-      y1 = (y0 * 10.0) / 12.0;
-      scaleColor = RGB_GREEN;
+      len = (_radius * 10) / 12;
+      rec.color = 1;
 
     } else {
-      x1 = (x0 * 11.5) / 12.0;
-      y1 = (y0 * 11.5) / 12.0;
-      scaleColor = RGB_GRAY;
+      len = (_radius * 23) / 24;
+      rec.color = 2;
     }
 
-    gfxDraw::drawLine(_cx + x0, _cy + y0, _cx + x1, _cy + y1, HomeDing::writeColor(scaleColor));
-
+    SpanDraw::drawLine(&rec, _cx + _dx(deg, _radius), _cy + _dy(deg, _radius), _cx + _dx(deg, len), _cy + _dy(deg, len), 0);
   }  // for
-  HomeDing::displayAdapter->endWrite();
-}
+  _dial.shrink_to_fit();
+  TRACE("dial: %d spans", _dial.size());
+}  // _createDial()
 
-// void _drawLineWidth(DisplayAdapter *d, int x0, int y0, int x1, int y1, float wd)
-// {                                    /* plot an anti-aliased line of width wd */
-//    int dx = abs(x1-x0), sx = x0 < x1 ? 1 : -1;
-//    int dy = abs(y1-y0), sy = y0 < y1 ? 1 : -1;
-//    int err = dx-dy, e2, x2, y2;                           /* error value e_xy */
-//    float ed = dx+dy == 0 ? 1 : sqrt((float)dx*dx+(float)dy*dy);
-
-//    for (wd = (wd+1)/2; ; ) {                                    /* pixel loop */
-//       setPixelColor(x0, y0, max(0,255*(abs(err-dx+dy)/ed-wd+1)));
-//       e2 = err; x2 = x0;
-//       if (2*e2 >= -dx) {                                            /* x step */
-//          for (e2 += dy, y2 = y0; e2 < ed*wd && (y1 != y2 || dx > dy); e2 += dx)
-//             setPixelColor(x0, y2 += sy, max(0,255*(abs(e2)/ed-wd+1)));
-//          if (x0 == x1) break;
-//          e2 = err; err -= dy; x0 += sx;
-//       }
-//       if (2*e2 <= dy) {                                             /* y step */
-//          for (e2 = dx-e2; e2 < ed*wd && (x1 != x2 || dx < dy); e2 += dy)
-//             setPixelColor(x2 += sx, y0, max(0,255*(abs(e2)/ed-wd+1)));
-//          if (y0 == y1) break;
-//          err += dx; y0 += sy;
-//       }
-//    }
-// }
-
-void _drawLineWidth(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color, uint16_t wd) {
 
+/// @brief Draw the ticks of the dial inside an area.
+void AnalogClockElement::_drawTicks(BoundingBox &a) {
   DisplayAdapter *da = HomeDing::displayAdapter;
-
-  da->startWrite();
-  if (wd < 2) {
-    gfxDraw::drawLine(x0, y0, x1, y1, HomeDing::writeColor(color));
-
-  } else if (wd < 4) {
-    //   X
-    //  XOX
-    //   X
-    gfxDraw::drawLine(x0, y0, x1, y1, [da, color](int16_t x, int16_t y) {
-      da->writePixel(x + 1, y, color);
-      da->writePixel(x, y + 1, color);
-      da->writePixel(x - 1, y, color);
-      da->writePixel(x, y - 1, color);
-    });
-
-  } else if (wd < 6) {
-    //   X       3
-    //  X X     4 2
-    // X O X   5 O 1
-    //  X X     6 X
-    //   X       X
-    gfxDraw::drawLine(x0, y0, x1, y1, [da, color](int16_t x, int16_t y) {
-      da->writePixel(x + 2, y, color);
-      da->writePixel(x + 1, y - 1, color);
-      da->writePixel(x, y - 2, color);
-      da->writePixel(x - 1, y - 1, color);
-      da->writePixel(x - 2, y, color);
-      da->writePixel(x - 1, y + 1, color);
-      da->writePixel(x, y + 2, color);
-      da->writePixel(x + 1, y + 1, color);
-    });
+  DisplaySpan spans[CLOCK_SPANS];
+  uint16_t cnt = 0;
+  uint8_t color = 0;
+
+  for (const TickSpan &s : _dial) {
+    if ((s.y >= a.y_min) && (s.y <= a.y_max) && (s.x1 >= a.x_min) && (s.x0 <= a.x_max)) {
+      if ((cnt == CLOCK_SPANS) || ((cnt) && (s.color != color))) {
+        da->writeSpans(spans, cnt, tickColors[color]);
+        cnt = 0;
+      }
+      color = s.color;
+      spans[cnt++] = { s.y, std::max(s.x0, a.x_min), std::min(s.x1, a.x_max) };
+    }
   }
-  da->endWrite();
-}
-
+  if (cnt) {
+    da->writeSpans(spans, cnt, tickColors[color]);
+  }
+}  // _drawTicks()
 
-void AnalogClockElement::_drawHand(uint16_t deg, uint16_t len, uint16_t width, uint32_t color) {
-  float a = M_TWOPI * deg / 360;
-  float fx = sin(a);
-  float fy = -cos(a);
 
-  int16_t x1 = _cx + (fx * len * _radius / 12.0);
-  int16_t y1 = _cy + (fy * len * _radius / 12.0);
+/// @brief Restore an area inside the dial.
+void AnalogClockElement::_restore(BoundingBox &area) {
+  BoundingBox a(std::max(area.x_min, box.x_min), std::max(area.y_min, box.y_min),
+                std::min(area.x_max, box.x_max), std::min(area.y_max, box.y_max));
 
-  _drawLineWidth(_cx, _cy, x1, y1, color, width);
-}
+  if ((!area.isEmpty()) && (a.x_min <= a.x_max) && (a.y_min <= a.y_max)) {
+    HomeDing::displayAdapter->fillRect(a, _backgroundColor);
+    _drawTicks(a);
+  }
+}  // _restore()
+
+
+/// @brief Calculate the polygon of a hand in 1/16 pixels.
+BoundingBox AnalogClockElement::_handPolygon(int hand, int16_t angle, int16_t *xy) {
+  const int32_t SUB = SPANDRAW_SUBPIXEL;
+  int32_t cx = (_cx * SUB) + (SUB / 2);
+  int32_t cy = (_cy * SUB) + (SUB / 2);
+  int32_t len = (handLength[hand] * _radius * SUB) / 12;
+  int32_t w = (handWidth[hand] * SUB) / 2;  // half width at the center
+  int32_t t = std::max(w / 3, SUB / 2);     // half width at the tip
+
+  // tapered hand with a short tail: tail left, tip left, tip right, tail right
+  xy[0] = cx - _dx(angle, w) + _dx(angle - 90, w);
+  xy[1] = cy - _dy(angle, w) + _dy(angle - 90, w);
+  xy[2] = cx + _dx(angle, len) + _dx(angle - 90, t);
+  xy[3] = cy + _dy(angle, len) + _dy(angle - 90, t);
+  xy[4] = cx + _dx(angle, len) + _dx(angle + 90, t);
+  xy[5] = cy + _dy(angle, len) + _dy(angle + 90, t);
+  xy[6] = cx - _dx(angle, w) + _dx(angle + 90, w);
+  xy[7] = cy - _dy(angle, w) + _dy(angle + 90, w);
+
+  int16_t x = xy[0] >> 4, y = xy[1] >> 4;
+  BoundingBox b(x, y, x, y);
+  for (int i = 1; i < 4; i++) {
+    x = xy[2 * i] >> 4;
+    y = xy[2 * i + 1] >> 4;
+    BoundingBox p(x, y, x, y);
+    b.extend(p);
+  }
+  return (b);
+}  // _handPolygon()
 
 
 // End
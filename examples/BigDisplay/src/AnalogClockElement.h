@@ -9,12 +9,16 @@
  *
  * Changelog:
  * * 30.01.2022 created by Matthias Hertel
+ * * 18.10.2026 dial and hands are drawn as spans using SpanDraw. The dial is cached and only the
+ *              areas of moved hands are restored. Hands are antialiased polygons.
  */
 
 #pragma once
 
 #include <displays/DisplayOutputElement.h>
 
+#include <vector>
+
 /**
  * @brief
  */
@@ -70,6 +74,19 @@ public:
 
 
 private:
+  friend class TickRecorder;
+
+  /// @brief number of hands: hour, minute, second.
+  static const int HANDS = 3;
+
+  /// @brief A span of the dial with the index of the tick color.
+  struct TickSpan {
+    int16_t y;
+    int16_t x0;
+    int16_t x1;
+    uint8_t color;
+  };
+
   time_t _shown_time = 0;
 
   // colors
@@ -77,17 +94,34 @@ private:
   uint32_t _hand_color_m = RGB_WHITE;
   uint32_t _hand_color_h = RGB_WHITE;
 
-  // last drawn angles of hands
-  uint16_t _last_a_sec;
-  uint16_t _last_a_min;
-  uint16_t _last_a_hour;
+  /// @brief the clock is drawn completely with the next draw().
+  bool _fullDraw = true;
+
+  /// @brief last drawn angles of the hands in degrees or -1 when not drawn.
+  int16_t _angle[HANDS] = { -1, -1, -1 };
+
+  /// @brief area covered by the drawn hands.
+  BoundingBox _handBox[HANDS];
+
+  /// @brief the cached spans of the scale ticks.
+  std::vector<TickSpan> _dial;
 
   uint16_t _radius = 100;
   uint16_t _cx = 48;
   uint16_t _cy = 48;
 
-  void _drawClock();
-  void _drawHand(uint16_t deg, uint16_t len, uint16_t width, uint32_t color);
+  /// @brief Create the cached spans of the dial.
+  void _createDial();
+
+  /// @brief Draw the ticks of the dial inside an area.
+  void _drawTicks(BoundingBox &area);
+
+  /// @brief Restore an area inside the dial.
+  void _restore(BoundingBox &area);
+
+  /// @brief Calculate the polygon of a hand.
+  /// @return the bounding box of the polygon.
+  BoundingBox _handPolygon(int hand, int16_t angle, int16_t *xy);
 
 
   /**
@@ -11,6 +11,7 @@ set _curlopts=--retry 2
 set _folder=dist
 set _help=
 set _clean=
+set _gzip=
 
 if "%*"=="" ( set _help=1 )
 
@@ -26,6 +27,9 @@ if [%~1]==[/?]     ( set _help=1 && shift /1 && goto :restart )
 if [%~1]==[-c]      ( set _clean=1 && shift /1 && goto :restart )
 if [%~1]==[--clean] ( set _clean=1 && shift /1 && goto :restart )
 
+if [%~1]==[-z]      ( set _gzip=1 && shift /1 && goto :restart )
+if [%~1]==[--gzip]  ( set _gzip=1 && shift /1 && goto :restart )
+
 set devicename=%~1
 
 if DEFINED _help (
@@ -37,6 +41,7 @@ if DEFINED _help (
   echo Usage: hd-webupload.bat [options] ^<devicename^> [example]
   echo.  -h, --help     Get a brief help on using this tool
   echo.  -c, --clean    Clean existing files on device before upload
+  echo.  -z, --gzip     Upload htm, js, css and svg files gzip compressed as ^<file^>.gz
   echo.
   echo When no example parameter is given the files from the [1mstandard[0m data folder are used.
   echo.
@@ -64,21 +69,52 @@ echo.  Device name = %devicename%
 echo.  Folder      = %_webfolder%
 echo.
 
+if DEFINED _gzip (
+  set _gzfolder=%TEMP%\hd-gzip
+  if NOT EXIST "!_gzfolder!" mkdir "!_gzfolder!"
+)
+
 FOR %%F IN (%_webfolder%\*.*) DO (
   echo [37m%%F[30m
-  curl --form "fileupload=@%%F;filename=/%%~nxF" http://%devicename%/ %_curlopts%
+  call :upload "%%F" "/%%~nxF"
 )
 
 FOR %%F IN ("%_webfolder%\i\*.svg") DO (
   echo [37m%%F[30m
-  curl --form "fileupload=@%%F;filename=/i/%%~nxF" http://%devicename%/ %_curlopts%
+  call :upload "%%F" "/i/%%~nxF"
 )
 
 echo.
 echo http://%devicename%/ updated.
+goto :end
+
+
+REM == upload a file, compressed when requested and useful ==
+REM %1 is the local file, %2 the file name on the device.
+
+:upload
+set _ext=%~x1
+set _compress=
+if DEFINED _gzip (
+  if /I [%_ext%]==[.htm] set _compress=1
+  if /I [%_ext%]==[.js]  set _compress=1
+  if /I [%_ext%]==[.css] set _compress=1
+  if /I [%_ext%]==[.svg] set _compress=1
+)
+
+if DEFINED _compress (
+  powershell -NoProfile -Command "$i=[IO.File]::OpenRead('%~f1'); $o=[IO.File]::Create('%_gzfolder%\%~nx1.gz'); $z=New-Object IO.Compression.GZipStream($o,[IO.Compression.CompressionLevel]::Optimal); $i.CopyTo($z); $z.Close(); $i.Close()"
+  curl --form "fileupload=@%_gzfolder%\%~nx1.gz;filename=%~2.gz" http://%devicename%/ %_curlopts%
+) ELSE (
+  curl --form "fileupload=@%~1;filename=%~2" http://%devicename%/ %_curlopts%
+)
+goto :eof
+
 
 :end
 
 set _folder=
+set _gzip=
+set _gzfolder=
 echo.
 
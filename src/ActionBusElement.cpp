@@ -0,0 +1,344 @@
+/**
+ * @file ActionBusElement.cpp
+ *
+ * @brief System Element for the HomeDing Library to send and receive actions between devices
+ * using small UDP packets instead of http requests.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see ActionBusElement.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <ActionBusElement.h>
+#include <core/HttpPool.h>
+
+#define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
+
+#define BUS_VERSION 1
+#define BUS_HEADER 6
+
+#define BUS_FLAG_ACKREQ 0x01
+#define BUS_FLAG_ACK 0x02
+
+ActionBusElement *ActionBusElement::bus = nullptr;
+
+
+/**
+ * @brief static factory function to create a new ActionBusElement
+ * @return ActionBusElement* created element
+ */
+Element *ActionBusElement::create() {
+  return (new ActionBusElement());
+}  // create()
+
+
+/**
+ * @brief Set a parameter or property to a new value or start an action.
+ */
+bool ActionBusElement::set(const char *name, const char *value) {
+  bool ret = true;
+
+  if (_stricmp(name, "port") == 0) {
+    _port = _atoi(value);
+
+  } else if (_stricmp(name, "group") == 0) {
+    _useGroup = _group.fromString(value);
+
+  } else if (_stricmp(name, "retries") == 0) {
+    _retries = _atoi(value);
+
+  } else if (_stricmp(name, "timeout") == 0) {
+    _timeout = _scanDuration(value);
+
+  } else {
+    ret = Element::set(name, value);
+  }  // if
+  return (ret);
+}  // set()
+
+
+/**
+ * @brief Activate the ActionBusElement.
+ */
+void ActionBusElement::start() {
+  bool ok;
+
+  if (_useGroup) {
+#if defined(ESP8266)
+    ok = _udp.beginMulticast(WiFi.localIP(), _group, _port);
+#else
+    ok = _udp.beginMulticast(_group, _port);
+#endif
+  } else {
+    ok = _udp.begin(_port);
+  }
+
+  if (!ok) {
+    LOGGER_EERR("no udp port");
+
+  } else {
+    for (Pending &p : _pending) p.tries = 0;
+    for (Seen &s : _seen) s.ip = IPAddress();
+    _seq = random(0x10000);
+    bus = this;
+    Element::start();
+  }
+}  // start()
+
+
+/**
+ * @brief Receive actions and repeat unacknowledged actions.
+ */
+void ActionBusElement::loop() {
+  uint8_t buffer[ACTIONBUS_MAXPACKET + 1];
+  unsigned long now = _board->nowMillis;
+
+  // receive all available packets
+  while (_udp.parsePacket() > 0) {
+    int len = _udp.read(buffer, ACTIONBUS_MAXPACKET);
+    if (_udp.remoteIP() != WiFi.localIP()) {
+      _receive(buffer, len);
+    }
+  }
+
+  // repeat unacknowledged actions
+  for (Pending &p : _pending) {
+    if ((p.tries) && (now - p.sentAt >= _timeout)) {
+      if (p.tries > _retries) {
+        LOGGER_EERR("lost %s", p.ip.toString().c_str());
+        _lost++;
+        p.tries = 0;
+      } else {
+        TRACE("repeat %d", p.seq);
+        _sendTo(p.ip, p.data, p.len);
+        p.sentAt = now;
+        p.tries++;
+        _repeated++;
+      }
+    }
+  }
+}  // loop()
+
+
+/**
+ * @brief stop all activities and go inactive.
+ */
+void ActionBusElement::term() {
+  if (bus == this) {
+    bus = nullptr;
+  }
+  _udp.stop();
+  Element::term();
+}  // term()
+
+
+/**
+ * @brief push the current value of all properties to the callback.
+ */
+void ActionBusElement::pushState(
+  std::function<void(const char *pName, const char *eValue)> callback) {
+  Element::pushState(callback);
+  callback("sent", _printInteger(_sent));
+  callback("received", _printInteger(_received));
+  callback("duplicates", _printInteger(_duplicates));
+  callback("repeated", _printInteger(_repeated));
+  callback("lost", _printInteger(_lost));
+  callback("rtt", _printInteger(_rtt));
+}  // pushState()
+
+
+bool ActionBusElement::send(const String &host, const String &action) {
+  TRACE("send %s:%s", host.c_str(), action.c_str());
+
+  if (!active) {
+    return (false);
+  }
+
+  size_t len = action.length();
+  if (BUS_HEADER + len > ACTIONBUS_MAXPACKET) {
+    LOGGER_EERR("action too long");
+    return (false);
+  }
+
+  if (host == "*") {
+    // broadcast to the group without acknowledge
+    if (!_useGroup) {
+      LOGGER_EERR("no group");
+      return (false);
+    }
+
+    uint8_t buffer[ACTIONBUS_MAXPACKET];
+    _header(buffer, 0, _seq++);
+    memcpy(buffer + BUS_HEADER, action.c_str(), len);
+
+#if defined(ESP8266)
+    _udp.beginPacketMulticast(_group, _port, WiFi.localIP());
+#else
+    _udp.beginPacket(_group, _port);
+#endif
+    _udp.write(buffer, BUS_HEADER + len);
+    _udp.endPacket();
+    _sent++;
+
+  } else {
+    IPAddress ip;
+    if (!HttpPool::resolve(host, ip)) {
+      LOGGER_EERR("unknown host %s", host.c_str());
+      return (false);
+    }
+
+    // use a free slot for repeating or the oldest one
+    Pending *p = &_pending[0];
+    for (Pending &e : _pending) {
+      if (!e.tries) {
+        p = &e;
+        break;
+      } else if ((long)(e.firstSent - p->firstSent) < 0) {
+        p = &e;
+      }
+    }
+    if (p->tries) {
+      _lost++;  // no acknowledge in time
+    }
+
+    p->ip = ip;
+    p->seq = _seq++;
+    p->len = _header(p->data, BUS_FLAG_ACKREQ, p->seq) + len;
+    memcpy(p->data + BUS_HEADER, action.c_str(), len);
+    p->tries = 1;
+    p->sentAt = millis();
+    p->firstSent = micros();
+
+    _sendTo(ip, p->data, p->len);
+    _sent++;
+  }
+  return (true);
+}  // send()
+
+
+// ===== private functions =====
+
+int ActionBusElement::_header(uint8_t *buffer, uint8_t flags, uint16_t seq) {
+  buffer[0] = 'H';
+  buffer[1] = 'D';
+  buffer[2] = BUS_VERSION;
+  buffer[3] = flags;
+  buffer[4] = (seq >> 8);
+  buffer[5] = (seq & 0xFF);
+  return (BUS_HEADER);
+}  // _header()
+
+
+void ActionBusElement::_sendTo(const IPAddress &ip, const uint8_t *data, size_t len) {
+  _udp.beginPacket(ip, _port);
+  _udp.write(data, len);
+  _udp.endPacket();
+}  // _sendTo()
+
+
+void ActionBusElement::_receive(uint8_t *buffer, int len) {
+  if ((len < BUS_HEADER) || (buffer[0] != 'H') || (buffer[1] != 'D') || (buffer[2] != BUS_VERSION)) {
+    return;  // not an action bus packet
+  }
+
+  IPAddress from = _udp.remoteIP();
+  uint8_t flags = buffer[3];
+  uint16_t seq = (buffer[4] << 8) | buffer[5];
+
+  if (flags & BUS_FLAG_ACK) {
+    for (Pending &p : _pending) {
+      if ((p.tries) && (p.seq == seq) && (p.ip == from)) {
+        unsigned long rtt = micros() - p.firstSent;
+        _rtt = _rtt ? (_rtt * 7 + rtt) / 8 : rtt;
+        p.tries = 0;
+        TRACE("ack %d %luus", seq, rtt);
+      }
+    }
+
+  } else {
+    if (flags & BUS_FLAG_ACKREQ) {
+      // acknowledge also repeated packets as the first ack may have been lost.
+      uint8_t ack[BUS_HEADER];
+      _header(ack, BUS_FLAG_ACK, seq);
+      _udp.beginPacket(from, _udp.remotePort());
+      _udp.write(ack, BUS_HEADER);
+      _udp.endPacket();
+    }
+
+    if (_isDuplicate(from, seq)) {
+      _duplicates++;
+
+    } else if (len > BUS_HEADER) {
+      buffer[len] = '\0';
+      TRACE("received %s", buffer + BUS_HEADER);
+      _received++;
+      HomeDing::Actions::push((const char *)buffer + BUS_HEADER, nullptr, false);
+    }
+  }
+}  // _receive()
+
+
+bool ActionBusElement::_isDuplicate(const IPAddress &ip, uint16_t seq) {
+  unsigned long now = _board->nowMillis;
+  Seen *s = nullptr;
+
+  for (Seen &e : _seen) {
+    if (e.ip == ip) {
+      s = &e;
+      break;
+    }
+  }
+
+  if ((!s) || (now - s->time > ACTIONBUS_SEEN_TIME)) {
+    if (!s) {
+      // use a free entry or the one of the longest silent sender
+      s = &_seen[0];
+      for (Seen &e : _seen) {
+        if (!e.ip) {
+          s = &e;
+          break;
+        } else if (now - e.time > now - s->time) {
+          s = &e;
+        }
+      }
+    }
+    s->ip = ip;
+    s->seq = seq;
+    s->mask = 1;
+    s->time = now;
+    return (false);
+  }
+
+  s->time = now;
+  int16_t diff = seq - s->seq;
+
+  if (diff > 0) {
+    // a new highest sequence number
+    s->mask = (diff < 32) ? (s->mask << diff) | 1 : 1;
+    s->seq = seq;
+    return (false);
+  }
+
+  if (-diff >= 32) {
+    return (true);  // too old, already handled or given up by the sender.
+  }
+
+  uint32_t bit = 1UL << -diff;
+  if (s->mask & bit) {
+    return (true);
+  }
+  s->mask |= bit;
+  return (false);
+}  // _isDuplicate()
+
+// End
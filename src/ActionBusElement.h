@@ -0,0 +1,192 @@
+/**
+ * @file ActionBusElement.h
+ *
+ * @brief System Element for the HomeDing Library to send and receive actions between devices
+ * using small UDP packets instead of http requests.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+Every packet starts with a 6 byte header followed by the action text `type/id?param=value`:
+
+  'H' 'D' <version> <flags> <seq high> <seq low> <action...>
+
+flags:
+  0x01 the sender expects an acknowledge packet with the same sequence number.
+  0x02 the packet is an acknowledge and carries no action.
+
+Actions to a host like `host:type/id?param=value` are sent by the ActionBus when no
+remote/host element is configured. They are repeated until acknowledged.
+Actions to the host `*` are sent once to the multicast group.
+
+Received actions are deduplicated by sender and sequence number and are queued
+directly into the board action queue. For every sender the highest sequence number and the
+32 numbers before it are remembered. A sender that was silent for ACTIONBUS_SEEN_TIME is
+treated as restarted and may use any sequence number.
+@endverbatim
+ */
+
+#pragma once
+
+#include <WiFiUdp.h>
+
+/// @brief default UDP port of the action bus.
+#define ACTIONBUS_PORT 8270
+
+/// @brief max. size of a packet including the header.
+#define ACTIONBUS_MAXPACKET 128
+
+/// @brief number of unacknowledged actions that are repeated.
+#define ACTIONBUS_PENDING 4
+
+/// @brief number of remembered senders for deduplication.
+#define ACTIONBUS_SEEN 8
+
+/// @brief time in msecs after that a silent sender is treated as restarted.
+#define ACTIONBUS_SEEN_TIME 2000
+
+/**
+ * @brief The ActionBusElement sends and receives actions using UDP.
+ */
+class ActionBusElement : public Element {
+public:
+  /**
+   * @brief Factory function to create a ActionBusElement.
+   * @return Element*
+   */
+  static Element *create();
+
+  /**
+   * @brief static variable to ensure registering in static init phase.
+   */
+  static bool registered;
+
+  /**
+   * @brief The active ActionBusElement used by the board for sending actions.
+   */
+  static ActionBusElement *bus;
+
+  /**
+   * @brief Set a parameter or property to a new value or start an action.
+   * @param name Name of property.
+   * @param value Value of property.
+   * @return true when property could be changed and the corresponding action
+   * could be executed.
+   */
+  virtual bool set(const char *name, const char *value) override;
+
+  /**
+   * @brief Activate the ActionBusElement.
+   */
+  virtual void start() override;
+
+  /**
+   * @brief Receive actions and repeat unacknowledged actions.
+   */
+  virtual void loop() override;
+
+  /**
+   * @brief stop all activities and go inactive.
+   */
+  virtual void term() override;
+
+  /**
+   * @brief push the current value of all properties to the callback.
+   * @param callback callback function that is used for every property.
+   */
+  virtual void pushState(
+    std::function<void(const char *pName, const char *eValue)> callback) override;
+
+  /**
+   * @brief Send an action to a remote device.
+   * @param host name of the device or "*" for all devices in the multicast group.
+   * @param action action in the format `type/id?param=value`.
+   * @return true when the action was sent.
+   */
+  bool send(const String &host, const String &action);
+
+private:
+  /// @brief action that waits for the acknowledge.
+  struct Pending {
+    IPAddress ip;
+    uint16_t seq;
+    uint8_t tries;             ///< 0: slot is free
+    unsigned long sentAt;      ///< time of the last transmission in msecs.
+    unsigned long firstSent;   ///< time of the first transmission in usecs.
+    uint8_t len;
+    uint8_t data[ACTIONBUS_MAXPACKET];
+  };
+
+  /// @brief the received sequence numbers of a sender.
+  struct Seen {
+    IPAddress ip;
+    uint16_t seq;        ///< highest received sequence number.
+    uint32_t mask;       ///< bit n is set when seq - n was received.
+    unsigned long time;  ///< time of the last packet in msecs.
+  };
+
+  /// @brief the UDP port for sending and receiving.
+  uint16_t _port = ACTIONBUS_PORT;
+
+  /// @brief the multicast group address.
+  IPAddress _group;
+
+  /// @brief a multicast group is configured.
+  bool _useGroup = false;
+
+  /// @brief number of repetitions when no acknowledge was received.
+  int _retries = 3;
+
+  /// @brief time in msecs to wait for an acknowledge.
+  unsigned long _timeout = 80;
+
+  WiFiUDP _udp;
+
+  /// @brief the next sequence number.
+  uint16_t _seq;
+
+  Pending _pending[ACTIONBUS_PENDING];
+
+  Seen _seen[ACTIONBUS_SEEN];
+
+  // statistics
+  unsigned long _sent = 0;
+  unsigned long _received = 0;
+  unsigned long _duplicates = 0;
+  unsigned long _repeated = 0;
+  unsigned long _lost = 0;
+
+  /// @brief average roundtrip time of acknowledged actions in usecs.
+  unsigned long _rtt = 0;
+
+  /// @brief Build the packet header in the buffer.
+  int _header(uint8_t *buffer, uint8_t flags, uint16_t seq);
+
+  /// @brief Send a packet to a unicast address.
+  void _sendTo(const IPAddress &ip, const uint8_t *data, size_t len);
+
+  /// @brief Handle a received packet.
+  void _receive(uint8_t *buffer, int len);
+
+  /// @brief Remember a received packet and return true when it was seen before.
+  bool _isDuplicate(const IPAddress &ip, uint16_t seq);
+};
+
+#ifdef HOMEDING_REGISTER
+// Register the ActionBusElement onto the ElementRegistry.
+bool ActionBusElement::registered =
+  ElementRegistry::registerElement("actionbus", ActionBusElement::create, sizeof(ActionBusElement));
+#endif
+
+// End
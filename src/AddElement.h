@@ -44,5 +44,5 @@ protected:
 #ifdef HOMEDING_REGISTER
 // Register the AddElement in the ElementRegistry.
 bool AddElement::registered =
-  ElementRegistry::registerElement("add", AddElement::create);
+  ElementRegistry::registerElement("add", AddElement::create, sizeof(AddElement));
 #endif
@@ -85,13 +85,13 @@ private:
   int _lastReference;
 
   /** These actions are sent when the current value is above the reference value. */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /** These actions are sent when the current value is below or equal the reference value. */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the AnalogElement onto the ElementRegistry.
-bool AnalogElement::registered = ElementRegistry::registerElement("analog", AnalogElement::create);
+bool AnalogElement::registered = ElementRegistry::registerElement("analog", AnalogElement::create, sizeof(AnalogElement));
 #endif
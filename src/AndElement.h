@@ -46,5 +46,5 @@ protected:
 #ifdef HOMEDING_REGISTER
 // Register the AndElement onto the ElementRegistry.
 bool AndElement::registered =
-    ElementRegistry::registerElement("and", AndElement::create);
+    ElementRegistry::registerElement("and", AndElement::create, sizeof(AndElement));
 #endif
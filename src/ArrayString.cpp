@@ -18,6 +18,8 @@
 #include <Arduino.h>
 #include <ArrayString.h>
 
+#include <core/Arena.h>
+
 #define CTRACE(...)  // Serial.printf(__VA_ARGS__)
 
 void ArrayString::_createCapacity(uint16_t num) {
@@ -62,14 +64,11 @@ void ArrayString::setAt(uint16_t index, const char *s) {
   CTRACE("setAt[%d]=<%s>\n", index, s);
   _createCapacity(index + 1);
   if (array[index]) {
-    free(array[index]);
+    HomeDing::Arena::free(array[index]);
     array[index] = nullptr;
   }
   if (s && *s) {
-    unsigned int len = strlen(s) + 1;
-    char *mem = (char *)malloc(len);
-    memcpy(mem, s, len);
-    array[index] = mem;
+    array[index] = HomeDing::Arena::strndup(s, strlen(s));
   }
   if (index >= _used) { _used = index + 1; }
   // dump();
@@ -95,16 +94,11 @@ void ArrayString::split(const char *s, char delim) {
       const char *pEnd = pStart;
       while (*pEnd && *pEnd != delim) { pEnd++; }
 
-      if (array[_used]) free(array[_used]);
+      if (array[_used]) HomeDing::Arena::free(array[_used]);
 
       // copy pStart .. pEnd-1
       uint16_t rawlen = pEnd - pStart;  // len without trailing '\0'
-
-      char *mem = (char *)malloc(rawlen + 1);
-      memcpy(mem, pStart, rawlen);
-      mem[rawlen] = '\0';
-
-      array[_used++] = mem;
+      array[_used++] = HomeDing::Arena::strndup(pStart, rawlen);
 
       pStart = pEnd + 1;
     }
@@ -139,7 +133,7 @@ String ArrayString::pop() {
 
   if (_used > 0) {
     ret = array[0];
-    free(array[0]);
+    HomeDing::Arena::free(array[0]);
 
     // shift all pointers
     memmove(array, array + 1, (_capacity - 1) * sizeof(char *));
@@ -156,7 +150,7 @@ String ArrayString::remove(uint16_t n) {
 
   if (n < _used) {
     ret = array[n];
-    free(array[n]);
+    HomeDing::Arena::free(array[n]);
 
     for (int n = 0; n < _capacity - 1; n++) {
       array[n] = array[n + 1];
@@ -171,7 +165,7 @@ String ArrayString::remove(uint16_t n) {
 // deallocate all.
 void ArrayString::clear() {
   for (int n = 0; n < _used; n++) {
-    free(array[n]);
+    HomeDing::Arena::free(array[n]);
   }
   if (array) free(array);
   _capacity = 0;
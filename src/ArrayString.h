@@ -14,6 +14,7 @@
  * More information on https://www.mathertel.de/Arduino.
  *
  * 10.05.2023 created.
+ * 18.10.2026 strings are allocated in the Arena during startup.
  */
 
 #pragma once
@@ -22,56 +22,18 @@
 // enable TRACE for sending detailed output from this Element
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
-// ===== meassuring power consumption (CF pin) =====
+// The power pulse count (CF pin) is directly proportional to energy.
+// x [W] = _powerFactor * frequency [Hz] / 1000000;
+// x [Wh] = (_powerFactor * pulses / 3600) / 1000000;
 
-// static interrupt variables
-unsigned long powSigStart;
-unsigned long powSigLast;
-unsigned int powSigCnt = 0;
+// The current/voltage frequency (CF1 pin) is proportional to current or voltage.
+// x [mA] = _currentFactor * frequency [Hz] / 1000000;
+// x [V] = _voltageFactor * frequency [Hz] / 1000000;
 
-// ===== meassuring power consumption in Wh (CF pin) =====
-
-unsigned long energyCount = 0;  // counting PowerSignal pulses
-
-time_t energyDate = 0;                 // start of reporting day.
-unsigned long energyCountLastDay = 0;  // from yesterday
-
-// the power pulse count (onPowerSignal) is directly proportional to energy.
-// x [W] = (_powerFactor * _powerCount) / _powerDuration [nsec];
-// x [Wh] = (_powerFactor * energyCount / 3600) / 1000000;
-
-// ===== meassuring current/voltage (CF1 pin) =====
-
-// static interrupt variables
-unsigned long cf1SigStart;
-unsigned long cf1SigLast;
-unsigned int cf1SigCnt = 0;
-
-// interrupt routine for power measurement. increment power counter and set exact cycle time.
-IRAM_ATTR void onPowerSignal() {
-  unsigned long now = micros();
-  if (!powSigStart) {
-    powSigStart = now;
-    powSigCnt = 0;
-  } else {
-    powSigCnt++;
-  }
-  energyCount++;
-  powSigLast = now;
-}  // onPowerSignal
-
-
-// interrupt routine for current measurement. increment counter and set exact cycle time.
-IRAM_ATTR void onCF1Signal() {
-  unsigned long now = micros();
-  if (!cf1SigStart) {
-    cf1SigStart = now;
-    cf1SigCnt = 0;
-  } else {
-    cf1SigCnt++;
-  }
-  cf1SigLast = now;
-}  // onCF1Signal
+// use the windows of the last cycles when there are only a few pulses in the last cycle.
+static int _windowsFor(PulseCounter &pc) {
+  return ((pc.last().intervals > 2) ? 1 : PULSECOUNTER_WINDOWS);
+}
 
 
 /* ===== Static factory function ===== */
@@ -98,7 +60,7 @@ bool BL0937Element::set(const char *name, const char *value) {
 
     if (active) {
       digitalWrite(_pinSel, _voltageMode);
-      powSigStart = 0;  // start new cycle.
+      _cf1.restart();  // start new cycle.
     }
 
   } else if (_stricmp(name, "selpin") == 0) {
@@ -118,21 +80,24 @@ bool BL0937Element::set(const char *name, const char *value) {
 
   } else if (_stricmp(name, "poweradjust") == 0) {
     float v = strtof(value, nullptr);
-    _powerFactor = (v * _powerDuration) / _powerCount;
+    float f = _cf.frequency(_windowsFor(_cf));
+    if (f > 0) _powerFactor = (v * 1000000) / f;
 
   } else if (_stricmp(name, "currentfactor") == 0) {
     _currentFactor = strtof(value, nullptr);
 
   } else if (_stricmp(name, "currentadjust") == 0) {
     float v = strtof(value, nullptr);
-    _currentFactor = (v * _cf1Duration) / _cf1Count;
+    float f = _cf1.frequency(_windowsFor(_cf1));
+    if (f > 0) _currentFactor = (v * 1000000) / f;
 
   } else if (_stricmp(name, "voltagefactor") == 0) {
     _voltageFactor = strtof(value, nullptr);
 
   } else if (_stricmp(name, "voltageadjust") == 0) {
     float v = strtof(value, nullptr);
-    _voltageFactor = (v * _cf1Duration) / _cf1Count;
+    float f = _cf1.frequency(_windowsFor(_cf1));
+    if (f > 0) _voltageFactor = (v * 1000000) / f;
 
   } else if (_stricmp(name, "onpower") == 0) {
     _powerAction = value;
@@ -163,103 +128,85 @@ void BL0937Element::start() {
   if ((_pinSel < 0) || (_pinCF < 0) || (_pinCF1 < 0)) {
     LOGGER_EERR("configuration incomplete");
 
-  } else {
-    unsigned long now = millis();
+  } else if ((!_cf.begin(_pinCF, FALLING)) || (!_cf1.begin(_pinCF1, FALLING))) {
+    LOGGER_EERR("no pulse counter");
 
-    // Verify parameters
-    pinMode(_pinCF, INPUT);
-    pinMode(_pinCF1, INPUT);
+  } else {
     pinMode(_pinSel, OUTPUT);
-
     digitalWrite(_pinSel, _voltageMode);
 
     // start powerCounting
-    powSigStart = 0;  // start new cycle.
-    _cycleStart = now;
+    _cycleStart = millis();
 
     // start powerCounting per day
-    energyCount = 0;
-    energyDate = time(nullptr) - Board::getTimeOfDay();
-
-    attachInterrupt(_pinCF, onPowerSignal, FALLING);
-    attachInterrupt(_pinCF1, onCF1Signal, FALLING);
+    _energyStart = 0;
+    _energyDate = time(nullptr) - Board::getTimeOfDay();
 
     Element::start();
-
-#if 0
-// Example on accessing the current data of an element
-// by url: http://<devicename>/bl
-    _board->server->on("/bl", HTTP_GET, [this]() {
-      String ret;
-      ret += "time: " + String(time(nullptr)) + "\n";
-      ret += "tod: " + String(Board::getTimeOfDay()) + "\n";
-      ret += "energyDate: " + String(energyDate) + "\n";
-      ret += "d: " + String(time(nullptr) - energyDate);
-      _board->server->send(200, "text/plain", ret.c_str());
-    });
-#endif
-
   }  // if
 }  // start()
 
 
+/**
+ * @brief stop counting pulses.
+ */
+void BL0937Element::term() {
+  _cf.end();
+  _cf1.end();
+  Element::term();
+}  // term()
+
+
 /** Give some processing time check for actions. */
 void BL0937Element::loop() {
+  float energyFactor = _powerFactor / 3600 / 1000000;
 
   // Last day is over.
-  if ((time(nullptr) - energyDate) > (24 * 60 * 60)) {
-    // report day power consumption by resporting the pulse counts of the day
+  if ((time(nullptr) - _energyDate) > (24 * 60 * 60)) {
+    // report day power consumption by reporting the pulse counts of the day
     // as pulse are proportional to the used energy.
+    uint32_t total = _cf.total();
 
-    energyCountLastDay = energyCount;
+    _energyLastDay = total - _energyStart;
 
-    float energyFactor = _powerFactor / 3600 / 1000000;
-    float wh = energyCount * energyFactor;
-    TRACE("last day energy: %d,%energyFactor", energyDate, wh);
+    float wh = _energyLastDay * energyFactor;
+    TRACE("last day energy: %d,%f", _energyDate, wh);
     HomeDing::Actions::push(_energyAction, String(wh));
 
     // start powerCounting per day
-    energyCount = 0;
-    energyDate = time(nullptr) - Board::getTimeOfDay();
+    _energyStart = total;
+    _energyDate = time(nullptr) - Board::getTimeOfDay();
   }  // if
 
 
   // Cycle is over.
   if (_board->nowMillis - _cycleStart > _cycleTime) {
-    unsigned long newPowerValue = 0;
-    unsigned long newVAValue = 0;  // voltage or Ampere
+    _cf.sample();
+    _cf1.sample();
 
     // report new power value:
-    if (powSigCnt > 2) {
-      _powerCount = powSigCnt;
-      _powerDuration = (powSigLast - powSigStart);
-      newPowerValue = (_powerFactor * _powerCount) / _powerDuration;
-    }
+    float newPowerValue = roundf(_powerFactor * _cf.frequency(_windowsFor(_cf)) / 100000) / 10;
+
     if (_powerValue != newPowerValue) {
-      HomeDing::Actions::push(_powerAction, newPowerValue);
+      HomeDing::Actions::push(_powerAction, String(newPowerValue, 1));
+      _powerValue = newPowerValue;
     }
-    _powerValue = newPowerValue;
-    powSigStart = 0;  // start new cycle.
 
-    // report new cf1 value:
-    _cf1Count = cf1SigCnt;
-    _cf1Duration = (cf1SigLast - cf1SigStart);
+    // report new cf1 value: voltage or Ampere
+    float f = _cf1.frequency(_windowsFor(_cf1));
+    unsigned long newVAValue = lroundf((_voltageMode ? _voltageFactor : _currentFactor) * f / 1000000);
 
-    if (cf1SigCnt > 2) {
-      newVAValue = ((_voltageMode ? _voltageFactor : _currentFactor) * _cf1Count) / _cf1Duration;
-    }
-
-    if (_voltageValue != newVAValue) {
-      HomeDing::Actions::push(_voltageAction, newVAValue);
-      _voltageValue = newVAValue;
-    }  // if
+    if (_voltageMode) {
+      if (_voltageValue != newVAValue) {
+        HomeDing::Actions::push(_voltageAction, newVAValue);
+        _voltageValue = newVAValue;
+      }  // if
 
-    if (_currentValue != newVAValue) {
+    } else if (_currentValue != newVAValue) {
       HomeDing::Actions::push(_currentAction, newVAValue);
       _currentValue = newVAValue;
     }  // if
 
-    cf1SigStart = 0;  // start new cycle.
     _cycleStart = _board->nowMillis;
   }  // if
 
@@ -278,12 +225,12 @@ void BL0937Element::pushState(
   callback("mode", _voltageMode ? "voltage" : "current");
 
   // report actual power and factor in use.
-  callback("power", _printInteger(_powerValue));
+  callback("power", String(_powerValue, 1).c_str());
   callback("powerfactor", String(_powerFactor).c_str());
 
   float energyFactor = _powerFactor / 3600 / 1000000;
-  callback("energy", String(energyCount * energyFactor).c_str());
-  callback("lastDay", String(energyCountLastDay * energyFactor).c_str());
+  callback("energy", String((_cf.total() - _energyStart) * energyFactor).c_str());
+  callback("lastDay", String(_energyLastDay * energyFactor).c_str());
 
   if (_voltageMode) {
     // report actual current and factor in use.
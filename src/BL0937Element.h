@@ -13,10 +13,13 @@
  * 
  * Changelog:
  * * 02.11.2020 created by Matthias Hertel
+ * * 18.10.2026 using PulseCounter for multiple instances and precise frequencies.
  */
 
 #pragma once
 
+#include <PulseCounter.h>
+
 /**
  * @brief BL0937Element implements calculating voltage, current and power consumption using a BL0937 chip.
  */
@@ -55,6 +58,11 @@ public:
    */
   virtual void loop() override;
 
+  /**
+   * @brief stop all activities and go inactive.
+   */
+  virtual void term() override;
+
   /**
    * @brief push the current value of all properties to the callback.
    * @param callback callback function that is used for every property.
@@ -67,17 +75,22 @@ private:
   int _pinCF = -1; // power pulse pin
   int _pinCF1 = -1; // current/voltage pulse pin
 
-  /* The last detected values */
+  /* pulse counters */
+  PulseCounter _cf; // power pulses
+  PulseCounter _cf1; // current/voltage pulses
 
-  unsigned long _powerDuration = 0; // last power duration
-  unsigned long _powerCount = 0; // last power impulse count
-  unsigned long _powerValue = 0; // last calculated power value
+  /* The last detected values */
 
-  unsigned long _cf1Duration = 0; // last cf1 duration
-  unsigned long _cf1Count = 0; // last cf1 impulse count
+  float _powerValue = 0; // last calculated power value
   unsigned long _currentValue = 0; // last calculated current value
   unsigned long _voltageValue = 0; // last calculated voltage value
 
+  /* energy counting */
+
+  time_t _energyDate = 0; // start of reporting day.
+  uint32_t _energyStart = 0; // power pulses at start of reporting day.
+  uint32_t _energyLastDay = 0; // power pulses from yesterday.
+
   // ===== default factors taken from a random plug
 
   float _powerFactor = 1346829.0; // pulse density to power in W
@@ -89,10 +102,10 @@ private:
   int _voltageMode = LOW; // voltage (HIGH) or current (LOW) mode
 
   /* Actions */
-  String _powerAction; // Actions with power consumption
-  String _currentAction; // Actions with current value
-  String _voltageAction; // Actions with voltage value
-  String _energyAction; // Actions with energy value of last period (day)
+  HomeDing::Actions::ActionString _powerAction; // Actions with power consumption
+  HomeDing::Actions::ActionString _currentAction; // Actions with current value
+  HomeDing::Actions::ActionString _voltageAction; // Actions with voltage value
+  HomeDing::Actions::ActionString _energyAction; // Actions with energy value of last period (day)
 };
 
 
@@ -101,5 +114,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the BL0937Element onto the ElementRegistry.
 bool BL0937Element::registered =
-    ElementRegistry::registerElement("bl0937", BL0937Element::create);
+    ElementRegistry::registerElement("bl0937", BL0937Element::create, sizeof(BL0937Element));
 #endif
@@ -22,11 +22,15 @@
 #include <Arduino.h>
 #include <HomeDing.h>
 #include <MicroJsonComposer.h>
+#include <MicroCborComposer.h>
 
 #include <Wire.h>
 #include <SPI.h>
 
 #include <core/Network.h>
+#include <core/Arena.h>
+#include <core/Resume.h>
+#include <core/Dataflow.h>
 
 #if defined(ESP8266)
 #include <ESP8266mDNS.h>
@@ -43,6 +47,8 @@ extern "C" {
 #include <ElementRegistry.h>
 
 #include <RemoteElement.h>
+#include <ActionBusElement.h>
+#include <StaticHandler.h>
 
 #include "MicroJsonParser.h"
 #include "hdfs.h"
@@ -60,9 +66,6 @@ using namespace HomeDing::Actions;
 // use NETTRACE for compiling with detailed output on startup & joining the network.
 #define NETTRACE(...)  // Logger::LoggerPrint("Net", LOGGER_LEVEL_TRACE, __VA_ARGS__)
 
-// time_t less than this value is assumed as not initialized.
-#define MIN_VALID_TIME (30 * 24 * 60 * 60)
-
 // The captive Mode will stay for 10 min. and then restart.
 #define CAPTIVE_TIME (10 * 60 * 1000)
 
@@ -101,9 +104,6 @@ FS *HomeDingFS::rootFS = nullptr;
 FS *HomeDingFS::sdFS = nullptr;
 
 
-/** Reset Counter to detect multiple hardware resets in a row. */
-bool _isWakeupStart = false;
-
 /**
  * @brief Initialize a blank board.
  */
@@ -184,21 +184,20 @@ void Board::init(WebServer *serv, FILESYSTEM *fs, const char *buildName) {
   _startup = (ri->reason == REASON_DEEP_SLEEP_AWAKE) ? BOARDSTARTUP::DEEPSLEEP : BOARDSTARTUP::NORMAL;
 
 #elif defined(ESP32)
-  // RTC_DATA_ATTR int bootCount = 0;
-
   // https://community.platformio.org/t/esp32-firebeetle-fast-boot-after-deep-sleep/13206
   // https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/kconfig.html#config-bootloader-skip-validate-in-deep-sleep
   // CONFIG_BOOTLOADER_SKIP_VALIDATE_IN_DEEP_SLEEP
 
-  BOARDTRACE("ws=%d", _isWakeupStart);
   BOARDTRACE("ESP32: deep sleep cause: %d", esp_sleep_get_wakeup_cause());
-
-  _startup = (_isWakeupStart) ? BOARDSTARTUP::DEEPSLEEP : BOARDSTARTUP::NORMAL;
-  _isWakeupStart = false;
+  _startup = (esp_reset_reason() == ESP_RST_DEEPSLEEP) ? BOARDSTARTUP::DEEPSLEEP : BOARDSTARTUP::NORMAL;
 #endif
 
+  // the snapshot is also loaded after a reset to keep the awake time of the last cycle.
+  bool hasSnapshot = HomeDing::Resume::load();
+
   if (_startup == BOARDSTARTUP::DEEPSLEEP) {
     LOGGER_INFO("Reset from Deep Sleep mode");
+    _fastResume = hasSnapshot;
   }
 
   hd_yield();
@@ -418,6 +417,9 @@ void Board::loop() {
       }  // if
 
       if (_startComplete) {
+        if (dataflow) {
+          HomeDing::Dataflow::build(this);
+        }
         HomeDing::Actions::push(startAction);  // dispatched when all elements are active.
         saveWorkingState = nowMillis + (10 * 1000);
       }
@@ -435,7 +437,7 @@ void Board::loop() {
     // dispatch next action from queue if any
     if (!HomeDing::Actions::queueIsEmpty()) {
       _DeepSleepCount = 0;
-      dispatchAction(HomeDing::Actions::pop());
+      HomeDing::Actions::dispatchNext(this);
       return;
     }  // if
 
@@ -445,6 +447,30 @@ void Board::loop() {
       return;
     }  // if
 
+    // wake up the next element with a reached deadline
+    if ((!_deadlines.empty()) && ((long)(nowMillis - _deadlines.front().at) >= 0)) {
+      Element *e = _deadlines.front().elem;
+      _deadlines.erase(_deadlines.begin());
+      if (e->active) {
+        _activeElement = e;
+        e->loop();
+        _activeElement = nullptr;
+      }
+      return;
+    }  // if
+
+    // wake up the next element from the calendar
+    if ((!_calendar.empty()) && (_calendar.front().at <= time(nullptr))) {
+      Element *e = _calendar.front().elem;
+      _calendar.erase(_calendar.begin());
+      if (e->active) {
+        _activeElement = e;
+        e->loop();
+        _activeElement = nullptr;
+      }
+      return;
+    }  // if
+
     // give some time to next active element from the Looping List
     if (!_nextElement) {
       _nextElement = _elementList;
@@ -472,12 +498,9 @@ void Board::loop() {
       // deep sleep specified time.
       if ((nowMillis > _deepSleepStart) && (_DeepSleepCount > _addedElements + 4)) {
         // all elements now had the chance to create and dispatch an event.
-        LOGGER_INFO("sleep %ld msecs.", _deepSleepTime);
+        LOGGER_INFO("sleep %ld msecs after %ld msecs.", _deepSleepTime, nowMillis);
         Logger::flush();
-#if defined(ESP32)
-        // remember there was deep sleep mode before reset.
-        _isWakeupStart = true;
-#endif
+        HomeDing::Resume::save(millis());
         ESP.deepSleep(_deepSleepTime * 1000);
         _newBoardState(BOARDSTATE::SLEEP);
       }
@@ -524,6 +547,12 @@ void Board::loop() {
 
   } else if (boardState == BOARDSTATE::SETUP) {
 
+    bootHeap = ESP.getFreeHeap();
+    bootHeapBlock = HomeDing::Arena::maxFreeBlock();
+
+    // elements and their configuration are allocated in the Arena until the system elements are started.
+    HomeDing::Arena::open();
+
     // load all config files and create elements
     if (_resetCount < 3) {
       BOARDTRACE("Create Elements...");
@@ -580,6 +609,7 @@ void Board::loop() {
     }
 
     start(Element::STARTUPMODE::System);  // including displays !
+    HomeDing::Arena::close();
     displayInfo(HOMEDING_GREETING);
 
     _newBoardState(BOARDSTATE::CONNECT);
@@ -590,7 +620,7 @@ void Board::loop() {
     String nPass = netpass.substring(off + 1);
 
     // connect to a network...
-    Network::connect(deviceName, nName, nPass);
+    Network::connect(deviceName, nName, nPass, _fastResume ? &HomeDing::Resume::snapshot : nullptr);
 
     // get effective Hostname
     deviceName = WiFi.getHostname();
@@ -627,7 +657,15 @@ void Board::loop() {
 
     }  // if
 
-    if (needReset) {
+    if (needReset && _fastResume) {
+      // access point or IP configuration has changed, use normal connect.
+      NETTRACE("fast resume failed.");
+      HomeDing::Resume::clearNetwork();
+      _fastResume = false;
+      WiFi.disconnect();
+      _newBoardState(BOARDSTATE::CONNECT);
+
+    } else if (needReset) {
       displayInfo("no-net restart");
       DeviceState::setResetCounter(0);
 
@@ -644,7 +682,7 @@ void Board::loop() {
 
     displayInfo(name, WiFi.localIP().toString().c_str());
 
-    if (HomeDing::displayAdapter) {
+    if ((HomeDing::displayAdapter) && (_startup == BOARDSTARTUP::NORMAL)) {
       // clear again.
       delay(1600);
       displayInfo();
@@ -655,50 +693,28 @@ void Board::loop() {
 
     randomSeed(millis());  // millis varies on every start, good enough
 
-    if (cacheHeader == "etag") {
 #if defined(ESP8266)
-      // enable eTags in results for static files
-      // by setting "cache": "etag" inc env.json on the device element
-
-      // This is a fast custom eTag generator. It returns a current number that gets incremented when any file is updated.
-      server->enableETag(true, [this](FS &fs, const String &path) -> String {
-        String eTag;
-        if (!path.endsWith(".txt")) {
-          // txt files contain logs that must not be cached.
-          // eTag = esp8266webserver::calcETag(fs, path);
-          File f = fs.open(path, "r");
-          eTag = String(f.getLastWrite(), 16);  // use file modification timestamp to create ETag
-          f.close();
-        }
-        return (eTag);
-      });
-
-#elif defined(ESP32)
+    // ETag header is collected by default
+    const char *headerKeys[] = { "Range", "Accept" };
+    server->collectHeaders(headerKeys, 2);
 
-#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0))
-      // enable eTags in results for static files
-      // by setting "cache": "etag" inc env.json on the device element
-      // don't cache *.txt files
-
-      // This is a fast custom eTag generator. It returns a current number that gets incremented when any file is updated.
-      server->enableETag(true, [this](FS &fs, const String &path) -> String {
-        String eTag;
-        // if (!path.endsWith(".txt")) {
-          File f = fs.open(path, "r");
-          eTag = String(f.getLastWrite(), 16);  // use file modification timestamp to create ETag
-          f.close();
-        // }
-        return (eTag);
-      });
-#endif
+#elif defined(ESP32) && (ESP_ARDUINO_VERSION_MAJOR < 3)
+    // ETag, Range and Accept headers are not collected by default
+    const char *headerKeys[] = { "If-None-Match", "Range", "Accept" };
+    server->collectHeaders(headerKeys, 3);
 
+#elif defined(ESP32)
+    // Authorization and ETag headers are collected by default
+    const char *headerKeys[] = { "Range", "Accept" };
+    server->collectHeaders(headerKeys, 2);
 #endif
-      cacheHeader = "";  // do not pass this cache header
-    }
 
     start(Element::STARTUPMODE::Network);
     HomeDing::Actions::push(sysStartAction);  // dispatched when network is available
 
+    startHeap = ESP.getFreeHeap();
+    startHeapBlock = HomeDing::Arena::maxFreeBlock();
+
     // ===== finish network setup
 
     // start mDNS service discovery for "_homeding._tcp"
@@ -736,7 +752,8 @@ void Board::loop() {
     // ===== initialize network dependant services
 
     // start file server for static files in the file system.
-    server->serveStatic("/", *(HomeDingFS::rootFS), "/", cacheHeader.c_str());
+    // ETags are used by setting "cache": "etag" in env.json on the device element.
+    server->addHandler(new StaticHandler(this, HomeDingFS::rootFS, cacheHeader.c_str()));
 
     server->onNotFound([this]() {
       BOARDTRACE("notFound: %s", server->uri().c_str());
@@ -833,7 +850,8 @@ void Board::cancelSleep() {
 // ===== dispatch actions =====
 
 // send a event out to the defined target.
-void Board::dispatchAction(Element *target, const char *action_name, const char *action_value) {
+bool Board::dispatchAction(Element *target, const char *action_name, const char *action_value) {
+  bool ret = false;
 
   if (target) {
     const char *action = HomeDing::Actions::find(action_name);
@@ -848,7 +866,7 @@ void Board::dispatchAction(Element *target, const char *action_name, const char
 #if defined(HD_PROFILE)
     PROFILE_START(target);
 #endif
-    bool ret = target->set(action, action_value);
+    ret = target->set(action, action_value);
 #if defined(HD_PROFILE)
     PROFILE_END(target);
 #endif
@@ -858,9 +876,10 @@ void Board::dispatchAction(Element *target, const char *action_name, const char
     }
 
 #else
-    target->set(action, action_value);
+    ret = target->set(action, action_value);
 #endif
   }
+  return (ret);
 }  // dispatchAction()
 
 
@@ -904,11 +923,16 @@ void Board::dispatchAction(String action) {
     String remoteID = "remote/" + host;
     RemoteElement *target = (RemoteElement *)findById(remoteID);
 
-    if (!target) {
-      LOGGER_ERR("dispatch: %s not found", remoteID.c_str());
-    } else {
+    if (target) {
       // send over the network to target device
       target->dispatchAction(targetId, name, value);
+
+    } else if (ActionBusElement::bus) {
+      // send using the udp action bus
+      ActionBusElement::bus->send(host, action);
+
+    } else {
+      LOGGER_ERR("dispatch: %s not found", remoteID.c_str());
     }
 
   } else {
@@ -936,12 +960,12 @@ void Board::deferSleepMode() {
 }  // deferSleepMode()
 
 
-void Board::getState(String &out, const char *id) {
-  BOARDTRACE("getState(%s)", id ? id : "-");
-  MicroJsonComposer jc(_stateSizeHint);
+// compose the state of a single or all elements using a JSON or CBOR composer.
+template <class Composer>
+static void _composeState(Board *board, Composer &jc, const char *id) {
   jc.openObject();
 
-  forEach(Element::CATEGORY::All, [this, id, &jc](Element *e) {
+  board->forEach(Element::CATEGORY::All, [id, &jc](Element *e) {
     BOARDTRACE("  %s", e->id);
     if ((!id) || (strcmp(e->id, id) == 0)) {
 
@@ -954,46 +978,30 @@ void Board::getState(String &out, const char *id) {
     }  // if
   });
 
-  // close root object and format as string into the out buffer
+  // close root object
   jc.closeObject();
-  out=jc.stringify();
-  if (out.length() > _stateSizeHint) {
-    _stateSizeHint = out.length();
-  }
-  BOARDTRACE("getState=%s", out.c_str());
-}  // getState
-
+}  // _composeState()
 
-// ===== Time functionality =====
-
-unsigned long Board::getSeconds() {
-  return (millis() / 1000);
-}
-
-
-// return the seconds since 1.1.1970 00:00:00
-time_t Board::getTime() {
-  time_t current_stamp = time(nullptr);
-  if (current_stamp <= MIN_VALID_TIME) {
-    current_stamp = 0;
-  }  // if
-  return (current_stamp);
-}  // getTime()
 
+void Board::getState(String &out, const char *id, bool cbor) {
+  BOARDTRACE("getState(%s)", id ? id : "-");
 
-// return the seconds of today in localtime.
-time_t Board::getTimeOfDay() {
-  hd_yield();
-  time_t ct = time(nullptr);
+  if (cbor) {
+    MicroCborComposer cc(_stateSizeHint);
+    _composeState(this, cc, id);
+    out = cc.data();
 
-  if (ct > 0) {
-    struct tm *lt;
-    lt = localtime(&ct);
-    return ((lt->tm_hour * 60 * 60) + (lt->tm_min * 60) + lt->tm_sec);
   } else {
-    return (0);
+    MicroJsonComposer jc(_stateSizeHint);
+    _composeState(this, jc, id);
+    out = jc.stringify();
   }
-}  // getTimeOfDay()
+
+  if (out.length() > _stateSizeHint) {
+    _stateSizeHint = out.length();
+  }
+  BOARDTRACE("getState=%d", out.length());
+}  // getState
 
 
 Element *Board::getElement(const char *elementType, const char *elementName) {
@@ -32,6 +32,16 @@
  * * 20.08.2023 remove AUTO connection mode
  * * 30.08.2023 use static Network class as Network Manager for connection and state
  * * 15.10.2024 using static Actions queue
+ * * 18.10.2026 static files are delivered by the StaticHandler with cached ETags and gzip support.
+ * * 18.10.2026 actions to hosts without a remote element are sent by the ActionBusElement.
+ * * 18.10.2026 shared local time and a calendar to wake up time based elements.
+ * * 18.10.2026 elements are created in the Arena, heap state before and after startup.
+ * * 18.10.2026 fast WiFi reconnect after deep sleep using the resume snapshot.
+ * * 18.10.2026 dispatchAction to an element returns the result of the element.
+ * * 18.10.2026 dataflow graph is built after all elements have started.
+ * * 18.10.2026 wakeAfter() with deadlines in milliseconds.
+ * * 18.10.2026 state in CBOR encoding.
+ * * 18.10.2026 time functions and calendar in BoardTime.cpp, nextTimeOfDay() aligned to local time.
  */
 
 // The Board.h file also works as the base import file that contains some
@@ -62,6 +72,7 @@
 #include <WiFiClient.h>
 
 #include <time.h>
+#include <vector>
 
 // forward class declarations
 class Board;
@@ -190,6 +201,37 @@ public:
    */
   static time_t getTimeOfDay();
 
+  /**
+   * Return the local time as broken-down time.
+   * The local time is computed only once per second and shared by all elements.
+   * This method will return nullptr when no real time is available.
+   * @param stamp optional pointer to receive the time_t of the returned local time.
+   */
+  static const struct tm *getLocalTime(time_t *stamp = nullptr);
+
+  /**
+   * Return the time_t when the local time of day will be reached next.
+   * The result is limited to the next local quarter hour to follow daylight saving time changes.
+   * @param tod seconds of the day in local time.
+   */
+  static time_t nextTimeOfDay(time_t tod);
+
+  /**
+   * Wake up a non-looping element by calling loop() at the given time.
+   * A previous wakeup time of the element is replaced.
+   * @param elem the element.
+   * @param at time_t of the wakeup, 0 for as soon as possible.
+   */
+  void wakeAt(Element *elem, time_t at);
+
+  /**
+   * Wake up a non-looping element by calling loop() after the given milliseconds.
+   * A previous deadline of the element is replaced.
+   * @param elem the element.
+   * @param msecs milliseconds from now, 0 for as soon as possible.
+   */
+  void wakeAfter(Element *elem, unsigned long msecs);
+
 
   /**
    * Initialize a blank board.
@@ -258,7 +300,8 @@ public:
   /// @brief Send an action to an element.
   /// @param action_name The name of the action.
   /// @param action_value The value of the action.
-  void dispatchAction(Element *target, const char *action_name, const char *action_value);
+  /// @return true when the action was accepted by the element.
+  bool dispatchAction(Element *target, const char *action_name, const char *action_value);
 
 
   // ===== state of elements =====
@@ -267,8 +310,9 @@ public:
    * Get the state (current values) of a single or all objects
    * @param out Output String for the result.
    * @param id Full qualified id of an Element or nullptr to get state of all elements.
+   * @param cbor create CBOR encoded data instead of JSON.
    */
-  void getState(String &out, const char *id = nullptr);
+  void getState(String &out, const char *id = nullptr, bool cbor = false);
 
 
   /**
@@ -361,6 +405,14 @@ public:
    */
   String homepage;
 
+  /// @brief free heap and largest free block before the elements are created.
+  uint32_t bootHeap = 0;
+  uint32_t bootHeapBlock = 0;
+
+  /// @brief free heap and largest free block after the network elements are started.
+  uint32_t startHeap = 0;
+  uint32_t startHeapBlock = 0;
+
   // system start actions
   String sysStartAction;
   String startAction;
@@ -368,6 +420,9 @@ public:
   // how to cache static files
   String cacheHeader;
 
+  /// @brief evaluate calculating elements in the dataflow graph.
+  bool dataflow = false;
+
   // short readable name of the device used for discovery and web gui
   String title;
 
@@ -395,6 +450,9 @@ private:
   /** counts loops without messages beeing passed to gracefully shut down */
   int _DeepSleepCount;
 
+  /** connect using the resume snapshot after deep sleep. */
+  bool _fastResume = false;
+
   /** State size to avoid reallocating strings later */
   unsigned int _stateSizeHint = 720;
 
@@ -436,4 +494,28 @@ private:
 
   /// @brief The element is executing in a loop()
   Element *_activeElement;
+
+  /// @brief A planned wakeup of an element.
+  struct TimeEvent {
+    time_t at;
+    Element *elem;
+  };
+
+  /// @brief The upcoming wakeups sorted by time.
+  std::vector<TimeEvent> _calendar;
+
+  /// @brief A planned wakeup of an element in milliseconds.
+  struct Deadline {
+    unsigned long at;
+    Element *elem;
+  };
+
+  /// @brief The upcoming deadlines sorted by time.
+  std::vector<Deadline> _deadlines;
+
+  /// @brief The local time of _localStamp.
+  static struct tm _localTime;
+
+  /// @brief The time_t of the computed _localTime.
+  static time_t _localStamp;
 };
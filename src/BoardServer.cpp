@@ -17,10 +17,13 @@
 
 // http://homeding/api/sysinfo
 // http://homeding/api/elements
+// http://homeding/api/elements?details=1
 // http://homeding/api/list
 // http://homeding/api/state
 // http://homeding/api/state/device/0
 // http://homeding/api/state/device/0?title=over
+// http://homeding/api/log?after=12
+// POST http://homeding/api/actions
 
 // http://homeding/api/reboot
 // http://homeding/api/-reset
@@ -37,11 +40,18 @@
 #include <HomeDing.h>
 
 #include <BoardServer.h>
+#include <StaticHandler.h>
 #include <ElementRegistry.h>
 
 #include <MicroJsonComposer.h>
+#include <MicroJsonParser.h>
+#include <MicroCborComposer.h>
+#include <MicroCborParser.h>
 #include <hdfs.h>
 
+#include <core/Arena.h>
+#include <core/Resume.h>
+
 // used for services
 #define API_ROUTE "/api/"
 
@@ -166,6 +176,122 @@ String BoardHandler::handleScan() {
 }  // handleScan()
 
 
+// dispatch a batch of actions and return the result of each action.
+String BoardHandler::handleActions(char *body, size_t len, bool &cbor) {
+  TRACE("handleActions()");
+  String result;  // '1' or '0' for each action
+
+  // dispatch one action, the id and the name are modified in place.
+  auto dispatch = [this, &result](char *id, char *name, const char *value) {
+    bool ok = false;
+    // lowercase like the actions of /api/state to match the known action names.
+    strlwr(id);
+    strlwr(name);
+
+    if (strchr(id, ':')) {
+      // send to a remote host, the result is not known here.
+      _board->dispatchAction(String(id) + '?' + name + '=' + value);
+      ok = true;
+
+    } else {
+      Element *target = _board->findById(id);
+      ok = _board->dispatchAction(target, name, value);
+    }
+    result.concat(ok ? '1' : '0');
+  };
+
+  // the body is split in place.
+  char *p = body;
+  while (isspace((uint8_t)*p)) p++;
+
+  if (MicroCbor::isMap((const uint8_t *)body, len)) {
+    // CBOR: {"type/id":{"name":"value", ...}, ...}
+    MicroCbor mc([&dispatch](int /* level */, char *_path, char *value) {
+      char path[128];
+      strlcpy(path, _path, sizeof(path));
+      char *name = strrchr(path, MICROJSON_PATH_SEPARATOR);
+      if ((name) && (name > path)) {
+        *name++ = '\0';
+        dispatch(path, name, value);
+      }
+    });
+    if (!mc.parse((const uint8_t *)body, len)) {
+      LOGGER_ERR("actions: bad cbor data");
+    }
+    cbor = true;
+
+  } else if (*p == '{') {
+    // JSON: {"type/id":{"name":"value", ...}, ...}
+    MicroJson mj([&dispatch](int /* level */, char *_path, char *value) {
+      if (value) {
+        char path[128];
+        strlcpy(path, _path, sizeof(path));
+        char *name = strrchr(path, MICROJSON_PATH_SEPARATOR);
+        if ((name) && (name > path)) {
+          *name++ = '\0';
+          dispatch(path, name, value);
+        }
+      }
+    });
+    mj.parse(p);
+
+  } else {
+    // lines: type/id?name=value
+    while (*p) {
+      char *line = p;
+      char *eol = strchr(p, '\n');
+      if (eol) {
+        *eol = '\0';
+        p = eol + 1;
+      } else {
+        p += strlen(p);
+      }
+
+      // trim
+      char *end = line + strlen(line);
+      while ((end > line) && isspace(end[-1])) *(--end) = '\0';
+      while (isspace(*line)) line++;
+
+      if (*line) {
+        char *name = strchr(line, '?');
+        if (!name) {
+          result.concat('0');
+
+        } else {
+          *name++ = '\0';
+          char *value = strchr(name, '=');
+          if (value) {
+            *value++ = '\0';
+          } else {
+            value = (char *)"";
+          }
+          dispatch(line, name, value);
+        }
+      }
+    }
+  }
+
+  // format the result array
+  if (cbor) {
+    MicroCborComposer cc(result.length() + 2);
+    cc.openArray();
+    for (unsigned int n = 0; n < result.length(); n++) {
+      cc.addConstant(result[n] == '1');
+    }
+    cc.closeArray();
+    return (cc.data());
+  }
+
+  String json = "[";
+  for (unsigned int n = 0; n < result.length(); n++) {
+    if (n > 0) json.concat(',');
+    json.concat(result[n] == '1' ? "true" : "false");
+  }
+  json.concat(']');
+  return (json);
+}  // handleActions()
+
+
 // reset or reboot the device
 void BoardHandler::handleReboot(WebServer &server, bool wipe) {
   TRACE("handleReboot(%d)", wipe);
@@ -200,11 +326,58 @@ bool BoardHandler::canHandle(WebServer &server, HTTPMethod requestMethod, const
                   || (uri == "/")                  // handle redirect
                   || (_board->isCaptiveMode())));  // capt
 
+  // except for a batch of actions
+  can = can || ((requestMethod == HTTP_POST) && (uri == API_ROUTE "actions"));
+
   TRACE("  %d", can);
   return (can);
 }  // canHandle
 
 
+/**
+ * @brief Verify if the body of the request is read raw by this module.
+ * @param uri current url of the request.
+ * @return true for the body of a batch of actions.
+ */
+#if defined(ESP8266)
+bool BoardHandler::canRaw(const String &uri)
+#elif defined(ESP32)
+
+#if (ESP_ARDUINO_VERSION_MAJOR < 3)
+bool BoardHandler::canRaw(String uri)
+#else
+bool BoardHandler::canRaw(WebServer & /* server */, const String &uri)
+#endif
+
+#endif
+{
+  return (uri == API_ROUTE "actions");
+}  // canRaw
+
+
+/**
+ * @brief Collect the raw body of the request in chunks.
+ * The body may contain NUL bytes and is used with its length.
+ */
+#if defined(ESP32) && (ESP_ARDUINO_VERSION_MAJOR < 3)
+void BoardHandler::raw(WebServer &server, String /* requestUri */, HTTPRaw &raw)
+#else
+void BoardHandler::raw(WebServer &server, const String & /* requestUri */, HTTPRaw &raw)
+#endif
+{
+  if (raw.status == RAW_START) {
+    _body.clear();
+    _body.reserve(server.clientContentLength() + 1);
+
+  } else if (raw.status == RAW_WRITE) {
+    _body.insert(_body.end(), (const char *)raw.buf, (const char *)raw.buf + raw.currentSize);
+
+  } else if (raw.status == RAW_ABORTED) {
+    _body.clear();
+  }
+}  // raw()
+
+
 /**
  * @brief Handle the request of the state.
  * @param server reference to the server.
@@ -214,9 +387,9 @@ bool BoardHandler::canHandle(WebServer &server, HTTPMethod requestMethod, const
  * @return false
  */
 #if defined(ESP8266)
-bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, const String &requestUri2)
+bool BoardHandler::handle(WebServer &server, HTTPMethod requestMethod, const String &requestUri2)
 #elif defined(ESP32)
-bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, const String &requestUri2)
+bool BoardHandler::handle(WebServer &server, HTTPMethod requestMethod, const String &requestUri2)
 #endif
 {
   TRACE("BoardHandler::handle(%s)", requestUri2.c_str());
@@ -234,10 +407,13 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
     api = uri.substring(5);
   }
 
+  // binary CBOR results when requested by the client.
+  bool cbor = (server.header("Accept").indexOf(APPLICATION_CBOR) >= 0);
+
   if (api == "state") {
     // most common request, return state of all elements
-    _board->getState(output);
-    output_type = TEXT_JSON;
+    _board->getState(output, nullptr, cbor);
+    output_type = cbor ? APPLICATION_CBOR : TEXT_JSON;
 
   } else if (api.startsWith("state/")) {
     // everything behind  "/api/state/" is used to address a specific element
@@ -248,7 +424,7 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
 
     if (argCount == 0) {
       // get status of the specified element
-      _board->getState(output, id.c_str());
+      _board->getState(output, id.c_str(), cbor);
 
     } else {
       // send arguments as actions to the specified element per given argument
@@ -257,7 +433,15 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
         HomeDing::Actions::push(tmp, server.arg(a), false);
       }
     }  // if
-    output_type = TEXT_JSON;
+    output_type = cbor ? APPLICATION_CBOR : TEXT_JSON;
+
+  } else if ((api == "actions") && (requestMethod == HTTP_POST)) {
+    // batch of actions in the raw body
+    size_t len = _body.size();
+    _body.push_back('\0');
+    output = handleActions(_body.data(), len, cbor);
+    output_type = cbor ? APPLICATION_CBOR : TEXT_JSON;
+    std::vector<char>().swap(_body);  // free the memory
 
   } else if (api == "sysinfo") {
     unsigned long now = millis();
@@ -279,6 +463,21 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
     jc.addProperty("freeHeap", ESP.getFreeHeap());
 
 #if !defined(HD_MINIMAL)
+    // fragmentation: largest free block versus free heap before and after startup
+    jc.addProperty("maxFreeBlock", HomeDing::Arena::maxFreeBlock());
+    jc.addProperty("bootHeap", _board->bootHeap);
+    jc.addProperty("bootHeapBlock", _board->bootHeapBlock);
+    jc.addProperty("startHeap", _board->startHeap);
+    jc.addProperty("startHeapBlock", _board->startHeapBlock);
+    jc.addProperty("arenaSize", HomeDing::Arena::size);
+    jc.addProperty("arenaUsed", HomeDing::Arena::used);
+    // bytes used by the state of the elements and number of values not saved
+    jc.addProperty("stateUsed", DeviceState::getStateUsed());
+    jc.addProperty("stateSize", DeviceState::getStateSize());
+    jc.addProperty("stateOverflow", DeviceState::getStateOverflow());
+    // time from wakeup to deep sleep of the last cycle
+    jc.addProperty("awakeTime", HomeDing::Resume::snapshot.awakeTime);
+    jc.addProperty("sleepCycles", HomeDing::Resume::snapshot.cycles);
     jc.addProperty("flashSize", ESP.getFlashChipSize());
     jc.addProperty("mac", WiFi.macAddress().c_str());
 #endif
@@ -313,6 +512,19 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
     output = jc.stringify();
     output_type = TEXT_JSON;
 
+#if LOGGER_RING_SIZE > 0
+  } else if (api == "log") {
+    // log lines from memory after the given sequence number
+    uint32_t fileStart;
+    uint32_t last = Logger::getLines(output, server.arg("after").toInt(), &fileStart);
+    server.sendHeader("X-Log-First", String(Logger::firstLine()));
+    server.sendHeader("X-Log-Last", String(last));
+    // range of the log file covering the returned lines
+    server.sendHeader("X-Log-File-Start", String(fileStart));
+    server.sendHeader("X-Log-File-End", String(Logger::fileSize()));
+    output_type = TEXT_PLAIN;
+#endif
+
     // ===== restarting modes
   } else if (api == "reboot") {
     // no reset of parameters, just reboot
@@ -332,6 +544,7 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
   } else if (unSafeMode && (api == "cleanweb")) {
     // remove files but configuration
     handleCleanWeb("/");
+    StaticHandler::clearCache();
     output_type = TEXT_PLAIN;
 
   } else if (unSafeMode && (api == "list")) {
@@ -358,7 +571,7 @@ bool BoardHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, con
     // no output_type. connection is already lost here
 
   } else if (unSafeMode && (api == "elements")) {
-    output = ElementRegistry::list();
+    output = ElementRegistry::list(server.hasArg("details"));
     output_type = TEXT_JSON;
 
   } else if ((uri == "/") && (!_board->isCaptiveMode())) {
@@ -18,6 +18,13 @@
  * * 21.12.2018 refactoring.
  * * 31.07.2021 include handling redirect on "/" request.
  * * 23.04.2023 using the $board for calling services is removed
+ * * 18.10.2026 /api/elements?details=1 with size and number of instances per type.
+ * * 18.10.2026 heap fragmentation and Arena usage in /api/sysinfo.
+ * * 18.10.2026 awake time and number of deep sleep cycles in /api/sysinfo.
+ * * 18.10.2026 /api/log?after=<seq> with the new lines from the log ring.
+ * * 18.10.2026 POST /api/actions to dispatch a batch of actions.
+ * * 18.10.2026 CBOR encoded state and actions.
+ * * 18.10.2026 read action bodies raw with their length, CBOR bodies may contain NUL bytes.
  *   $xxx will only be used for files included in the firmware. 
  * @details
 
@@ -33,12 +40,39 @@ specific url like: <http://homeding/api/state/timer/blink>.
 To send an action to a element a parameter can be added like:
 <http://homeding/api/state/value/x?value=11>
 <http://homeding/api/state/displaytext/info?show=Hello>
+
+The log lines that are written to the log file are also kept in a ring in memory.
+<http://homeding/api/log?after=12> returns the lines after the given sequence number at once.
+This is short polling: the web server is synchronous and cannot hold a request open, so the
+log page polls with an interval growing from 1 to 10 seconds while nothing is logged.
+
+Multiple actions can be sent in one POST request to <http://homeding/api/actions> using
+one action per line or a JSON object with the same structure as the state:
+
+  value/x?value=11
+  displaytext/info?show=Hello
+
+  {"value/x":{"value":"11"},"displaytext/info":{"show":"Hello"}}
+
+The actions are dispatched before the response is sent. The response is an array with
+true or false for each action.
+
+The state and the result of the actions are CBOR (RFC 8949) encoded when the request has the
+header `Accept: application/cbor`. The actions can also be posted as a CBOR encoded object with
+the same structure as the JSON object and get a CBOR encoded response.
+
+The body must be sent with a Content-Type like `text/plain`, `application/json` or
+`application/cbor`. Form encoded bodies are parsed by the web server into arguments and are
+not available as actions. Other bodies are read raw with their length so CBOR encoded bodies
+may contain NUL bytes.
 @endverbatim
  */
 
 #pragma once
 #include <MicroJsonComposer.h>
 
+#include <vector>
+
 /**
  * @brief The BoardHandler is a local class of the main sketch that implements a
  * RequestHandler that is used to respond the state of the Elements on the
@@ -91,6 +125,35 @@ public:
   bool handle(WebServer &server, HTTPMethod requestMethod, const String &requestUri) override;
 #endif
 
+  /**
+   * @brief Verify if the body of the request is read raw by this module.
+   * @param uri current url of the request.
+   * @return true for the body of a batch of actions.
+   */
+#if defined(ESP8266)
+  bool canRaw(const String &uri) override;
+#elif defined(ESP32)
+
+#if (ESP_ARDUINO_VERSION_MAJOR < 3)
+  bool canRaw(String uri) override;
+#else
+  bool canRaw(WebServer &server, const String &uri) override;
+#endif
+
+#endif
+
+  /**
+   * @brief Collect the raw body of the request in chunks.
+   * @param server reference to the server.
+   * @param requestUri current url of the request.
+   * @param raw the current chunk of the body.
+   */
+#if defined(ESP32) && (ESP_ARDUINO_VERSION_MAJOR < 3)
+  void raw(WebServer &server, String requestUri, HTTPRaw &raw) override;
+#else
+  void raw(WebServer &server, const String &requestUri, HTTPRaw &raw) override;
+#endif
+
 
 protected:
   /**
@@ -113,7 +176,20 @@ protected:
    */
   void handleConnect(WebServer &server);
 
+  /**
+   * @brief Dispatch a batch of actions.
+   * @param body lines with `type/id?name=value` or a JSON or CBOR object like the state.
+   * The body is modified in place and must be followed by a NUL byte.
+   * @param len length of the body without the NUL byte.
+   * @param cbor create a CBOR result, is set when the body is CBOR encoded.
+   * @return JSON or CBOR array with the result of each action.
+   */
+  String handleActions(char *body, size_t len, bool &cbor);
+
 private:
+  // raw body of the current request.
+  std::vector<char> _body;
+
   // list files in filesystem recursively.
   void handleListFiles(MicroJsonComposer &jc, String path);
 
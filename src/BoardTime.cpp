@@ -0,0 +1,124 @@
+/**
+ * @file BoardTime.cpp
+ * @author Matthias Hertel (https://www.mathertel.de)
+ *
+ * @brief Implementation of the time functions and the calendar of the Board class.
+ *
+ * @copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see Board.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+// time_t less than this value is assumed as not initialized.
+#define MIN_VALID_TIME (30 * 24 * 60 * 60)
+
+unsigned long Board::getSeconds() {
+  return (millis() / 1000);
+}
+
+
+// return the seconds since 1.1.1970 00:00:00
+time_t Board::getTime() {
+  time_t current_stamp = time(nullptr);
+  if (current_stamp <= MIN_VALID_TIME) {
+    current_stamp = 0;
+  }  // if
+  return (current_stamp);
+}  // getTime()
+
+
+// return the seconds of today in localtime.
+time_t Board::getTimeOfDay() {
+  hd_yield();
+  const struct tm *lt = getLocalTime();
+
+  if (lt) {
+    return ((lt->tm_hour * 60 * 60) + (lt->tm_min * 60) + lt->tm_sec);
+  } else {
+    return (0);
+  }
+}  // getTimeOfDay()
+
+
+struct tm Board::_localTime;
+time_t Board::_localStamp = 0;
+
+// return the local time, computed once per second.
+const struct tm *Board::getLocalTime(time_t *stamp) {
+  time_t ct = time(nullptr);
+
+  if (ct <= MIN_VALID_TIME) {
+    return (nullptr);
+  }
+
+  if (ct != _localStamp) {
+    localtime_r(&ct, &_localTime);
+    _localStamp = ct;
+  }
+  if (stamp) {
+    *stamp = ct;
+  }
+  return (&_localTime);
+}  // getLocalTime()
+
+
+// return the time_t of the next occurrence of the local time of day.
+time_t Board::nextTimeOfDay(time_t tod) {
+  time_t ct;
+  const struct tm *lt = getLocalTime(&ct);
+
+  if (!lt) {
+    return (time(nullptr) + 60);
+  }
+
+  time_t now = (lt->tm_hour * 60 * 60) + (lt->tm_min * 60) + lt->tm_sec;
+  time_t wait = (tod > now) ? (tod - now) : (tod + (24 * 60 * 60) - now);
+
+  // wake up at least every local quarter hour to follow daylight saving time changes
+  // (e.g. 02:45 in Chatham Islands) and the local midnight.
+  time_t limit = (15 * 60) - ((lt->tm_min % 15) * 60 + lt->tm_sec);
+  return (ct + (wait < limit ? wait : limit));
+}  // nextTimeOfDay()
+
+
+// add the element to the calendar, sorted by time.
+void Board::wakeAt(Element *elem, time_t at) {
+  for (auto it = _calendar.begin(); it != _calendar.end(); it++) {
+    if (it->elem == elem) {
+      _calendar.erase(it);
+      break;
+    }
+  }
+
+  auto it = _calendar.begin();
+  while ((it != _calendar.end()) && (it->at <= at)) {
+    it++;
+  }
+  _calendar.insert(it, { at, elem });
+}  // wakeAt()
+
+
+// add the element to the deadlines, sorted by time.
+void Board::wakeAfter(Element *elem, unsigned long msecs) {
+  for (auto it = _deadlines.begin(); it != _deadlines.end(); it++) {
+    if (it->elem == elem) {
+      _deadlines.erase(it);
+      break;
+    }
+  }
+
+  unsigned long at = millis() + msecs;
+  auto it = _deadlines.begin();
+  while ((it != _deadlines.end()) && ((long)(it->at - at) <= 0)) {
+    it++;
+  }
+  _deadlines.insert(it, { at, elem });
+}  // wakeAfter()
+
+// End
@@ -80,32 +80,38 @@ bool BuiltinHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, c
 #endif
 {
   TRACE("handle(%s)", uri.c_str());
-  String output;
+  PGM_P content;
+  size_t len;
 
   if (_board->isSafeMode) {
     return (false);
 
   } else if (uri.startsWith("/$setup")) {
     // Network Config Page
-    output = FPSTR(setupContent);
+    content = (PGM_P)setupContent;
+    len = sizeof(setupContent);
 
 #if !defined(HD_MINIMAL)
   // Github based update is not supported for Minimal devices. Use $upload only.
   } else if (uri.startsWith("/$update")) {
     // Bootstrap Page
-    output = FPSTR(updateContent);
+    content = (PGM_P)updateContent;
+    len = sizeof(updateContent);
 #endif
 
   } else if (uri.startsWith("/$upload")) {
     // Bulk File Upload Page
-    output = FPSTR(uploadContent);
+    content = (PGM_P)uploadContent;
+    len = sizeof(uploadContent);
 
   } else {
     return (false);
   }
 
+  // the compressed page is sent directly from flash memory.
   server.sendHeader("X-Content-Type-Options", "no-sniff");
-  server.send(200, "text/html", output);
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", content, len);
 
   return (true);
 }  // handle()
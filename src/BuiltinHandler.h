@@ -13,6 +13,7 @@
  *
  * Changelog:
  * * 25.11.2021 created by Matthias Hertel
+ * * 18.10.2026 pages are stored gzip compressed and sent from PROGMEM, see builtin/mkupload.py.
  *
  * @details
 @verbatim
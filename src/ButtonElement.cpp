@@ -139,24 +139,24 @@ void ButtonElement::loop() {
 
 void ButtonElement::_send(ACTIONS action) {
   TRACE("send %d", action);
-  String a;
+  HomeDing::Actions::ActionString *a = nullptr;
   const char *actionName = NULL;
 
   if (action == ACTION_CLICK) {
-    a = _clickAction;
+    a = &_clickAction;
     actionName = "click";
 
   } else if (action == ACTION_DOUBLECLICK) {
-    a = _doubleClickAction;
+    a = &_doubleClickAction;
     actionName = "doubleclick";
 
   } else if (action == ACTION_PRESS) {
-    a = _pressAction;
+    a = &_pressAction;
     actionName = "press";
   }
 
-  if (a.length() > 0)
-    HomeDing::Actions::push(a);
+  if (a)
+    HomeDing::Actions::push(*a);
   if (actionName)
     HomeDing::Actions::push(_actionAction, actionName);
 }  // _send()
@@ -89,22 +89,22 @@ private:
    * The _clickAction is emitted when the input level has been HIGH(1) then
    * LOW(0) and no other level change has observed since `_clickTicks`.
    */
-  String _clickAction;
+  HomeDing::Actions::ActionString _clickAction;
 
   /**
    * The _doubleClickAction is emitted
    */
-  String _doubleClickAction;
+  HomeDing::Actions::ActionString _doubleClickAction;
 
   /**
    * @brief The _pressAction is emitted
    */
-  String _pressAction;
+  HomeDing::Actions::ActionString _pressAction;
 
   /**
    * @brief The _actionAction is emitted
    */
-  String _actionAction;
+  HomeDing::Actions::ActionString _actionAction;
 
   /**
    * @brief ...
@@ -115,5 +115,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the ButtonElement onto the ElementRegistry.
 bool ButtonElement::registered =
-    ElementRegistry::registerElement("button", ButtonElement::create);
+    ElementRegistry::registerElement("button", ButtonElement::create, sizeof(ButtonElement));
 #endif
@@ -105,6 +105,12 @@ void CalcElement::pushState(
 }  // pushState()
 
 
+bool CalcElement::getOutputs(std::function<void(const String &action)> callback) {
+  callback(_valueAction);
+  return (true);
+}  // getOutputs()
+
+
 /**
  * @brief function for calculating from input to output values.
  */
@@ -13,6 +13,7 @@
  *
  * Changelog:
  * * 10.10.2021 created by Matthias Hertel
+ * * 18.10.2026 node in the dataflow graph.
  */
 
 #pragma once
@@ -49,6 +50,12 @@ public:
   virtual void pushState(
     std::function<void(const char *pName, const char *eValue)> callback) override;
 
+  /**
+   * @brief report the actions sent with the output value.
+   * @param callback callback function that is used for every action.
+   */
+  virtual bool getOutputs(std::function<void(const String &action)> callback) override;
+
 protected:
   /// number of given input values.
   int _inputs = 0;
@@ -68,7 +75,7 @@ protected:
   String _value;
 
   /// The _valueAction holds the actions that is submitted when outvalue has changed.
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   /**
    * @brief function for calculating from input to output values.
@@ -87,23 +87,23 @@ private:
    * @brief The _highAction is emitted when the logical input level is going
    * from LOW to HIGH.
    */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /**
    * @brief The _lowAction is emitted when the logical input level is going from
    * HIGH to LOW.
    */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 
   /**
    * @brief The _valueAction is emitted every time the logical input level
    * changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the DigitalInElement onto the ElementRegistry.
 bool DigitalInElement::registered =
-  ElementRegistry::registerElement("digitalin", DigitalInElement::create);
+  ElementRegistry::registerElement("digitalin", DigitalInElement::create, sizeof(DigitalInElement));
 #endif
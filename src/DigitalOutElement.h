@@ -75,5 +75,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DigitalOutElement onto the ElementRegistry.
 bool DigitalOutElement::registered =
-    ElementRegistry::registerElement("digitalout", DigitalOutElement::create);
+    ElementRegistry::registerElement("digitalout", DigitalOutElement::create, sizeof(DigitalOutElement));
 #endif
@@ -55,7 +55,7 @@ bool DigitalSignalElement::set(const char *name, const char *value) {
     _valueAction = value;
 
   } else if (_stricmp(name, "duration") == 0) {
-    _valueAction = value;
+    _pulseDuration = _scanDuration(value);
 
   } else {
     ret = false;
@@ -70,40 +70,35 @@ bool DigitalSignalElement::set(const char *name, const char *value) {
 void DigitalSignalElement::start() {
   // only start with valid pin as input.
   TRACE("start pin=%d", _pin);
-  if ((_pin >= 0) && (_usedSignals < 8)) {
-    _signalOff = DigitalSignalElement::_usedSignals++;
-    pinMode(_pin, _pullup ? INPUT_PULLUP : INPUT);
-    // TRACE("offset (%d)", _signalOff);
-
-    if (_signalOff == 0) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal0, CHANGE);
-    } else if (_signalOff == 1) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal1, CHANGE);
-    } else if (_signalOff == 2) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal2, CHANGE);
-    } else if (_signalOff == 3) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal3, CHANGE);
-    } else if (_signalOff == 4) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal4, CHANGE);
-    } else if (_signalOff == 5) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal5, CHANGE);
-    } else if (_signalOff == 6) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal6, CHANGE);
-    } else if (_signalOff == 7) {
-      attachInterrupt(_pin, DigitalSignalElement::onSignal7, CHANGE);
-    }
-
+  if (_counter.begin(_pin, CHANGE, _pullup)) {
+    _lastSignalCount = 0;
+    _sampleStart = millis();
     Element::start();
   }  // if
 }  // start()
 
 
+/**
+ * @brief stop watching the input.
+ */
+void DigitalSignalElement::term() {
+  _counter.end();
+  Element::term();
+}  // term()
+
+
 /**
  * @brief check the state of the input.
  */
 void DigitalSignalElement::loop() {
   unsigned long now = millis();
-  unsigned long cnt = DigitalSignalElement::_signalCount[_signalOff];
+  unsigned long cnt = _counter.total();
+
+  // close the frequency sampling window every second
+  if (now - _sampleStart >= 1000) {
+    _counter.sample();
+    _sampleStart = now;
+  }
 
   // generate _pulse value and actions
   if (cnt != _lastSignalCount) {
@@ -133,37 +128,8 @@ void DigitalSignalElement::pushState(
   std::function<void(const char *pName, const char *eValue)> callback) {
   Element::pushState(callback);
   callback(HomeDing::Actions::Value, _printBoolean(_pulseValue));
+  // 2 signal changes per period
+  callback("frequency", String(_counter.frequency(PULSECOUNTER_WINDOWS) / 2, 2).c_str());
 }  // pushState()
 
-// ----- static interrupt stuff here -----
-
-uint DigitalSignalElement::_usedSignals = 0;
-unsigned long DigitalSignalElement::_signalCount[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
-
-// increment counter on interrupt
-IRAM_ATTR void DigitalSignalElement::onSignal0() {
-  DigitalSignalElement::_signalCount[0]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal1() {
-  DigitalSignalElement::_signalCount[1]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal2() {
-  DigitalSignalElement::_signalCount[2]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal3() {
-  DigitalSignalElement::_signalCount[3]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal4() {
-  DigitalSignalElement::_signalCount[4]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal5() {
-  DigitalSignalElement::_signalCount[5]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal6() {
-  DigitalSignalElement::_signalCount[6]++;
-}
-IRAM_ATTR void DigitalSignalElement::onSignal7() {
-  DigitalSignalElement::_signalCount[7]++;
-}
-
 // End
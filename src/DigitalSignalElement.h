@@ -16,10 +16,13 @@
  *
  * Changelog:
  * * 30.10.2020 created by Matthias Hertel
+ * * 18.10.2026 using PulseCounter for any number of elements and frequency measurement.
  */
 
 #pragma once
 
+#include <PulseCounter.h>
+
 /**
  * @brief The DigitalSignalElement is an special Element that creates actions based
  * on a digital IO signal.
@@ -58,6 +61,11 @@ public:
    */
   virtual void loop() override;
 
+  /**
+   * @brief stop all activities and go inactive.
+   */
+  virtual void term() override;
+
   /**
    * @brief push the current value of all properties to the callback.
    * @param callback callback function that is used for every property.
@@ -66,21 +74,6 @@ public:
     std::function<void(const char *pName, const char *eValue)> callback) override;
 
 private:
-  // ----- static interrupt stuff -----
-  // we have up to 8 interrupt routines at hand to watch up to 8 input GPIOs for signals,
-
-  static uint _usedSignals;
-  static unsigned long _signalCount[8];
-
-  static void onSignal0();
-  static void onSignal1();
-  static void onSignal2();
-  static void onSignal3();
-  static void onSignal4();
-  static void onSignal5();
-  static void onSignal6();
-  static void onSignal7();
-
   // ----- private element members -----
 
   /**
@@ -99,9 +92,14 @@ private:
   bool _pullup = false;
 
   /**
-   * @brief the signal counter offset used.
+   * @brief the counter for the signal changes.
+   */
+  PulseCounter _counter;
+
+  /**
+   * @brief start of the current frequency sampling window.
    */
-  int _signalOff = -1;
+  unsigned long _sampleStart;
 
   // last analyzed signal time.
   unsigned long _lastSignalTime;
@@ -120,23 +118,23 @@ private:
    * @brief The _highAction is emitted when the logical input level is going
    * from LOW to HIGH.
    */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /**
    * @brief The _lowAction is emitted when the logical input level is going from
    * HIGH to LOW.
    */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 
   /**
    * @brief The _valueAction is emitted every time the logical input level
    * changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the DigitalSignalElement onto the ElementRegistry.
 bool DigitalSignalElement::registered =
-  ElementRegistry::registerElement("digitalsignal", DigitalSignalElement::create);
+  ElementRegistry::registerElement("digitalsignal", DigitalSignalElement::create, sizeof(DigitalSignalElement));
 #endif
@@ -13,6 +13,8 @@
 #include <Arduino.h>
 #include <HomeDing.h>
 
+#include <core/Arena.h>
+
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
 // textual versions of the enum Element::STARTUPMODE
@@ -20,6 +22,24 @@
 
 /* ===== Element functions ===== */
 
+/// @brief Allocate the Element in the Arena when open or on the heap.
+void *Element::operator new(size_t size) {
+  void *p = HomeDing::Arena::alloc(size);
+  if (!p) {
+    p = ::operator new(size);
+  }
+  return (p);
+}  // new
+
+
+/// @brief Free an Element allocated on the heap.
+void Element::operator delete(void *p) {
+  if (!HomeDing::Arena::contains(p)) {
+    ::operator delete(p);
+  }
+}  // delete
+
+
 /**
  * @brief initialize the common functionality of all element objects.
  */
@@ -95,6 +115,12 @@ void Element::pushState(
 }  // pushState()
 
 
+/// @brief Elements are not part of the dataflow graph by default.
+bool Element::getOutputs(std::function<void(const String &action)> /* callback */) {
+  return (false);
+}  // getOutputs()
+
+
 
 /// @brief save a local state to a state element.
 /// @param key The key of state variable.
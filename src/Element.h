@@ -14,6 +14,8 @@
 // 29.04.2018 action passing added.
 // 15.05.2018 set = properties and action interface.
 // 15.02.2024 CATEGORY added.
+// 18.10.2026 Elements created during startup are allocated in the Arena.
+// 18.10.2026 getOutputs() for the dataflow graph.
 // -----
 
 #pragma once
@@ -136,6 +138,12 @@ public:
 
   // ===== Livetime management =====
 
+  /// @brief Allocate the Element in the Arena when open or on the heap.
+  static void *operator new(size_t size);
+
+  /// @brief Free an Element allocated on the heap.
+  static void operator delete(void *p);
+
   /// @brief initialize a new Element.
   /// @param board The board reference.
   virtual void init(Board *board);
@@ -173,6 +181,13 @@ public:
     std::function<void(const char *pName, const char *eValue)> callback);
 
 
+  /// @brief Elements that calculate an output value from input values can be part of the
+  /// dataflow graph.
+  /// @param callback callback function that is used for every action sent with the output value.
+  /// @return true when the Element can be evaluated by the dataflow graph.
+  virtual bool getOutputs(std::function<void(const String &action)> callback);
+
+
   /// @brief save a local state to a state element.
   /// @param key The key of state variable.
   /// @param value The value of state variable.
@@ -17,41 +17,80 @@
 #include <core/Logger.h>
 
 // allocate static variables
+ElementRegistry::TypeEntry *ElementRegistry::_types;
 int ElementRegistry::_count;
-const char *ElementRegistry::_names[REG_MAX_TYPES];
-CreateElementFn ElementRegistry::_func[REG_MAX_TYPES];
+int ElementRegistry::_size;
+
+// number of entries the table grows at once.
+#define REG_GROW 16
+
+
+/**
+ * @brief Find the position of the type in the table or the position to insert it.
+ */
+int ElementRegistry::_search(const char *elementTypeName, bool *found) {
+  int lo = 0;
+  int hi = _count;
+
+  *found = false;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    int c = Element::_stricmp(_types[mid].name, elementTypeName);
+    if (c == 0) {
+      *found = true;
+      return (mid);
+    } else if (c < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }  // while
+  return (lo);
+}  // _search()
 
 
 /**
  * @brief Register a Factoryunction to create a Element of the specific type.
  */
 bool ElementRegistry::registerElement(const char *elementTypeName,
-                                      Element *(*CreateElementFn)(void)) {
+                                      Element *(*CreateElementFn)(void),
+                                      size_t size) {
   // This functio is called during static variable initialization. Serial
   // doesn't work so early: LOGGER_RAW("register(%s)", elementTypeName);
-  if (_count < REG_MAX_TYPES - 1) {
-    _names[_count] = elementTypeName;
-    _func[_count] = CreateElementFn;
-    _count++;
-    return (true);
+  bool found;
+  int n = _search(elementTypeName, &found);
+
+  if (found) {
+    // the first registration is used.
+    return (false);
+  }
+
+  if (_count == _size) {
+    TypeEntry *t = (TypeEntry *)realloc(_types, (_size + REG_GROW) * sizeof(TypeEntry));
+    if (!t) {
+      return (false);
+    }
+    _types = t;
+    _size += REG_GROW;
   }
-  return (false);
+
+  // insert sorted
+  memmove(&_types[n + 1], &_types[n], (_count - n) * sizeof(TypeEntry));
+  _types[n] = { elementTypeName, CreateElementFn, (uint16_t)size, 0 };
+  _count++;
+  return (true);
 }  // registerElement()
 
 
 Element *ElementRegistry::createElement(const char *elementTypeName) {
   // LOGGER_RAW("createElement(%s)", elementTypeName);
-  int n;
-  Element *e = NULL;
-
-  // search for the the typeName
-  n = 0;
-  while ((n < _count) && (!String(_names[n]).equalsIgnoreCase(elementTypeName))) {
-    n++;
-  }  // while
+  Element *e = nullptr;
+  bool found;
+  int n = _search(elementTypeName, &found);
 
-  if (n < _count) {
-    e = _func[n]();
+  if (found) {
+    e = _types[n].func();
+    if (e) { _types[n].count++; }
   }  // if
   return (e);
 }  // createElement()
@@ -60,14 +99,22 @@ Element *ElementRegistry::createElement(const char *elementTypeName) {
 /**
  * @brief List all registered elements in JSON array format and return as String.
  */
-String ElementRegistry::list() {
+String ElementRegistry::list(bool details) {
   MicroJsonComposer jc;
   jc.openArray();
   for (int n = 0; n < _count; n++) {
-    jc.addConstant(_names[n]);
+    if (details) {
+      jc.openObject();
+      jc.addProperty("type", _types[n].name);
+      jc.addProperty("size", _types[n].size);
+      jc.addProperty("count", _types[n].count);
+      jc.closeObject();
+    } else {
+      jc.addConstant(_types[n].name);
+    }
   }  // for
   jc.closeArray();
   return (jc.stringify());
 }  // list()
 
-// End
\ No newline at end of file
+// End
@@ -9,13 +9,12 @@
 // More information on https://www.mathertel.de/Arduino
 // -----
 // 31.05.2018 created by Matthias Hertel
+// 18.10.2026 sorted table without a max. number of types, binary search and type statistics.
 // -----
 
 #ifndef ELEMENTREGISTRY_H
 #define ELEMENTREGISTRY_H
 
-#define REG_MAX_TYPES 64
-
 typedef Element *(*CreateElementFn)(void);
 
 /**
@@ -31,24 +30,44 @@ public:
    * @brief Register a Factoryunction to create a Element of the specific type.
    * @param elementTypeName Name of the registered Element type.
    * @param CreateElementFn  Factory Function to create a new Element.
+   * @param size sizeof() the Element class for memory statistics.
    * @return true when registration was successful.
    * @return false when registration failed.
    */
   static bool registerElement(const char *elementTypeName,
-                              Element *(*CreateElementFn)(void));
+                              Element *(*CreateElementFn)(void),
+                              size_t size = 0);
 
+  /**
+   * @brief Create a new Element of the given type.
+   * @param elementTypeName Name of the registered Element type, case insensitive.
+   * @return the new Element or nullptr when the type is not registered.
+   */
   static Element *createElement(const char *elementTypeName);
 
   /**
    * @brief List all registered elements in JSON array format:
+   * @param details include the size of the class and the number of created instances.
    * @returns String with all registered element types.
    */
-  static String list();
+  static String list(bool details = false);
 
 private:
+  /// @brief registered Element type.
+  struct TypeEntry {
+    const char *name;
+    CreateElementFn func;
+    uint16_t size;   ///< sizeof() the Element class or 0 when not given.
+    uint16_t count;  ///< number of created Elements.
+  };
+
+  /// @brief table of registered types sorted by name.
+  static TypeEntry *_types;
   static int _count;
-  static const char *_names[REG_MAX_TYPES];
-  static CreateElementFn _func[REG_MAX_TYPES];
+  static int _size;
+
+  /// @brief Find the position of the type in the table or the position to insert it.
+  static int _search(const char *elementTypeName, bool *found);
 };
 
 
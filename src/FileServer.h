@@ -18,11 +18,13 @@
  * * 10.07.2021 add starting '/' to filenames if not present.
  * * 22.01.2022 create folders before writing to a file.
  * * 22.01.2022 delete folders enabled.
+ * * 18.10.2026 remove outdated precompressed .gz siblings and clear the StaticHandler cache.
  */
 
 #pragma once
 
 #include <hdfs.h>
+#include <StaticHandler.h>
 
 #define JINFO(...)  // LOGGER_JUSTINFO(__VA_ARGS__)
 
@@ -125,6 +127,8 @@ public:
       if (HomeDingFS::exists(fName)) {
         HomeDingFS::remove(fName);
       }
+      _removeSibling(fName);
+      StaticHandler::clearCache();
     }  // if
 
     server.send(200);  // all done.
@@ -159,6 +163,8 @@ public:
       if (HomeDingFS::exists(fName)) {
         HomeDingFS::remove(fName);
       }  // if
+      // the plain and the precompressed file must not both exist.
+      _removeSibling(fName);
 
 #if defined(ESP32)
       // create folder when required, LittleFS on ESP32 doesn't create folders automatically.
@@ -181,11 +187,26 @@ public:
       if (_fsUploadFile) {
         _fsUploadFile.close();
       }
+      StaticHandler::clearCache();
     }  // if
   }  // upload()
 
 
 protected:
+  /// @brief remove the file.gz for a file or the file for a file.gz.
+  void _removeSibling(const String &fName) {
+    String sibling = fName;
+    if (sibling.endsWith(".gz")) {
+      sibling.remove(sibling.length() - 3);
+    } else {
+      sibling.concat(".gz");
+    }
+    if (HomeDingFS::exists(sibling)) {
+      HomeDingFS::remove(sibling);
+    }
+  }  // _removeSibling()
+
+
   File _fsUploadFile;
   Board *_board;
 };
@@ -217,6 +217,10 @@ extern Board homeding;
 #include <RemoteElement.h>
 #endif
 
+#ifdef HOMEDING_INCLUDE_ACTIONBUS
+#include <ActionBusElement.h>
+#endif
+
 #ifdef HOMEDING_INCLUDE_MQTT
 #include <MQTTElement.h>
 #endif
@@ -23,6 +23,7 @@
 #include <HttpClientElement.h>
 
 #include <WiFiClient.h>
+#include <core/HttpPool.h>
 
 #if !defined(TRACE)
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
@@ -32,7 +33,6 @@
 #define NETTRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
 #define MAX_WAIT_FOR_RESPONSE 20
-#define DNS_TIMEOUT (uint32_t)4
 
 #define NEWSTATE(n) _state = n;
 
@@ -80,6 +80,15 @@ void HttpClientElement::processHeader(String &key, String &value) {
   // TRACE(" =<%s>:<%s>", key.c_str(), value.c_str());
   if (key.equalsIgnoreCase("Content-Length")) {
     _contentLength = _atoi(value.c_str());
+
+  } else if (key.equalsIgnoreCase("Connection")) {
+    if (value.equalsIgnoreCase("close")) {
+      _keepAlive = false;
+    }
+
+  } else if (key.equalsIgnoreCase("Transfer-Encoding")) {
+    // chunked results are read until the connection closes.
+    _keepAlive = false;
   }
 };
 
@@ -96,26 +105,22 @@ void HttpClientElement::loop() {
   if (_state == STATE::IDLE) {
     if (!_url.isEmpty()) {
       TRACE("new URL: %s", _url.c_str());
+      _retried = false;
       NEWSTATE(STATE::GETIP);
+    } else {
+      HttpPool::loop();
     }  // if
   }    // if
 
   if (_startTime && (_board->getSeconds() - _startTime > MAX_WAIT_FOR_RESPONSE)) {
     LOGGER_EERR("timeout");
+    _keepAlive = false;
     NEWSTATE(STATE::ABORT);
 
-
-  } else if ((_state == STATE::GETIP) && (_IPaddr)) {
-    NEWSTATE(STATE::SENDING);  // shortcut, reuse IP address.
-
   } else if (_state == STATE::GETIP) {
-    // init result
-    _contentLength = 0;
-
-    // ask for IP address
+    // ask for IP address, using the DNS cache
     NETTRACE("start DNS...");
-    WiFi.hostByName(_host.c_str(), _IPaddr);  // , DNS_TIMEOUT);
-    if (_IPaddr) {
+    if (HttpPool::resolve(_host, _IPaddr)) {
       NETTRACE(".got %s", _IPaddr.toString().c_str());
       NEWSTATE(STATE::SENDING);
     } else {
@@ -127,39 +132,63 @@ void HttpClientElement::loop() {
     }
 
   } else if (_state == STATE::SENDING) {
-    // start remote communication, connect to server
-    if (!_httpClient.connect(_IPaddr, 80)) {
+    // init result
+    _contentLength = -1;
+    _keepAlive = true;
+
+    // get a connection from the pool, wait when all are in use.
+    _client = HttpPool::acquire(_host, _reused);
+
+    if (!_client) {
+      // try again in next loop.
+
+    } else if ((!_reused) && (!_client->connect(_IPaddr, 80))) {
+      // start remote communication, connect to server
       LOGGER_EERR("nocon");
+      HttpPool::forget(_host);
+      _keepAlive = false;
       NEWSTATE(STATE::ABORT);
+
     } else {
       // 2. send request
-      String request("GET $1 HTTP/1.1\r\nHost: $2\r\nConnection: close\r\n\r\n");
+      String request("GET $1 HTTP/1.1\r\nHost: $2\r\nConnection: keep-alive\r\n\r\n");
       request.replace("$1", _url);
       request.replace("$2", _host);
 
       NETTRACE("request:\n%s", request.c_str());
-      _httpClient.write(request.c_str());
+      _client->write(request.c_str());
       _startTime = _board->getSeconds();
       NEWSTATE(STATE::CHECK);
     }  // if
 
   } else if (_state == STATE::CHECK) {
     // see if an answer has come back
-    if (_httpClient.available() > 0) {
+    if (_client->available() > 0) {
       NEWSTATE(STATE::HEADERS);
 
-    } else if (!_httpClient.connected()) {
+    } else if ((!_client->connected()) && (_reused) && (!_retried)) {
+      // the server has closed the kept connection, retry with a new one.
+      NETTRACE("retry");
+      HttpPool::release(_client, false);
+      _client = nullptr;
+      _retried = true;
+      _startTime = 0;
+      NEWSTATE(STATE::SENDING);
+
+    } else if (!_client->connected()) {
       LOGGER_EERR("nocon");
+      _keepAlive = false;
       NEWSTATE(STATE::ABORT);
     }  // if
 
   } else if (_state == STATE::HEADERS) {
     // Read the header lines of the reply from server
-    while (_httpClient.available()) {
-      String line = _httpClient.readStringUntil('\n');
+    while (_client->available()) {
+      String line = _client->readStringUntil('\n');
 
       if (!line.endsWith("\r")) {
         LOGGER_EERR("lineend");
+        _keepAlive = false;
         NEWSTATE(STATE::ABORT);
         break;
       }
@@ -167,13 +196,19 @@ void HttpClientElement::loop() {
       NETTRACE("head: %s", line.c_str());
 
       if (line.isEmpty()) {
-        if (_contentLength) {
+        if (_contentLength > 0) {
           NEWSTATE(STATE::BODY);
         } else {
+          // without a content length the body ends by closing the connection.
+          if (_contentLength < 0) { _keepAlive = false; }
           NEWSTATE(STATE::ABORT);
         }
         break;
 
+      } else if (line.startsWith("HTTP/1.0 ")) {
+        // no persistent connections
+        _keepAlive = false;
+
       } else {
         // isolate header key and value
         int sepPos = line.indexOf(':');
@@ -196,7 +231,7 @@ void HttpClientElement::loop() {
     if (bufLen) {
       char *buffer = (char *)malloc(bufLen + 1);
       memset(buffer, 0, bufLen + 1);
-      size_t r = _httpClient.readBytes(buffer, bufLen);
+      size_t r = _client->readBytes(buffer, bufLen);
       // NETTRACE("  body read %d from %d", r, bufLen);
       _contentLength -= r;
       processBody(buffer);
@@ -209,7 +244,11 @@ void HttpClientElement::loop() {
 
   if (_state == STATE::ABORT) {
     processBody(nullptr);  // body passed completely
-    _httpClient.stop();
+    if (_client) {
+      // keep the connection when the result was read completely.
+      HttpPool::release(_client, _keepAlive && (_contentLength == 0));
+      _client = nullptr;
+    }
     _url = "";
     _startTime = 0;
     NEWSTATE(STATE::IDLE);
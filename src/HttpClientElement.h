@@ -14,6 +14,7 @@
  *
  * Changelog:
  * * 05.01.2020 created by Matthias Hertel
+ * * 18.10.2026 using kept-alive connections and cached DNS results from the HttpPool.
  */
 
 #pragma once
@@ -79,9 +80,13 @@ private:
 
   IPAddress _IPaddr; // ip of the remote device
 
-  WiFiClient _httpClient;
+  WiFiClient *_client = nullptr; // connection from the HttpPool
 
-  /** content size. */
+  bool _reused; // the connection was already established.
+  bool _retried; // the request was retried with a new connection.
+  bool _keepAlive; // the connection can be reused.
+
+  /** content size, -1 when not known. */
   int _contentLength;
 
   /** Time when the request was started. */
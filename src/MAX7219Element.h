@@ -117,5 +117,5 @@ private:
 
 // Register the MAX7219Element onto the ElementRegistry.
 bool MAX7219Element::registered =
-    ElementRegistry::registerElement("max7219", MAX7219Element::create);
+    ElementRegistry::registerElement("max7219", MAX7219Element::create, sizeof(MAX7219Element));
 #endif
@@ -93,5 +93,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the MQTTElement onto the ElementRegistry.
 bool MQTTElement::registered =
-  ElementRegistry::registerElement("mqtt", MQTTElement::create);
+  ElementRegistry::registerElement("mqtt", MQTTElement::create, sizeof(MQTTElement));
 #endif
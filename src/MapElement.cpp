@@ -20,6 +20,8 @@
 #include "MapElement.h"
 #include "MicroJsonParser.h"
 
+#include <algorithm>
+
 #if !defined(TRACE)
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 #endif
@@ -45,40 +47,173 @@ void MapElement::init(Board *board) {
 }  // init()
 
 
-void MapElement::_mapValue(const char *value) {
-  TRACE("map '%s'", value);
-  int mapSize = _mMax.size();
-  int cFound = -1;
+// ===== compiled rules =====
+
+/// @brief parse a value or bound of a rule using the type of the element.
+MapElement::MapKey MapElement::_parseKey(const char *value) {
+  MapKey k;
+  k.i = (_type == MapType::Int) ? _atoi(value) : 0;
+  k.f = (_type == MapType::Float) ? strtof(value, nullptr) : 0;
+  k.s = value;
+  return (k);
+}  // _parseKey()
+
+
+/// @brief return the lower bound of a segment as a key.
+MapElement::MapKey MapElement::_segmentKey(const MapSegment &seg) {
+  MapKey k;
+  k.i = (_type == MapType::Int) ? seg.i : 0;
+  k.f = (_type == MapType::Float) ? seg.f : 0;
+  k.s = (_type == MapType::Str) ? _keys[seg.s].c_str() : "";
+  return (k);
+}  // _segmentKey()
+
+
+/// @brief compare 2 keys and return <0, 0 or >0 like strcmp.
+int MapElement::_compare(const MapKey &k1, const MapKey &k2) {
+  if (_type == MapType::Str) {
+    return (_stricmp(k1.s, k2.s));
+  } else if (_type == MapType::Float) {
+    return ((k1.f > k2.f) - (k1.f < k2.f));
+  }
+  return ((k1.i > k2.i) - (k1.i < k2.i));
+}  // _compare()
+
 
-  // walk through the max values to find the last one that fits.
-  for (int c = 0; c < mapSize; c++) {
-    bool ruleFits = true;  // until we find it is not
+/// @brief Return true when the position k1 is lower than the position k2.
+/// A position at a key is lower than the position right after the same key.
+bool MapElement::_less(const MapKey &k1, bool after1, const MapKey &k2, bool after2) {
+  int c = _compare(k1, k2);
+  return ((c < 0) || ((c == 0) && (!after1) && (after2)));
+}  // _less()
 
-    // value lower than `min` ?
-    String v = _mMin[c];
+
+/**
+ * @brief Compile the rules into the sorted table of segments.
+ * Every min bound starts a segment at the bound and every max bound starts a segment right
+ * after the bound. The first rule that includes the start of a segment includes all values of
+ * the segment. Neighbor segments with the same rule are combined.
+ */
+void MapElement::_compileRules() {
+  int rules = max(max(_mMin.size(), _mMax.size()), max(_mValue.size(), _mActions.size()));
+
+  std::vector<MapSegment> bounds;
+  std::vector<MapSegment> lower(rules);
+  std::vector<MapSegment> upper(rules);
+
+  _segments.clear();
+  _keys.clear();
+  _keys.reserve(2 * rules);
+
+  // create a bound from a rule, rule is set to -1 when no bound is given.
+  auto makeBound = [this](const String &v, bool after, MapSegment &b) {
+    b.i = 0;
+    b.after = after;
+    b.rule = v.isEmpty() ? -1 : 0;
     if (v.isEmpty()) {
-      // value is always inside when no lower boundary is given
-    } else if ((_isStringType) && _stricmp(value, v.c_str()) < 0) {
-      ruleFits = false;  // no match, value is too low
-    } else if ((!_isStringType) && _atoi(value) < v.toInt()) {
-      ruleFits = false;  // no match, value is too low
+      // no bound
+    } else if (_type == MapType::Str) {
+      b.s = _keys.size();
+      _keys.push_back(v);
+    } else if (_type == MapType::Float) {
+      b.f = strtof(v.c_str(), nullptr);
+    } else {
+      b.i = _atoi(v.c_str());
+      if ((after) && (b.i < INT32_MAX)) {
+        // with integers the segment after max starts at max + 1.
+        b.i++;
+        b.after = false;
+      }
     }
+  };
 
-    v = _mMax[c];
-    // value higher than `max` ?
-    if (v.isEmpty()) {
-      // value is always inside when no upper boundary is given
-    } else if ((_isStringType) && _stricmp(value, v.c_str()) > 0) {
-      ruleFits = false;
-    } else if ((!_isStringType) && _atoi(value) > v.toInt()) {
-      ruleFits = false;
+  for (int c = 0; c < rules; c++) {
+    makeBound(_mMin[c], false, lower[c]);
+    if (lower[c].rule == 0) bounds.push_back(lower[c]);
+    makeBound(_mMax[c], true, upper[c]);
+    if (upper[c].rule == 0) bounds.push_back(upper[c]);
+  }
+
+  std::sort(bounds.begin(), bounds.end(), [this](const MapSegment &b1, const MapSegment &b2) {
+    return (_less(_segmentKey(b1), b1.after, _segmentKey(b2), b2.after));
+  });
+
+  // the first segment without a lower bound followed by the segments of all bounds.
+  for (int n = -1; n < (int)bounds.size(); n++) {
+    MapSegment seg;
+    seg.i = 0;
+    seg.after = false;
+    seg.rule = -1;
+
+    if (n >= 0) {
+      seg = bounds[n];
+      seg.rule = -1;
+      if ((n > 0) && (!_less(_segmentKey(bounds[n - 1]), bounds[n - 1].after, _segmentKey(seg), seg.after))) {
+        continue;  // same bound as before
+      }
     }
 
-    if (ruleFits) {
-      cFound = c;
-      break;
+    for (int c = 0; c < rules; c++) {
+      bool fits;
+      if (n < 0) {
+        fits = (lower[c].rule < 0);
+      } else {
+        MapKey k = _segmentKey(seg);
+        fits = ((lower[c].rule < 0) || (!_less(k, seg.after, _segmentKey(lower[c]), false)))
+               && ((upper[c].rule < 0) || (_less(k, seg.after, _segmentKey(upper[c]), upper[c].after)));
+      }
+      if (fits) {
+        seg.rule = c;
+        break;
+      }
+    }  // for
+
+    if ((_segments.empty()) || (_segments.back().rule != seg.rule)) {
+      TRACE("segment[%d] rule=%d", _segments.size(), seg.rule);
+      _segments.push_back(seg);
     }
   }  // for
+  _segments.shrink_to_fit();
+  _lastSegment = 0;
+}  // _compileRules()
+
+
+/// @brief find the segment that includes the value.
+int MapElement::_findSegment(const MapKey &value) {
+  int size = _segments.size();
+  int n = _lastSegment;
+
+  // check the last found segment first
+  if ((n == 0) || (!_less(value, false, _segmentKey(_segments[n]), _segments[n].after))) {
+    if ((n + 1 == size) || (_less(value, false, _segmentKey(_segments[n + 1]), _segments[n + 1].after))) {
+      return (n);
+    }
+  }
+
+  // binary search for the last segment that starts at or before the value.
+  int lo = 0;
+  int hi = size - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (_less(value, false, _segmentKey(_segments[mid]), _segments[mid].after)) {
+      hi = mid - 1;
+    } else {
+      lo = mid;
+    }
+  }
+  _lastSegment = lo;
+  return (lo);
+}  // _findSegment()
+
+
+void MapElement::_mapValue(const char *value) {
+  TRACE("map '%s'", value);
+
+  if (_segments.empty()) {
+    _compileRules();
+  }
+
+  int cFound = _segments[_findSegment(_parseKey(value))].rule;
 
   // TRACE("rule=%d", cFound);
 
@@ -119,9 +254,10 @@ bool MapElement::set(const char *name, const char *value) {
 
     // save all values and actions in the vectors.
     size_t mapIndex = _atoi(name + 6);  // number starts after "rules["
-    char *mapName = strrchr(name, MICROJSON_PATH_SEPARATOR) + 1;
+    const char *mapName = strrchr(name, MICROJSON_PATH_SEPARATOR) + 1;
 
     // LOGGER_EINFO("map[%d] '%s'='%s'", mapIndex, mapName, value);
+    _segments.clear();  // compile again
 
     if (_stricmp(mapName, "min") == 0) {
       _mMin.setAt(mapIndex, value);
@@ -138,12 +274,22 @@ bool MapElement::set(const char *name, const char *value) {
 
     } else if (_stricmp(mapName, "onValue") == 0) {
       _mActions.setAt(mapIndex, value);
+      if (_mTemplates.size() <= mapIndex) {
+        _mTemplates.resize(mapIndex + 1);
+      }
+      _mTemplates[mapIndex] = value;
 
     }  // if
 
   } else if (name == HomeDing::Actions::Type) {
-    if (_stricmp(value, "string") == 0)
-      _isStringType = true;
+    if (_stricmp(value, "string") == 0) {
+      _type = MapType::Str;
+    } else if (_stricmp(value, "float") == 0) {
+      _type = MapType::Float;
+    } else {
+      _type = MapType::Int;
+    }
+    _segments.clear();  // compile again
 
   } else if (name == HomeDing::Actions::OnValue) {
     _valueAction = value;
@@ -164,7 +310,9 @@ bool MapElement::set(const char *name, const char *value) {
  */
 void MapElement::loop() {
   if (_needUpdate) {
-    HomeDing::Actions::push(_mActions[_currentMapIndex], _value);
+    if ((size_t)_currentMapIndex < _mTemplates.size()) {
+      HomeDing::Actions::push(_mTemplates[_currentMapIndex], _value);
+    }
     HomeDing::Actions::push(_valueAction, _value);
     _needUpdate = false;
   }
@@ -180,4 +328,13 @@ void MapElement::pushState(
   callback(HomeDing::Actions::Value, _value.c_str());
 }  // pushState()
 
+
+bool MapElement::getOutputs(std::function<void(const String &action)> callback) {
+  callback(_valueAction);
+  for (uint16_t n = 0; n < _mActions.size(); n++) {
+    callback(_mActions[n]);
+  }
+  return (true);
+}  // getOutputs()
+
 // End
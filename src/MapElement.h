@@ -14,6 +14,8 @@
  * Changelog:
  * * 29.03.2020 created by Matthias Hertel
  * * 06.06.2021 full implementation of rules.
+ * * 18.10.2026 node in the dataflow graph.
+ * * 18.10.2026 rules are compiled into a sorted table of segments, type float.
  */
 
 /**
@@ -21,11 +23,20 @@
  * @details
 @verbatim
 
-The MapElement can ...
+The MapElement finds the first rule with a range (min, max) that includes the incoming value and
+sends out the value of the rule. The values are compared as "int", "float" or "string" as
+specified by the type property.
+
+Before the first value is mapped the rules are compiled into a sorted table of segments that
+cover the whole value range without overlapping. Every segment holds the first rule that
+includes all values of the segment so a value is mapped by a binary search. The last found
+segment is checked first so repeated values are mapped without searching.
 
 @endverbatim
  */
 
+#include <vector>
+
 class MapElement : public Element
 {
 public:
@@ -67,6 +78,12 @@ public:
   virtual void pushState(
       std::function<void(const char *pName, const char *eValue)> callback);
 
+  /**
+   * @brief report the actions sent with the mapped value.
+   * @param callback callback function that is used for every action.
+   */
+  virtual bool getOutputs(std::function<void(const String &action)> callback) override;
+
 private:
   /**
    * @brief The actual outgoing(mapped) value.
@@ -76,7 +93,13 @@ private:
   int _currentMapIndex = -1;
   bool _needUpdate = false;
 
-  bool _isStringType;
+  /// @brief type of the values and bounds of the rules.
+  enum class MapType : uint8_t {
+    Int = 0,
+    Float,
+    Str
+  };
+  MapType _type = MapType::Int;
 
   // send out mapped value each time the same value is received.
   bool _resend = true;
@@ -86,11 +109,45 @@ private:
   ArrayString _mMax;     // higher bound of the range (inclusive)
   ArrayString _mValue;   // new value when rule is choosen
   ArrayString _mActions; // actions when rule is choosen
+  std::vector<HomeDing::Actions::ActionString> _mTemplates; // compiled actions of the rules
 
   /**
    * @brief The _valueAction holds the actions that is submitted when ...
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
+
+  /// @brief a value or bound of a rule.
+  struct MapKey {
+    int32_t i;
+    float f;
+    const char *s;
+  };
+
+  /// @brief A segment of the value range that is mapped by the same rule.
+  struct MapSegment {
+    union {
+      int32_t i;   // lower bound for type int
+      float f;     // lower bound for type float
+      uint16_t s;  // index of the lower bound in _keys for type string
+    };
+    bool after;    // the segment starts right after the bound
+    int16_t rule;  // index of the rule or -1 when no rule fits
+  };
+
+  // compiled rules, sorted by the lower bound. The first segment has no lower bound.
+  std::vector<MapSegment> _segments;
+  std::vector<String> _keys;
+
+  // the segment that was found last.
+  int _lastSegment = 0;
+
+  MapKey _parseKey(const char *value);
+  MapKey _segmentKey(const MapSegment &seg);
+  int _compare(const MapKey &k1, const MapKey &k2);
+  bool _less(const MapKey &k1, bool after1, const MapKey &k2, bool after2);
+
+  void _compileRules();
+  int _findSegment(const MapKey &value);
 
   void _mapValue(const char *value);
 };
@@ -100,5 +157,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the MapElement onto the ElementRegistry.
 bool MapElement::registered =
-    ElementRegistry::registerElement("map", MapElement::create);
+    ElementRegistry::registerElement("map", MapElement::create, sizeof(MapElement));
 #endif
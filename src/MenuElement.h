@@ -69,17 +69,17 @@ ValueElement *valueList[MAXMENUVALUES];
   /**
    * @brief The _displayAction holds the actions that is submitted when a new menu item was selected or the value has changed.
    */
-  String _displayAction;
+  HomeDing::Actions::ActionString _displayAction;
 
   /**
    * @brief The _valueAction holds the actions that is submitted when the value has changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   /**
    * @brief The _menuAction holds the actions that is submitted when a new menu item was selected.
    */
-  String _menuAction;
+  HomeDing::Actions::ActionString _menuAction;
 };
 
 /* ===== Register the Element ===== */
@@ -90,5 +90,5 @@ ValueElement *valueList[MAXMENUVALUES];
 #ifdef HOMEDING_REGISTER
 // Register the MenuElement onto the ElementRegistry.
 bool MenuElement::registered =
-    ElementRegistry::registerElement("menu", MenuElement::create);
+    ElementRegistry::registerElement("menu", MenuElement::create, sizeof(MenuElement));
 #endif
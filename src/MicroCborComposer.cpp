@@ -0,0 +1,130 @@
+/**
+ * @file MicroCborComposer.cpp
+ * @brief String based buffer to create CBOR encoded objects.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino
+ *
+ * Changelog: see MicroCborComposer.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+#include <MicroCborComposer.h>
+
+#define CTRACE(...) // Serial.sprintf(__VA_ARGS__); Serial.println()
+
+// CBOR major types
+#define CBOR_UINT 0
+#define CBOR_NINT 1
+#define CBOR_TEXT 3
+#define CBOR_ARRAY 4
+#define CBOR_MAP 5
+
+// CBOR initial bytes
+#define CBOR_FALSE 0xF4
+#define CBOR_TRUE 0xF5
+#define CBOR_ARRAY_INDEFINITE 0x9F
+#define CBOR_MAP_INDEFINITE 0xBF
+#define CBOR_BREAK 0xFF
+
+MicroCborComposer::MicroCborComposer(int size) {
+  _out.reserve(size);
+}
+
+void MicroCborComposer::_addHead(uint8_t major, uint32_t arg) {
+  major <<= 5;
+  if (arg < 24) {
+    _out.concat((char)(major | arg));
+
+  } else if (arg <= 0xFF) {
+    _out.concat((char)(major | 24));
+    _out.concat((char)arg);
+
+  } else if (arg <= 0xFFFF) {
+    _out.concat((char)(major | 25));
+    _out.concat((char)(arg >> 8));
+    _out.concat((char)arg);
+
+  } else {
+    _out.concat((char)(major | 26));
+    _out.concat((char)(arg >> 24));
+    _out.concat((char)(arg >> 16));
+    _out.concat((char)(arg >> 8));
+    _out.concat((char)arg);
+  }
+}
+
+void MicroCborComposer::_addText(const char *text, size_t len) {
+  _out.reserve((_out.length() + len + 64) & 0xFFFFC0);
+  _addHead(CBOR_TEXT, len);
+  _out.concat(text, len);
+}
+
+void MicroCborComposer::openObject() {
+  _out.concat((char)CBOR_MAP_INDEFINITE);
+}
+
+void MicroCborComposer::addObject(const char *id) {
+  CTRACE("addObject(%s)", id);
+  _addText(id, strlen(id));
+  _out.concat((char)CBOR_MAP_INDEFINITE);
+}
+
+void MicroCborComposer::closeObject() {
+  _out.concat((char)CBOR_BREAK);
+}
+
+void MicroCborComposer::openArray() {
+  _out.concat((char)CBOR_ARRAY_INDEFINITE);
+}
+
+void MicroCborComposer::addConstant(const char *value) {
+  _addText(value, strlen(value));
+}
+
+void MicroCborComposer::addConstant(bool value) {
+  _out.concat((char)(value ? CBOR_TRUE : CBOR_FALSE));
+}
+
+void MicroCborComposer::closeArray() {
+  _out.concat((char)CBOR_BREAK);
+}
+
+
+// Create a property with String value
+void MicroCborComposer::addProperty(const char *key, const String &value) {
+  CTRACE("addProperty(%s)", key);
+  _addText(key, strlen(key));
+  _addText(value.c_str(), value.length());
+}
+
+// Create a property with char* value
+void MicroCborComposer::addProperty(const char *key, const char *value) {
+  CTRACE("addProperty(%s)", key);
+  _addText(key, strlen(key));
+  _addText(value, strlen(value));
+}
+
+// Create a property with int value
+void MicroCborComposer::addProperty(const char *key, long value) {
+  _addText(key, strlen(key));
+  if (value >= 0) {
+    _addHead(CBOR_UINT, value);
+  } else {
+    _addHead(CBOR_NINT, -1 - value);
+  }
+}
+
+// Return the composed data
+const String &MicroCborComposer::data() {
+  return (_out);
+}
+
+// end.
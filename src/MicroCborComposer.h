@@ -0,0 +1,73 @@
+/**
+ * @file MicroCborComposer.h
+ * @brief String based buffer to create CBOR encoded objects.
+ *
+ * This class creates a CBOR (RFC 8949) encoded binary string by appending arrays, objects and
+ * properties like the MicroJsonComposer. Arrays and objects are encoded with indefinite length
+ * so they can be created in a single pass.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ */
+
+#pragma once
+
+/// @brief Content type of CBOR encoded data.
+#define APPLICATION_CBOR "application/cbor"
+
+class MicroCborComposer {
+public:
+  MicroCborComposer(int size = 300);
+
+  // Add a new unnamed object in root or array
+  void openObject();
+
+  // Add a new named object
+  void addObject(const char *id);
+
+  void closeObject();
+
+  // Add a new unnamed array in root or array
+  void openArray();
+
+  // add a String value to array
+  void addConstant(const char *value);
+
+  // add a boolean value to array
+  void addConstant(bool value);
+
+  void closeArray();
+
+  // Create a property with String value
+  void addProperty(const char *key, const String &value);
+
+  // Create a property with int value
+  void addProperty(const char *key, long value);
+
+  // Create a property with char* value
+  void addProperty(const char *key, const char *value);
+
+  /// @brief Return the encoded data, the String may include '\0' characters.
+  const String &data();
+
+protected:
+  // add the initial byte with the major type and the argument
+  void _addHead(uint8_t major, uint32_t arg);
+
+  // add a text string
+  void _addText(const char *text, size_t len);
+
+  // result buffer
+  String _out;
+};
+
+// end.
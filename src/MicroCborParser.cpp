@@ -0,0 +1,200 @@
+/**
+ * @file MicroCborParser.cpp
+ *
+ * @brief CBOR parser with minimal memory impact.
+ * This class is part of the HomeDing Library.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see MicroCborParser.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+#include <MicroCborParser.h>
+
+#define CTRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
+
+// max. nesting of arrays and maps.
+#define MICROCBOR_MAX_LEVEL 8
+
+// CBOR major types
+#define CBOR_UINT 0
+#define CBOR_NINT 1
+#define CBOR_BYTES 2
+#define CBOR_TEXT 3
+#define CBOR_ARRAY 4
+#define CBOR_MAP 5
+#define CBOR_TAG 6
+#define CBOR_SIMPLE 7
+
+// additional information for indefinite length
+#define CBOR_INDEFINITE 31
+#define CBOR_BREAK 0xFF
+
+
+MicroCbor::MicroCbor(MicroCborCallbackFn callback) {
+  _callbackFn = callback;
+}
+
+
+bool MicroCbor::isMap(const uint8_t *data, size_t len) {
+  return ((len > 0) && ((data[0] >> 5) == CBOR_MAP));
+}
+
+
+bool MicroCbor::parse(const uint8_t *data, size_t len) {
+  _pos = data;
+  _end = data + len;
+  _path[0] = '\0';
+  return (_parseItem(0) && (_pos == _end));
+}
+
+
+bool MicroCbor::_readArg(uint8_t info, uint64_t &arg) {
+  if (info < 24) {
+    arg = info;
+
+  } else if (info <= 27) {
+    int bytes = 1 << (info - 24);
+    if (_end - _pos < bytes) return (false);
+    arg = 0;
+    while (bytes--) {
+      arg = (arg << 8) | *_pos++;
+    }
+
+  } else {
+    return (false);
+  }
+  return (true);
+}
+
+
+// convert a half precision float to a float.
+static float _halfToFloat(uint16_t h) {
+  int exp = (h >> 10) & 0x1F;
+  int mant = h & 0x3FF;
+  float v;
+
+  if (exp == 0) {
+    v = ldexp(mant, -24);
+  } else if (exp != 31) {
+    v = ldexp(mant + 1024, exp - 25);
+  } else {
+    v = (mant == 0) ? INFINITY : NAN;
+  }
+  return ((h & 0x8000) ? -v : v);
+}
+
+
+bool MicroCbor::_parseItem(int level) {
+  if ((_pos >= _end) || (level > MICROCBOR_MAX_LEVEL)) return (false);
+
+  uint8_t major = *_pos >> 5;
+  uint8_t info = *_pos & 0x1F;
+  uint64_t arg = 0;
+  _pos++;
+
+  bool indefinite = (info == CBOR_INDEFINITE) && ((major == CBOR_ARRAY) || (major == CBOR_MAP));
+  if ((!indefinite) && (major != CBOR_SIMPLE) && (!_readArg(info, arg))) return (false);
+
+  size_t pathLen = strlen(_path);
+  bool ret = true;
+
+  if (major == CBOR_UINT) {
+    if (arg > 0xFFFFFFFFUL) return (false);
+    snprintf(_value, sizeof(_value), "%lu", (unsigned long)arg);
+    _callbackFn(level, _path, _value);
+
+  } else if (major == CBOR_NINT) {
+    if (arg >= 0xFFFFFFFFUL) return (false);
+    snprintf(_value, sizeof(_value), "-%lu", (unsigned long)arg + 1);
+    _callbackFn(level, _path, _value);
+
+  } else if (major == CBOR_TEXT) {
+    if ((uint64_t)(_end - _pos) < arg) return (false);
+    size_t len = (arg < sizeof(_value)) ? arg : sizeof(_value) - 1;
+    memcpy(_value, _pos, len);
+    _value[len] = '\0';
+    _pos += arg;
+    _callbackFn(level, _path, _value);
+
+  } else if (major == CBOR_ARRAY) {
+    for (uint64_t n = 0; (indefinite) || (n < arg); n++) {
+      if ((indefinite) && (_pos < _end) && (*_pos == CBOR_BREAK)) {
+        _pos++;
+        break;
+      }
+      snprintf(_path + pathLen, sizeof(_path) - pathLen, "[%u]", (unsigned)n);
+      if (!_parseItem(level + 1)) return (false);
+    }
+
+  } else if (major == CBOR_MAP) {
+    for (uint64_t n = 0; (indefinite) || (n < arg); n++) {
+      if ((indefinite) && (_pos < _end) && (*_pos == CBOR_BREAK)) {
+        _pos++;
+        break;
+      }
+
+      // the key must be a text string
+      uint64_t keyLen;
+      if ((_pos >= _end) || ((*_pos >> 5) != CBOR_TEXT)) return (false);
+      info = *_pos++ & 0x1F;
+      if ((!_readArg(info, keyLen)) || ((uint64_t)(_end - _pos) < keyLen)) return (false);
+
+      size_t len = pathLen;
+      if (len > 0) _path[len++] = '/';
+      if (len + keyLen >= sizeof(_path)) return (false);
+      memcpy(_path + len, _pos, keyLen);
+      _path[len + keyLen] = '\0';
+      _pos += keyLen;
+
+      if (!_parseItem(level + 1)) return (false);
+    }
+
+  } else if (major == CBOR_TAG) {
+    // tags are ignored, a tag counts as a level to limit the nesting.
+    ret = _parseItem(level + 1);
+
+  } else if (major == CBOR_SIMPLE) {
+    if (info == 20) {
+      strcpy(_value, "false");
+    } else if (info == 21) {
+      strcpy(_value, "true");
+    } else if (info == 22) {
+      _value[0] = '\0';  // null
+    } else if ((info >= 25) && (info <= 27) && (_readArg(info, arg))) {
+      double v;
+      if (info == 25) {
+        v = _halfToFloat(arg);
+      } else if (info == 26) {
+        uint32_t u = arg;
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        v = f;
+      } else {
+        memcpy(&v, &arg, sizeof(v));
+      }
+      snprintf(_value, sizeof(_value), "%.6g", v);
+    } else {
+      return (false);
+    }
+    _callbackFn(level, _path, _value);
+
+  } else {
+    // byte strings are not supported
+    ret = false;
+  }
+
+  _path[pathLen] = '\0';
+  return (ret);
+}
+
+// end.
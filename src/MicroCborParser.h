@@ -0,0 +1,80 @@
+/**
+ * @file MicroCborParser.h
+ *
+ * @brief CBOR parser with minimal memory impact.
+ * This class is part of the HomeDing Library.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+The parser reports every value of the CBOR (RFC 8949) data with the same path and value
+format as the MicroJson parser. Map keys must be text strings and are separated by '/', array
+items use the index like `list[0]`. Numbers, true, false and null are reported as text.
+Tags are ignored and byte strings are not supported.
+@endverbatim
+ */
+
+
+#pragma once
+
+#include <functional>
+
+/**
+ * @brief Signature of the callback function.
+ */
+typedef std::function<void(int level, char *path, char *value)>
+    MicroCborCallbackFn;
+
+class MicroCbor
+{
+public:
+  /**
+   * @brief Construct a new Micro Cbor object
+   * and register a callback function.
+   * @param callback
+   */
+  MicroCbor(MicroCborCallbackFn callback);
+
+  /**
+   * @brief Parse CBOR encoded data.
+   * @param data The CBOR data.
+   * @param len The length of the data.
+   * @return true when the data could be parsed completely.
+   */
+  bool parse(const uint8_t *data, size_t len);
+
+  /**
+   * @brief Return true when the data starts with a CBOR map.
+   * @param data The data.
+   * @param len The length of the data.
+   */
+  static bool isMap(const uint8_t *data, size_t len);
+
+protected:
+  /// @brief parse the next data item.
+  bool _parseItem(int level);
+
+  /// @brief read the argument of the initial byte.
+  bool _readArg(uint8_t info, uint64_t &arg);
+
+  const uint8_t *_pos;
+  const uint8_t *_end;
+
+  char _path[128];
+  char _value[200];
+
+  MicroCborCallbackFn _callbackFn;
+};
+
+// end.
@@ -44,5 +44,5 @@ protected:
 #ifdef HOMEDING_REGISTER
 // Register the OrElement onto the ElementRegistry.
 bool OrElement::registered =
-    ElementRegistry::registerElement("or", OrElement::create);
+    ElementRegistry::registerElement("or", OrElement::create, sizeof(OrElement));
 #endif
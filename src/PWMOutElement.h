@@ -75,5 +75,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the PWMOutElement onto the ElementRegistry.
 bool PWMOutElement::registered =
-    ElementRegistry::registerElement("pwmout", PWMOutElement::create);
+    ElementRegistry::registerElement("pwmout", PWMOutElement::create, sizeof(PWMOutElement));
 #endif
@@ -0,0 +1,281 @@
+/**
+ * @file PulseCounter.cpp
+ *
+ * @brief The PulseCounter captures pulses on a digital input and provides windowed frequency
+ * and period statistics.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see PulseCounter.h
+ */
+
+#include <Arduino.h>
+#include <PulseCounter.h>
+
+#if defined(ESP32)
+#include <soc/soc_caps.h>
+
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)) && SOC_PCNT_SUPPORTED
+#define PULSECOUNTER_PCNT
+#include <driver/pulse_cnt.h>
+
+// The hardware counter is 16 bit wide and accumulates on reaching the limit.
+#define PCNT_LIMIT 30000
+#endif
+
+// The spinlock protects the counters shared with the interrupt routine.
+static portMUX_TYPE _pulseMux = portMUX_INITIALIZER_UNLOCKED;
+#define PULSE_LOCK() portENTER_CRITICAL(&_pulseMux)
+#define PULSE_UNLOCK() portEXIT_CRITICAL(&_pulseMux)
+#define PULSE_ISR_LOCK() portENTER_CRITICAL_ISR(&_pulseMux)
+#define PULSE_ISR_UNLOCK() portEXIT_CRITICAL_ISR(&_pulseMux)
+
+#else
+#define PULSE_LOCK() noInterrupts()
+#define PULSE_UNLOCK() interrupts()
+#define PULSE_ISR_LOCK()
+#define PULSE_ISR_UNLOCK()
+#endif
+
+#define CTRACE(...)  // Serial.printf(__VA_ARGS__)
+
+
+PulseCounter::~PulseCounter() {
+  end();
+}
+
+
+// count a pulse and capture the time of the first and last pulse in the window.
+IRAM_ATTR void PulseCounter::_onPulse(void *arg) {
+  PulseCounter *pc = (PulseCounter *)arg;
+  uint32_t now = micros();
+
+  PULSE_ISR_LOCK();
+  if (!pc->_cnt) {
+    pc->_first = now;
+  }
+  pc->_cnt = pc->_cnt + 1;
+  pc->_total = pc->_total + 1;
+  pc->_last = now;
+  PULSE_ISR_UNLOCK();
+}  // _onPulse()
+
+
+bool PulseCounter::begin(int pin, int edge, bool pullup, bool hardware) {
+  CTRACE("PulseCounter::begin(%d)\n", pin);
+  end();
+  if (pin < 0) {
+    return (false);
+  }
+
+  _pin = pin;
+  pinMode(_pin, pullup ? INPUT_PULLUP : INPUT);
+
+#if defined(PULSECOUNTER_PCNT)
+  if (hardware) {
+    pcnt_unit_handle_t unit = nullptr;
+    pcnt_channel_handle_t channel = nullptr;
+
+    pcnt_unit_config_t unitConfig = {};
+    unitConfig.low_limit = -PCNT_LIMIT;
+    unitConfig.high_limit = PCNT_LIMIT;
+    unitConfig.flags.accum_count = 1;
+
+    pcnt_chan_config_t chanConfig = {};
+    chanConfig.edge_gpio_num = _pin;
+    chanConfig.level_gpio_num = -1;
+
+    if (pcnt_new_unit(&unitConfig, &unit) == ESP_OK) {
+      pcnt_channel_edge_action_t rising = (edge == FALLING) ? PCNT_CHANNEL_EDGE_ACTION_HOLD : PCNT_CHANNEL_EDGE_ACTION_INCREASE;
+      pcnt_channel_edge_action_t falling = (edge == RISING) ? PCNT_CHANNEL_EDGE_ACTION_HOLD : PCNT_CHANNEL_EDGE_ACTION_INCREASE;
+
+      if ((pcnt_new_channel(unit, &chanConfig, &channel) == ESP_OK)
+          && (pcnt_channel_set_edge_action(channel, rising, falling) == ESP_OK)
+          && (pcnt_unit_add_watch_point(unit, PCNT_LIMIT) == ESP_OK)
+          && (pcnt_unit_enable(unit) == ESP_OK)
+          && (pcnt_unit_clear_count(unit) == ESP_OK)
+          && (pcnt_unit_start(unit) == ESP_OK)) {
+        _unit = unit;
+        _channel = channel;
+        _hwLast = 0;
+
+      } else {
+        // no usable hardware counter, fall back to interrupts
+        if (channel) pcnt_del_channel(channel);
+        pcnt_del_unit(unit);
+      }
+    }  // if
+  }  // if
+#else
+  (void)hardware;
+#endif
+
+  if (!_unit) {
+    attachInterruptArg(digitalPinToInterrupt(_pin), PulseCounter::_onPulse, this, edge);
+  }
+
+  _total = 0;
+  restart();
+  CTRACE("  hardware=%d\n", isHardware());
+  return (true);
+}  // begin()
+
+
+void PulseCounter::end() {
+  if (_pin >= 0) {
+#if defined(PULSECOUNTER_PCNT)
+    if (_unit) {
+      pcnt_unit_stop((pcnt_unit_handle_t)_unit);
+      pcnt_unit_disable((pcnt_unit_handle_t)_unit);
+      pcnt_del_channel((pcnt_channel_handle_t)_channel);
+      pcnt_del_unit((pcnt_unit_handle_t)_unit);
+    }
+#endif
+    if (!_unit) {
+      detachInterrupt(digitalPinToInterrupt(_pin));
+    }
+    _unit = nullptr;
+    _channel = nullptr;
+    _pin = -1;
+  }
+}  // end()
+
+
+void PulseCounter::restart() {
+  PULSE_LOCK();
+  _cnt = 0;
+  PULSE_UNLOCK();
+
+#if defined(PULSECOUNTER_PCNT)
+  if (_unit) {
+    int hw = 0;
+    pcnt_unit_get_count((pcnt_unit_handle_t)_unit, &hw);
+    _total += (hw - _hwLast);
+    _hwLast = hw;
+  }
+#endif
+
+  _hasRef = false;
+  _winStart = micros();
+  memset(_win, 0, sizeof(_win));
+  _winPos = 0;
+}  // restart()
+
+
+void PulseCounter::sample() {
+  uint32_t now = micros();
+  Window w = {};
+
+#if defined(PULSECOUNTER_PCNT)
+  if (_unit) {
+    // no timestamps available, the window duration is used.
+    int hw = 0;
+    pcnt_unit_get_count((pcnt_unit_handle_t)_unit, &hw);
+    w.count = w.intervals = (uint32_t)(hw - _hwLast);
+    w.duration = now - _winStart;
+    _total += w.count;
+    _hwLast = hw;
+  }
+#endif
+
+  if (!_unit) {
+    uint32_t first, last;
+
+    PULSE_LOCK();
+    w.count = _cnt;
+    first = _first;
+    last = _last;
+    _cnt = 0;
+    PULSE_UNLOCK();
+
+    if (w.count) {
+      // measure from the last pulse of a previous window when available.
+      if (_hasRef) {
+        w.intervals = w.count;
+        w.duration = last - _ref;
+      } else {
+        w.intervals = w.count - 1;
+        w.duration = last - first;
+      }
+      _ref = last;
+      _hasRef = true;
+    }
+    w.idle = _hasRef ? (now - _ref) : (now - _winStart);
+  }
+
+  _winStart = now;
+  _winPos = (_winPos + 1) % PULSECOUNTER_WINDOWS;
+  _win[_winPos] = w;
+}  // sample()
+
+
+uint32_t PulseCounter::total() {
+  uint32_t t;
+#if defined(PULSECOUNTER_PCNT)
+  if (_unit) {
+    int hw = 0;
+    pcnt_unit_get_count((pcnt_unit_handle_t)_unit, &hw);
+    return (_total + (hw - _hwLast));
+  }
+#endif
+  PULSE_LOCK();
+  t = _total;
+  PULSE_UNLOCK();
+  return (t);
+}  // total()
+
+
+uint32_t PulseCounter::pending() {
+  uint32_t c;
+#if defined(PULSECOUNTER_PCNT)
+  if (_unit) {
+    int hw = 0;
+    pcnt_unit_get_count((pcnt_unit_handle_t)_unit, &hw);
+    return ((uint32_t)(hw - _hwLast));
+  }
+#endif
+  PULSE_LOCK();
+  c = _cnt;
+  PULSE_UNLOCK();
+  return (c);
+}  // pending()
+
+
+float PulseCounter::frequency(int windows) {
+  uint32_t intervals = 0;
+  uint64_t duration = 0;
+  float f = 0;
+
+  windows = constrain(windows, 1, PULSECOUNTER_WINDOWS);
+  for (int n = 0; n < windows; n++) {
+    const Window &w = _win[(_winPos + PULSECOUNTER_WINDOWS - n) % PULSECOUNTER_WINDOWS];
+    intervals += w.intervals;
+    duration += w.duration;
+  }
+
+  if ((intervals) && (duration)) {
+    f = (1000000.0f * intervals) / duration;
+
+    // a signal that stopped cannot be faster than the time since the last pulse.
+    uint32_t idle = last().idle;
+    if ((idle) && (f * idle > 1000000.0f)) {
+      f = 1000000.0f / idle;
+    }
+  }
+  return (f);
+}  // frequency()
+
+
+float PulseCounter::period(int windows) {
+  float f = frequency(windows);
+  return (f > 0 ? (1000000.0f / f) : 0);
+}  // period()
+
+// End
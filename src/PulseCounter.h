@@ -0,0 +1,114 @@
+/**
+ * @file PulseCounter.h
+ *
+ * @brief The PulseCounter captures pulses on a digital input and provides windowed frequency
+ * and period statistics.
+ *
+ * On ESP32 the PCNT hardware counters are used when available. On other platforms and when no
+ * hardware unit is left an interrupt routine is used that also captures the timestamps of the
+ * pulses for precise period measurements at low frequencies.
+ *
+ * Any number of PulseCounter instances can be used at the same time.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+/// @brief Number of sampling windows kept for statistics.
+#define PULSECOUNTER_WINDOWS 4
+
+class PulseCounter {
+public:
+  /// @brief Statistics of a closed sampling window.
+  struct Window {
+    uint32_t count;      ///< pulses counted in the window.
+    uint32_t intervals;  ///< number of pulse intervals measured in duration.
+    uint32_t duration;   ///< duration of the measured intervals in µsec.
+    uint32_t idle;       ///< time in µsec from the last pulse to the end of the window.
+  };
+
+  ~PulseCounter();
+
+  /// @brief Start counting pulses on the given pin.
+  /// @param pin GPIO pin of the signal.
+  /// @param edge Edge to count: RISING, FALLING or CHANGE.
+  /// @param pullup Enable the internal pullup resistor.
+  /// @param hardware Use a hardware counter when available.
+  /// @return true when counting was started.
+  bool begin(int pin, int edge = FALLING, bool pullup = false, bool hardware = true);
+
+  /// @brief Stop counting and release interrupt or hardware counter.
+  void end();
+
+  /// @brief Discard the pulses of the current window and the window history.
+  void restart();
+
+  /// @brief Close the current window and make its statistics available.
+  void sample();
+
+  /// @brief Number of all pulses since begin().
+  uint32_t total();
+
+  /// @brief Number of pulses in the current (open) window.
+  uint32_t pending();
+
+  /// @brief Statistics of the last closed window.
+  const Window &last() {
+    return (_win[_winPos]);
+  }
+
+  /// @brief Frequency in Hz over the last closed windows.
+  /// @param windows Number of windows to include.
+  float frequency(int windows = 1);
+
+  /// @brief Period in µsec over the last closed windows or 0 when no pulse was detected.
+  /// @param windows Number of windows to include.
+  float period(int windows = 1);
+
+  /// @brief Return true when a hardware counter is used.
+  bool isHardware() {
+    return (_unit != nullptr);
+  }
+
+private:
+  int _pin = -1;
+
+  // ===== interrupt based counting
+
+  static void _onPulse(void *arg);
+
+  volatile uint32_t _cnt = 0;    // pulses in the current window
+  volatile uint32_t _total = 0;  // all pulses
+  volatile uint32_t _first = 0;  // timestamp of first pulse in current window
+  volatile uint32_t _last = 0;   // timestamp of last pulse in current window
+
+  // ===== hardware based counting
+
+  void *_unit = nullptr;     // hardware counter unit handle
+  void *_channel = nullptr;  // hardware counter channel handle
+  int _hwLast = 0;           // hardware count at end of the last window
+
+  // ===== window statistics
+
+  bool _hasRef = false;    // a reference pulse timestamp is available
+  uint32_t _ref = 0;       // timestamp of the last pulse of a previous window
+  uint32_t _winStart = 0;  // start timestamp of the current window
+
+  Window _win[PULSECOUNTER_WINDOWS];
+  int _winPos = 0;
+};
+
+// End
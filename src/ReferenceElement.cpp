@@ -118,4 +118,12 @@ void ReferenceElement::pushState(
 }  // pushState()
 
 
+bool ReferenceElement::getOutputs(std::function<void(const String &action)> callback) {
+  callback(_referenceAction);
+  callback(_highAction);
+  callback(_lowAction);
+  return (true);
+}  // getOutputs()
+
+
 // End
@@ -14,6 +14,7 @@
  * 
  * Changelog:
  * * 02.12.2021 created by Matthias Hertel
+ * * 18.10.2026 node in the dataflow graph.
  */
 
 #include <cfloat>
@@ -53,6 +54,12 @@ public:
   virtual void pushState(
       std::function<void(const char *pName, const char *eValue)> callback) override;
 
+  /**
+   * @brief report the actions sent with the result.
+   * @param callback callback function that is used for every action.
+   */
+  virtual bool getOutputs(std::function<void(const String &action)> callback) override;
+
 private:
   /** The actual incoming value. */
   float _incomingValue;
@@ -70,18 +77,18 @@ private:
   float _refValue = 0;
 
   /** These actions are sent with value=1 when the incoming value is above the reference value otherwise value=0. */
-  String _referenceAction;
+  HomeDing::Actions::ActionString _referenceAction;
 
   /** These actions are sent when the incoming value is above the reference value. */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /** These actions are sent when the incoming value is below or equal the reference value. */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 };
 
 
 #ifdef HOMEDING_REGISTER
 // Register the ReferenceElement onto the ElementRegistry.
 bool ReferenceElement::registered =
-    ElementRegistry::registerElement("reference", ReferenceElement::create);
+    ElementRegistry::registerElement("reference", ReferenceElement::create, sizeof(ReferenceElement));
 #endif
@@ -47,8 +47,21 @@ void RemoteElement::dispatchAction(String &targetId, String &name, String &value
   url.replace("$3", value);
 
   if (isActive()) {
-    LOGGER_ETRACE("queued <%s>", url.c_str());
-    _queue.push(url);
+    uint16_t last = _queue.size();
+    String prefix = url.substring(0, url.indexOf('?') + 1);
+
+    if ((last > 0) && (_queue.at(last - 1).startsWith(prefix))) {
+      // add as a further argument to the last queued request for the same element.
+      String batch = _queue.at(last - 1);
+      batch.concat('&');
+      batch.concat(url.c_str() + prefix.length());
+      LOGGER_ETRACE("batched <%s>", batch.c_str());
+      _queue.setAt(last - 1, batch);
+
+    } else {
+      LOGGER_ETRACE("queued <%s>", url.c_str());
+      _queue.push(url);
+    }
 
   } else {
     TRACE("get %s", url.c_str());
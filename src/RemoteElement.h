@@ -18,6 +18,7 @@
  * * 17.03.2019 splitting connect into getHostByName and connect by IP.
  * * 05.01.2020 using HttpClientElement
  * * 27.06.2023 queueing events to the same remote
+ * * 18.10.2026 queued actions to the same element are sent in one request.
  */
 
 #include <HttpClientElement.h>
@@ -51,12 +52,12 @@ public:
   void dispatchAction(String &targetId, String &name, String &value);
 
 private:
-  /// @brief queued actions
+  /// @brief queued requests, actions to the same element are combined into one request.
   ArrayString _queue;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the RemoteElement in the ElementRegistry.
 bool RemoteElement::registered =
-  ElementRegistry::registerElement("remote", RemoteElement::create);
+  ElementRegistry::registerElement("remote", RemoteElement::create, sizeof(RemoteElement));
 #endif
@@ -94,12 +94,12 @@ private:
    * @brief The _valueAction holds the actions that are submitted when the
    * rotary was changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 
 #ifdef HOMEDING_REGISTER
 // Register the RotaryElement onto the ElementRegistry.
 bool RotaryElement::registered =
-    ElementRegistry::registerElement("rotary", RotaryElement::create);
+    ElementRegistry::registerElement("rotary", RotaryElement::create, sizeof(RotaryElement));
 #endif
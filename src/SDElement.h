@@ -63,5 +63,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the SDElement in the ElementRegistry.
 bool SDElement::registered =
-  ElementRegistry::registerElement("sd", SDElement::create);
+  ElementRegistry::registerElement("sd", SDElement::create, sizeof(SDElement));
 #endif
@@ -72,7 +72,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the SDMMCElement in the ElementRegistry.
 bool SDMMCElement::registered =
-  ElementRegistry::registerElement("sdmmc", SDMMCElement::create);
+  ElementRegistry::registerElement("sdmmc", SDMMCElement::create, sizeof(SDMMCElement));
  #endif
 
 #endif
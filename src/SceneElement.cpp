@@ -18,6 +18,9 @@
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
 
+std::vector<SceneElement *> SceneElement::_scenes;
+
+
 /* ===== Static factory function ===== */
 
 /**
@@ -34,8 +37,11 @@ Element *SceneElement::create() {
 SceneElement::SceneElement() {
   // adjust startupMode when Network (default) is not applicable.
   // startupMode = Element::STARTUPMODE::System;
-  _delay = 100;       // fast stepping to the next action.
-  _currentStep = -1;  // no current step
+  category = CATEGORY::Standard;  // woken up by the board deadlines
+  _delay = 100;                   // fast stepping to the next action.
+  for (int t = 0; t < SCENE_MAX_TRACKS; t++) {
+    _tracks[t] = { -1, 0, false };
+  }
 }
 
 
@@ -45,39 +51,82 @@ SceneElement::SceneElement() {
 bool SceneElement::set(const char *name, const char *value) {
   TRACE("set %s=%s", name, value);
   bool ret = true;
-  int size = _steps.size();
 
   if (name == HomeDing::Actions::Start) {
-    // start the scene at step[0]
-    _currentStep = 0;
-    _nextStepTime = 1;  // asap.
-
-  } else if (name == HomeDing::Actions::Next) {
-    // start next step in in scene
-    TRACE("_next cnt=%d, size=%d", _currentStep, size);
-    if (_currentStep < size) {
-      _currentStep++;
-      _nextStepTime = 1;  // asap.
+    bool blocked = false;
+    if (!_compiled) _compile();
+
+    for (SceneElement *s : _scenes) {
+      if ((s != this) && (s->_running) && (s->_priority > _priority)) {
+        TRACE("blocked by %s", s->id);
+        blocked = true;
+      }
+    }
+
+    if ((!blocked) && (_priority > 0)) {
+      // all other running scenes have the same or a lower priority.
+      for (SceneElement *s : _scenes) {
+        if ((s != this) && (s->_running)) {
+          TRACE("stop %s", s->id);
+          s->_stop();
+        }
+      }
     }
 
-  } else if (name == HomeDing::Actions::Prev) {
-    // start previous step in in scene
-    TRACE("_next cnt=%d, size=%d", _currentStep, size);
-    if (_currentStep > 0) {
-      _currentStep--;
-      _nextStepTime = 1;  // asap.
+    if (!blocked) {
+      // start the scene at the first step of every track
+      _running = true;
+      _startTracks(true);
+      _schedule();
+    }
+
+  } else if (name == HomeDing::Actions::Stop) {
+    _stop();
+
+  } else if ((name == HomeDing::Actions::Next) || (name == HomeDing::Actions::Prev)) {
+    // start next or previous step of the first track in scene
+    if (!_compiled) _compile();
+    SceneTrack &tr = _tracks[0];
+    TRACE("%s step=%d", name, tr.step);
+    int step = _nextStep(0, tr.step, (name == HomeDing::Actions::Next) ? 1 : -1);
+    if (step >= 0) {
+      tr.step = step;
+      tr.due = millis();  // asap.
+      tr.pending = true;
+      _running = true;
+      _schedule();
     }
 
   } else if (_stristartswith(name, "steps[")) {
-    size_t i;
+    size_t i = 0;
     String iName;
     _scanIndexParam(name, i, iName);
-    _steps.setAt(i, value);
+
+    if ((iName.isEmpty()) || (iName.equalsIgnoreCase("actions"))) {
+      _steps.setAt(i, value);
+
+    } else {
+      if (_stepConfig.size() <= i) {
+        _stepConfig.resize(i + 1);
+      }
+      if (iName.equalsIgnoreCase("delay")) {
+        _stepConfig[i].delay = _scanDuration(value);
+      } else if (iName.equalsIgnoreCase("track")) {
+        _stepConfig[i].track = _atoi(value, 0, SCENE_MAX_TRACKS - 1);
+      }
+    }
+    _compiled = false;
 
   } else if (_stricmp(name, "delay") == 0) {
     // delay between executing the steps
     _delay = _scanDuration(value);
 
+  } else if (_stricmp(name, "repeat") == 0) {
+    _repeat = _atob(value);
+
+  } else if (_stricmp(name, "priority") == 0) {
+    _priority = _atoi(value);
+
   } else {
     ret = Element::set(name, value);
   }  // if
@@ -87,33 +136,168 @@ bool SceneElement::set(const char *name, const char *value) {
 
 
 /**
- * @brief Give some processing time to the Element to check for next actions.
+ * @brief Activate the SceneElement.
+ */
+void SceneElement::start() {
+  Element::start();
+  _scenes.push_back(this);
+}  // start()
+
+
+/**
+ * @brief stop all activities and go inactive.
+ */
+void SceneElement::term() {
+  _stop();
+  for (auto it = _scenes.begin(); it != _scenes.end(); it++) {
+    if (*it == this) {
+      _scenes.erase(it);
+      break;
+    }
+  }
+  Element::term();
+}  // term()
+
+
+/**
+ * @brief Send the steps that are due.
  */
 void SceneElement::loop() {
-  if (_nextStepTime > 0) {
-    // some outgoing actions should be sent
+  if (_running) {
     unsigned long now = millis();  // current (relative) time in msecs.
 
-    if ((now >= _nextStepTime) && (HomeDing::Actions::queueIsEmpty())) {
-      if ((_currentStep >= 0) && (_currentStep < _steps.size())) {
-        String actions = _steps[_currentStep];
-        TRACE("send(%d):<%s>", _currentStep, actions.c_str());
-        HomeDing::Actions::push(actions);
-      }
-      _nextStepTime = 0;
-      if (_delay >= 0) {
-        // send next action after some time
-        _currentStep++;
-        if (_currentStep < (int)(_steps.size())) {
-          _nextStepTime = now + _delay;
+    for (int t = 0; t < SCENE_MAX_TRACKS; t++) {
+      SceneTrack &tr = _tracks[t];
+      if ((tr.pending) && ((long)(now - tr.due) >= 0)) {
+        TRACE("send(%d)", tr.step);
+        _sendStep(tr.step);
+
+        if (_delay < 0) {
+          // wait for next or prev
+          tr.pending = false;
+
         } else {
-          // end is reached -> deactivate
-          _currentStep = -1;
+          // send next step of the track after some time
+          tr.step = _nextStep(t, tr.step, 1);
+          tr.pending = (tr.step >= 0);
+          if (tr.pending) {
+            long d = _stepConfig[tr.step].delay;
+            tr.due = now + (d >= 0 ? d : _delay);
+          }
         }
       }
-    }
-  }  // if()
+    }  // for
+    _schedule();
+  }  // if
 }  // loop()
 
 
+/**
+ * @brief push the current value of all properties to the callback.
+ */
+void SceneElement::pushState(
+  std::function<void(const char *pName, const char *eValue)> callback) {
+  Element::pushState(callback);
+  callback("running", _running ? "1" : "0");
+  callback(HomeDing::Actions::Step, String(_tracks[0].step).c_str());
+}  // pushState()
+
+
+// ===== private functions =====
+
+/// @brief compile the actions of all steps.
+void SceneElement::_compile() {
+  size_t count = max((size_t)_steps.size(), _stepConfig.size());
+  _stepConfig.resize(count);
+
+  for (size_t n = 0; n < count; n++) {
+    _stepConfig[n].actions = _steps[n];
+  }
+  _compiled = true;
+}  // _compile()
+
+
+/// @brief find the next or previous step of a track.
+/// @return index of the step or -1 when there is no step.
+int SceneElement::_nextStep(int track, int step, int dir) {
+  int count = _stepConfig.size();
+
+  step += dir;
+  while ((step >= 0) && (step < count)) {
+    if (_stepConfig[step].track == track) {
+      return (step);
+    }
+    step += dir;
+  }
+  return (-1);
+}  // _nextStep()
+
+
+/// @brief set all tracks to their first step.
+void SceneElement::_startTracks(bool first) {
+  unsigned long now = millis();
+
+  for (int t = 0; t < SCENE_MAX_TRACKS; t++) {
+    SceneTrack &tr = _tracks[t];
+    tr.step = _nextStep(t, -1, 1);
+    tr.pending = (tr.step >= 0) && ((t == 0) || (_delay >= 0));
+    if (tr.pending) {
+      long d = _stepConfig[tr.step].delay;
+      tr.due = now + (d >= 0 ? d : (first || (_delay < 0)) ? 0 : _delay);
+    }
+  }
+}  // _startTracks()
+
+
+/// @brief send the actions of a step.
+void SceneElement::_sendStep(int step) {
+  HomeDing::Actions::push(_stepConfig[step].actions);
+}  // _sendStep()
+
+
+/// @brief wake up the element when the next step is due or stop the scene.
+void SceneElement::_schedule() {
+  for (int retry = 0; retry < 2; retry++) {
+    unsigned long now = millis();
+    bool pending = false;
+    long wait = 0;
+
+    for (int t = 0; t < SCENE_MAX_TRACKS; t++) {
+      SceneTrack &tr = _tracks[t];
+      if (tr.pending) {
+        long w = (long)(tr.due - now);
+        if (w < 0) w = 0;
+        if ((!pending) || (w < wait)) wait = w;
+        pending = true;
+      }
+    }
+
+    if (pending) {
+      _board->wakeAfter(this, wait);
+      return;
+
+    } else if (_delay < 0) {
+      // waiting for next or prev
+      return;
+
+    } else if ((!_repeat) || (retry > 0)) {
+      // end is reached -> deactivate
+      _running = false;
+      return;
+    }
+    _startTracks(false);
+  }  // for
+}  // _schedule()
+
+
+/// @brief stop the scene.
+void SceneElement::_stop() {
+  _running = false;
+  for (int t = 0; t < SCENE_MAX_TRACKS; t++) {
+    _tracks[t].step = -1;
+    _tracks[t].pending = false;
+  }
+}  // _stop()
+
+
 // End
@@ -6,17 +6,44 @@
  * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
  *
  * More information on https://www.mathertel.de/Arduino
- * 
+ *
  * Changelog:
  * * 05.07.2021 created by Matthias Hertel
  * * 19.01.2022 finalized including delay
+ * * 18.10.2026 compiled steps with delays and tracks, stop, repeat and priority.
+ * * 18.10.2026 scenes without a priority are stopped and blocked by scenes with a priority.
  */
 
 #pragma once
 
+/// @brief max. number of parallel tracks in a scene.
+#define SCENE_MAX_TRACKS 4
+
 /**
- * @brief 
+ * @brief
  * The scene element defines a series of actions executed by a single triggering action.
+ * @details
+@verbatim
+
+The steps are given as a list of actions or as objects with the properties:
+
+* actions -- the actions of the step.
+* delay -- the time to wait before the step. Default is the delay of the scene
+  and no delay for the first step.
+* track -- the track 0...3 of the step. The tracks of a scene run in parallel.
+
+The steps are compiled into actions and delays when the scene starts. The element is not
+looping but woken up by the board when the next step is due.
+
+A scene with "repeat" starts again after all tracks have finished.
+
+A scene with a "priority" > 0 stops all running scenes with the same or a lower priority when it
+starts, including the scenes without a priority. A scene is not started while a scene with a
+higher priority is running.
+
+With a delay < 0 the steps are not sent automatically but using the "next" and "prev" actions.
+
+@endverbatim
  */
 class SceneElement : public Element
 {
@@ -46,30 +73,79 @@ public:
    */
   virtual bool set(const char *name, const char *value) override;
 
+  /**
+   * @brief Activate the SceneElement.
+   */
+  virtual void start() override;
+
+  /**
+   * @brief stop all activities and go inactive.
+   */
+  virtual void term() override;
 
   /**
-   * @brief Give some processing time to the timer to check for next action.
+   * @brief Send the steps that are due.
    */
   virtual void loop() override;
 
+  /**
+   * @brief push the current value of all properties to the callback.
+   * @param callback callback function that is used for every property.
+   */
+  virtual void pushState(
+      std::function<void(const char *pName, const char *eValue)> callback) override;
+
 private:
-  /** current step activated. */
-  int _currentStep;
+  /// @brief A compiled step.
+  struct SceneStep {
+    HomeDing::Actions::ActionString actions;  // compiled actions
+    long delay = -1;    // delay before the step in msec, -1 for the default delay
+    uint8_t track = 0;  // track of the step
+  };
+
+  /// @brief The current step and the due time of a track.
+  struct SceneTrack {
+    int16_t step;       // the step to be sent next, -1 when the track has finished.
+    unsigned long due;  // time of the next step
+    bool pending;       // the step will be sent at the due time.
+  };
 
   /**
    * @brief The delay between executing the steps in msec
    */
   long _delay;
 
-  /**
-   * @brief The time for the next step.
-   */
-  unsigned long _nextStepTime;
+  /// @brief start the scene again after all tracks have finished.
+  bool _repeat = false;
+
+  /// @brief priority of the scene, 0: not stopping other scenes.
+  int _priority = 0;
+
+  /// @brief the scene is running.
+  bool _running = false;
 
   /**
    * @brief The _steps hold a list of actions.
    */
   ArrayString _steps;
+
+  /// @brief The configured delays and tracks of the steps.
+  std::vector<SceneStep> _stepConfig;
+
+  /// @brief The steps are compiled.
+  bool _compiled = false;
+
+  SceneTrack _tracks[SCENE_MAX_TRACKS];
+
+  /// @brief the started scenes for stopping by priority.
+  static std::vector<SceneElement *> _scenes;
+
+  void _compile();
+  int _nextStep(int track, int step, int dir);
+  void _startTracks(bool first);
+  void _sendStep(int step);
+  void _schedule();
+  void _stop();
 };
 
 /* ===== Register the Element ===== */
@@ -77,5 +153,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the SceneElement onto the ElementRegistry.
 bool SceneElement::registered =
-    ElementRegistry::registerElement("scene", SceneElement::create);
+    ElementRegistry::registerElement("scene", SceneElement::create, sizeof(SceneElement));
 #endif
@@ -74,10 +74,10 @@ private:
   ArrayString _values;
 
   /// @brief Action to be sent with key as a parameter
-  String _keyAction;
+  HomeDing::Actions::ActionString _keyAction;
 
   /// @brief Action to be sent with value as a parameter
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 /* ===== Register the Element ===== */
@@ -85,5 +85,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the SelectElement in the ElementRegistry.
 bool SelectElement::registered =
-  ElementRegistry::registerElement("select", SelectElement::create);
+  ElementRegistry::registerElement("select", SelectElement::create, sizeof(SelectElement));
 #endif
@@ -75,6 +75,6 @@ void StateElement::loop() {
 
 // Always Register the OTAElement in the ElementRegistry.
 bool StateElement::registered =
-  ElementRegistry::registerElement("state", StateElement::create);
+  ElementRegistry::registerElement("state", StateElement::create, sizeof(StateElement));
 
 // End
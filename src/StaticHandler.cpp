@@ -0,0 +1,251 @@
+/**
+ * @file StaticHandler.cpp
+ * @brief WebServer request handler for delivering static files from the file system.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see StaticHandler.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <StaticHandler.h>
+
+// use TRACE for compiling with detailed TRACE output.
+#define TRACE(...)  // LOGGER_JUSTINFO(__VA_ARGS__)
+
+// used for services
+#define API_ROUTE "/api/"
+
+// The size of the chunks written to the client.
+#if defined(ESP8266)
+#define STATIC_CHUNK_SIZE (2 * 1460)
+#elif defined(ESP32)
+#define STATIC_CHUNK_SIZE (4 * 1024)
+#endif
+
+// Limit the number of cached entries, the Web UI has about 40 files.
+#define STATIC_CACHE_MAX 64
+
+std::map<String, StaticHandler::FileInfo> StaticHandler::_cache;
+
+
+/**
+ * @brief Construct a new StaticHandler object
+ */
+StaticHandler::StaticHandler(Board *board, FS *fs, const char *cacheHeader) {
+  _board = board;
+  _fs = fs;
+  _useETag = (strcmp(cacheHeader, "etag") == 0);
+  if (!_useETag) {
+    _cacheHeader = cacheHeader;
+  }
+}
+
+
+/**
+ * @brief Verify if the method and requestUri may address a static file.
+ */
+#if defined(ESP8266)
+bool StaticHandler::canHandle(HTTPMethod requestMethod, const String &uri)
+
+#elif defined(ESP32)
+#if (ESP_ARDUINO_VERSION_MAJOR < 3)
+bool StaticHandler::canHandle(HTTPMethod requestMethod, String uri)
+#else
+bool StaticHandler::canHandle(WebServer &server, HTTPMethod requestMethod, const String &uri)
+#endif
+#endif
+{
+  TRACE("canhandle(%s)", uri.c_str());
+  return ((requestMethod == HTTP_GET) && (uri.startsWith("/")) && (!uri.startsWith(API_ROUTE)));
+}  // canHandle
+
+
+/**
+ * @brief Handle the request of a static file.
+ */
+bool StaticHandler::handle(WebServer &server, HTTPMethod /* requestMethod */, const String &requestUri) {
+  TRACE("handle(%s)", requestUri.c_str());
+  String path = requestUri;
+  FileInfo info;
+
+  if (path.endsWith("/")) {
+    path.concat("index.htm");
+  }
+
+  if (!_getInfo(path, info)) {
+    return (false);
+  }
+
+  if (info.etag) {
+    char eTag[12];
+    snprintf(eTag, sizeof(eTag), "\"%08x\"", info.etag);
+
+    if (server.header("If-None-Match") == eTag) {
+      TRACE("  not modified");
+      server.sendHeader("ETag", eTag);
+      server.send(304);
+      return (true);
+    }
+    server.sendHeader("ETag", eTag);
+
+  } else if (!_cacheHeader.isEmpty()) {
+    server.sendHeader("Cache-Control", _cacheHeader);
+  }
+
+  File f = _fs->open(info.gzip ? path + ".gz" : path, "r");
+  if (!f) {
+    // file was removed meanwhile
+    clearCache();
+    return (false);
+  }
+
+  if (info.gzip) {
+    server.sendHeader("Content-Encoding", "gzip");
+  }
+
+  size_t size = f.size();
+  size_t start = 0;
+  bool partial = false;
+  String range = server.header("Range");
+
+  if ((!info.gzip) && (range.startsWith("bytes="))) {
+    // single range "bytes=start-" or "bytes=-length", the end is ignored.
+    long n = range.substring(6).toInt();
+    start = (n < 0) ? ((size_t)-n < size ? size + n : 0) : (size_t)n;
+
+    if (start >= size) {
+      f.close();
+      server.sendHeader("Content-Range", "bytes */" + String(size));
+      server.send(416);
+      return (true);
+    }
+    f.seek(start);
+    partial = true;
+    server.sendHeader("Content-Range", "bytes " + String(start) + "-" + String(size - 1) + "/" + String(size));
+  }
+
+  server.setContentLength(size - start);
+  server.send(partial ? 206 : 200, _contentType(path), "");
+  _stream(server, f);
+  f.close();
+  return (true);
+}  // handle()
+
+
+/** Forget all cached file information. */
+void StaticHandler::clearCache() {
+  _cache.clear();
+}  // clearCache()
+
+
+// find the information of the file in the cache or in the file system.
+bool StaticHandler::_getInfo(const String &path, FileInfo &info) {
+  auto it = _cache.find(path);
+  if (it != _cache.end()) {
+    info = it->second;
+    return (true);
+  }
+
+  // files with logs and data change without uploading
+  bool isData = (path.endsWith(".txt") || path.endsWith(".csv"));
+
+  info.gzip = false;
+  File f;
+  if (!path.endsWith(".gz")) {
+    f = _fs->open(path + ".gz", "r");
+    info.gzip = (bool)f;
+  }
+  if (!f) {
+    f = _fs->open(path, "r");
+  }
+  if ((!f) || f.isDirectory()) {
+    return (false);
+  }
+
+  info.etag = 0;
+  if ((_useETag) && (!isData)) {
+    // use modification timestamp and size to create a strong ETag
+    info.etag = (uint32_t)f.getLastWrite() ^ ((uint32_t)f.size() * 2654435761u);
+    if (!info.etag) info.etag = 1;
+  }
+  f.close();
+
+  if (!isData) {
+    if (_cache.size() >= STATIC_CACHE_MAX) {
+      _cache.clear();
+    }
+    _cache[path] = info;
+  }
+  return (true);
+}  // _getInfo()
+
+
+// stream the file content using large chunks.
+void StaticHandler::_stream(WebServer &server, File &f) {
+  uint8_t *buffer = (uint8_t *)malloc(STATIC_CHUNK_SIZE);
+
+  if (!buffer) {
+    // low memory, let the server do it.
+    server.client().write(f);
+
+  } else {
+    size_t len;
+    while ((len = f.read(buffer, STATIC_CHUNK_SIZE)) > 0) {
+      if (server.client().write(buffer, len) != len) {
+        break;  // client disconnected
+      }
+      hd_yield();
+    }
+    free(buffer);
+  }
+}  // _stream()
+
+
+// content type of the file by the extension.
+const char *StaticHandler::_contentType(const String &path) {
+  const char *type = "application/octet-stream";
+
+  if (path.endsWith(".gz")) {
+    // content type of a requested gz file
+    type = "application/x-gzip";
+  } else if (path.endsWith(".htm") || path.endsWith(".html")) {
+    type = "text/html";
+  } else if (path.endsWith(".css")) {
+    type = "text/css";
+  } else if (path.endsWith(".js")) {
+    type = "application/javascript";
+  } else if (path.endsWith(".json")) {
+    type = "application/json";
+  } else if (path.endsWith(".svg")) {
+    type = "image/svg+xml";
+  } else if (path.endsWith(".png")) {
+    type = "image/png";
+  } else if (path.endsWith(".jpg") || path.endsWith(".jpeg")) {
+    type = "image/jpeg";
+  } else if (path.endsWith(".gif")) {
+    type = "image/gif";
+  } else if (path.endsWith(".ico")) {
+    type = "image/x-icon";
+  } else if (path.endsWith(".txt") || path.endsWith(".csv")) {
+    type = "text/plain";
+  } else if (path.endsWith(".xml")) {
+    type = "text/xml";
+  } else if (path.endsWith(".woff2")) {
+    type = "font/woff2";
+  } else if (path.endsWith(".mp3")) {
+    type = "audio/mpeg";
+  }
+  return (type);
+}  // _contentType()
+
+// End.
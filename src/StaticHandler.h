@@ -0,0 +1,111 @@
+/**
+ * @file StaticHandler.h
+ * @brief WebServer request handler for delivering static files from the file system.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created, replacing serveStatic in the board.
+ * * 18.10.2026 Range requests on data files to read the tail of a log.
+ *
+ * @details
+@verbatim
+The StaticHandler delivers the files of the root file system like serveStatic but
+  * prefers a precompressed `<file>.gz` sibling and sends it with Content-Encoding gzip.
+  * caches the ETag of each delivered file in memory so `If-None-Match` requests
+    are answered with 304 without opening the file.
+  * streams the file content using large chunks directly to the client.
+  * supports a single byte range on uncompressed files like `bytes=1200-` or `bytes=-500`
+    to read the new part of a log file.
+
+The cache is cleared by the FileServerHandler when files are uploaded or deleted.
+@endverbatim
+ */
+
+#pragma once
+
+#include <map>
+
+/**
+ * @brief The StaticHandler is a class that implements the RequestHandler interface.
+ */
+class StaticHandler : public RequestHandler {
+public:
+  /**
+   * @brief Construct a new StaticHandler object
+   * @param board reference to the board.
+   * @param fs file system with the static files.
+   * @param cacheHeader Cache-Control header to be used or "etag" for using ETags.
+   */
+  StaticHandler(Board *board, FS *fs, const char *cacheHeader);
+
+  /**
+   * @brief Verify if the method and uri can be handles by this module.
+   * @param requestMethod current http request method.
+   * @param uri current url of the request.
+   * @return true When the method and uri may address a static file.
+   */
+#if defined(ESP8266)
+  bool canHandle(HTTPMethod requestMethod, const String &uri) override;
+#elif defined(ESP32)
+
+#if (ESP_ARDUINO_VERSION_MAJOR < 3)
+  bool canHandle(HTTPMethod requestMethod, String uri) override;
+#else
+  bool canHandle(WebServer &server, HTTPMethod requestMethod, const String &uri) override;
+#endif
+
+#endif
+
+  /**
+   * @brief Handle the request of a static file.
+   * @param server reference to the server.
+   * @param requestMethod current http request method.
+   * @param requestUri current url of the request.
+   * @return true When the file was found and delivered.
+   */
+  bool handle(WebServer &server, HTTPMethod requestMethod, const String &requestUri) override;
+
+  /**
+   * @brief Forget all cached file information, required when files are changed.
+   */
+  static void clearCache();
+
+private:
+  /// @brief cached information of a static file.
+  struct FileInfo {
+    bool gzip;      ///< the .gz sibling is delivered.
+    uint32_t etag;  ///< strong ETag value or 0 when no ETag is used.
+  };
+
+  /// @brief find the information of the file in the cache or in the file system.
+  bool _getInfo(const String &path, FileInfo &info);
+
+  /// @brief stream the file content using large chunks.
+  void _stream(WebServer &server, File &f);
+
+  /// @brief content type of the file by the extension.
+  static const char *_contentType(const String &path);
+
+  /// @brief reference to the board.
+  Board *_board;
+
+  /// @brief file system with the static files.
+  FS *_fs;
+
+  /// @brief the Cache-Control header value.
+  String _cacheHeader;
+
+  /// @brief use ETags.
+  bool _useETag;
+
+  /// @brief cached file information by path.
+  static std::map<String, FileInfo> _cache;
+};
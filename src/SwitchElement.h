@@ -65,17 +65,17 @@ private:
    * @brief The _highAction is emitted when the logical output level is going from
    * LOW to HIGH.
    */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /**
    * @brief The _lowAction is emitted when the logical output level is going from
    * HIGH to LOW.
    */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the SwitchElement onto the ElementRegistry.
 bool SwitchElement::registered =
-    ElementRegistry::registerElement("switch", SwitchElement::create);
+    ElementRegistry::registerElement("switch", SwitchElement::create, sizeof(SwitchElement));
 #endif
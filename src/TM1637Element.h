@@ -102,5 +102,5 @@ private:
 
 // Register the TM1637Element onto the ElementRegistry.
 bool TM1637Element::registered =
-  ElementRegistry::registerElement("tm1637", TM1637Element::create);
+  ElementRegistry::registerElement("tm1637", TM1637Element::create, sizeof(TM1637Element));
 #endif
@@ -76,19 +76,19 @@ private:
    * @brief The _highAction is emitted when the logical input level is going
    * from LOW to HIGH.
    */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /**
    * @brief The _lowAction is emitted when the logical input level is going from
    * HIGH to LOW.
    */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 
   /**
    * @brief The _valueAction is emitted every time the logical input level
    * changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 #if defined(HOMEDING_REGISTER)
@@ -96,7 +96,7 @@ private:
 #if defined(ESP32)
 // Register the TouchElement onto the ElementRegistry.
 bool TouchElement::registered =
-  ElementRegistry::registerElement("touch", TouchElement::create);
+  ElementRegistry::registerElement("touch", TouchElement::create, sizeof(TouchElement));
 
 #elif defined(ESP8266)
 #warning Touch Element Input is not supported on ESP8266 processors  
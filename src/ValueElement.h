@@ -80,7 +80,7 @@ protected:
   /**
    * @brief The _valueAction holds the actions that is submitted when the value has changed.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   virtual bool _setValue(int val, bool forceAction = false);
   virtual bool _setValue(const char *val, bool forceAction = false);
@@ -104,5 +104,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the ValueElement in the ElementRegistry.
 bool ValueElement::registered =
-    ElementRegistry::registerElement("value", ValueElement::create);
+    ElementRegistry::registerElement("value", ValueElement::create, sizeof(ValueElement));
 #endif
@@ -91,6 +91,6 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the RemoteElement in the ElementRegistry.
 bool WeatherFeedElement::registered =
-    ElementRegistry::registerElement("weatherfeed", WeatherFeedElement::create);
+    ElementRegistry::registerElement("weatherfeed", WeatherFeedElement::create, sizeof(WeatherFeedElement));
 
 #endif
@@ -98,7 +98,7 @@ private:
  #ifdef HOMEDING_REGISTER
 // Register the ToneElement onto the ElementRegistry.
 bool ToneElement::registered =
-  ElementRegistry::registerElement("tone", ToneElement::create);
+  ElementRegistry::registerElement("tone", ToneElement::create, sizeof(ToneElement));
 #endif
 
 #endif
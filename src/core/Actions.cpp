@@ -23,11 +23,15 @@
 #include <core/Actions.h>
 #include <HomeDing.h>
 
+#include <algorithm>
 #include <set>
+#include <vector>
 
 #include <ListUtils.h>
 #include <ArrayString.h>
 
+#include <core/Dataflow.h>
+
 namespace HomeDing::Actions {
 
 // this list must have all actions names.
@@ -129,11 +133,266 @@ const char *X             = find("x");
 const char *Y             = find("y");
 // clang-format on
 
+// ===== Compiled action templates =====
+
+/// @brief one action of a compiled template.
+struct ActionStep {
+  const char *target;  ///< lowercase "type/id" or the full text of a step that is dispatched as text.
+  Element *element;    ///< the resolved target element.
+  const char *name;    ///< interned property name, nullptr for text steps.
+  const char *prefix;  ///< the value or the part before $v.
+  const char *suffix;  ///< the part after $v or nullptr when the value has no $v.
+  int16_t node;        ///< index of the target in the dataflow graph, -1: no node, -2: unknown.
+};
+
+/// @brief a compiled template with one or more steps.
+struct ActionTemplate {
+  uint32_t hash;
+  const char *text;  ///< the original text of the template.
+  uint16_t refs;     ///< number of users including queued actions.
+  uint8_t count;
+  ActionStep steps[];
+};
+
+/// @brief all compiled templates.
+static std::vector<ActionTemplate *> _templates;
+
+
+// FNV-1a hash of the template text.
+static uint32_t _hash(const char *s) {
+  uint32_t h = 2166136261UL;
+  while (*s) {
+    h = (h ^ (uint8_t)*s++) * 16777619UL;
+  }
+  return (h);
+}  // _hash()
+
+
+// return the interned version of a known property name or the name itself.
+// Other names are not added to the set, they stay in the buffer of the template.
+static const char *_internName(char *name) {
+  const char *n = find(name);
+  return (n ? n : name);
+}  // _internName()
+
+
+/// @brief Compile a template into steps or find the already compiled one.
+/// @return compiled template with one more reference or nullptr when out of memory.
+static ActionTemplate *_compile(const char *text) {
+  uint32_t h = _hash(text);
+
+  for (ActionTemplate *t : _templates) {
+    if ((t->hash == h) && (strcmp(t->text, text) == 0)) {
+      t->refs++;
+      return (t);
+    }
+  }
+
+  // allocate the template, the steps and a copy of the text that is split in place.
+  int count = ListUtils::length(text);
+  size_t len = strlen(text) + 1;
+  size_t size = sizeof(ActionTemplate) + count * sizeof(ActionStep);
+  ActionTemplate *t = (ActionTemplate *)malloc(size + 2 * len);
+  if (!t) {
+    LOGGER_ERR("actions: no memory to compile %s", text);
+    return (nullptr);
+  }
+
+  char *orig = (char *)t + size;
+  char *buf = orig + len;
+  memcpy(orig, text, len);
+  memcpy(buf, text, len);
+  t->hash = h;
+  t->text = orig;
+  t->refs = 1;
+  t->count = 0;
+
+  char *part = buf;
+  while (part) {
+    char *next = strchr(part, LIST_SEPARATOR);
+    if (next) *next++ = '\0';
+
+    if (*part) {
+      ActionStep *s = &t->steps[t->count++];
+      char *param = strchr(part, ELEM_PARAMETER);
+      char *host = strchr(part, ':');
+      char *value = param ? strchr(param, ELEM_VALUE) : nullptr;
+      char *slot = strstr(part, "$v");
+
+      s->target = part;
+      s->element = nullptr;
+      s->name = nullptr;
+      s->prefix = nullptr;
+      s->suffix = nullptr;
+      s->node = -2;
+
+      // steps with a remote host, $v outside the value or multiple $v are dispatched as text.
+      if ((param) && ((!host) || (host > param))
+          && ((!slot) || ((value) && (slot > value) && (!strstr(slot + 2, "$v"))))) {
+        *param++ = '\0';
+        strlwr(part);
+
+        if (value) *value++ = '\0';
+        strlwr(param);
+        s->name = _internName(param);
+        s->prefix = value ? value : "";
+
+        if (slot) {
+          *slot = '\0';
+          s->suffix = slot + 2;
+        }
+      }
+    }
+    part = next;
+  }
+
+  _templates.push_back(t);
+  return (t);
+}  // _compile()
+
+
+void release(ActionTemplate *t) {
+  if ((t) && (--t->refs == 0)) {
+    auto it = std::find(_templates.begin(), _templates.end(), t);
+    if (it != _templates.end()) {
+      *it = _templates.back();
+      _templates.pop_back();
+    }
+    free(t);
+  }
+}  // release()
+
+
+// ===== ActionString =====
+
+ActionString::ActionString(const ActionString &other)
+    : _text(other._text), _compiled(other._compiled) {
+  if (_compiled) _compiled->refs++;
+}
+
+
+ActionString::~ActionString() {
+  release(_compiled);
+}
+
+
+ActionString &ActionString::operator=(const ActionString &other) {
+  if (this != &other) {
+    if (other._compiled) other._compiled->refs++;
+    release(_compiled);
+    _text = other._text;
+    _compiled = other._compiled;
+  }
+  return (*this);
+}
+
+
+ActionString &ActionString::operator=(const String &action) {
+  ActionTemplate *old = _compiled;
+  _text = action;
+  _compiled = compile(_text);
+  release(old);
+  return (*this);
+}
+
+
+ActionString &ActionString::operator=(const char *action) {
+  ActionTemplate *old = _compiled;
+  _text = action;
+  _compiled = compile(_text);
+  release(old);
+  return (*this);
+}
+
+
 // ===== Queue =====
-ArrayString actions;
+
+/// @brief a queued action that is a resolved step with the value or a text action.
+/// The template of the step is kept while the action is queued.
+struct QueueItem {
+  QueueItem *next;
+  ActionTemplate *t;
+  ActionStep *step;
+  char text[];
+};
+
+static QueueItem *_first = nullptr;
+static QueueItem *_last = nullptr;
+
+
+// add an item with the concatenated text parts to the queue.
+static void _enqueue(ActionTemplate *t, ActionStep *step, const char *t1, const char *t2 = nullptr, const char *t3 = nullptr) {
+  size_t l1 = strlen(t1);
+  size_t l2 = t2 ? strlen(t2) : 0;
+  size_t l3 = t3 ? strlen(t3) : 0;
+
+  QueueItem *item = (QueueItem *)malloc(sizeof(QueueItem) + l1 + l2 + l3 + 1);
+  if (item) {
+    item->next = nullptr;
+    item->t = t;
+    item->step = step;
+    if (t) t->refs++;
+    memcpy(item->text, t1, l1);
+    if (l2) memcpy(item->text + l1, t2, l2);
+    if (l3) memcpy(item->text + l1 + l2, t3, l3);
+    item->text[l1 + l2 + l3] = '\0';
+
+    if (_last) {
+      _last->next = item;
+    } else {
+      _first = item;
+    }
+    _last = item;
+  }
+}  // _enqueue()
+
+
+// add a text action to the queue, optionally split into multiple actions.
+static void _pushText(String &tmp, bool split) {
+  if (split) {
+    int len = ListUtils::length(tmp);
+    for (int n = 0; n < len; n++) {
+      _enqueue(nullptr, nullptr, ListUtils::at(tmp, n).c_str());
+    }
+  } else {
+    _enqueue(nullptr, nullptr, tmp.c_str());
+  }
+}  // _pushText()
+
+
+// return the index of the target in the dataflow graph or -1.
+static int _nodeOf(ActionStep *s) {
+  if (!Dataflow::isActive()) {
+    return (-1);
+  }
+  if (s->node == -2) {
+    s->node = Dataflow::indexOf(s->target);
+  }
+  return (s->node);
+}  // _nodeOf()
+
+
+// set the value directly when the graph is evaluated and the target is a node of the graph.
+// Actions to nodes from other elements are queued to keep the order of the actions.
+static bool _setNode(ActionStep *s, const char *value) {
+  if ((!Dataflow::isEvaluating()) || (_nodeOf(s) < 0)) {
+    return (false);
+  }
+
+  if (s->suffix) {
+    String v = s->prefix;
+    v.concat(value ? value : "$v");
+    v.concat(s->suffix);
+    Dataflow::set(s->node, s->name, v.c_str());
+  } else {
+    Dataflow::set(s->node, s->name, s->prefix);
+  }
+  return (true);
+}  // _setNode()
+
 
 bool queueIsEmpty() {
-  return (actions.empty());
+  return (!_first);
 }
 
 
@@ -157,24 +416,70 @@ void push(const String &action, const String &value, bool split) {
 /** Queue an action for later dispatching. */
 void push(const String &action, const char *value, bool split) {
   if (!action.isEmpty()) {
+    // #if defined(LOGGER_ENABLED)
+    //     if (Logger::logger_level >= LOGGER_LEVEL_TRACE) {
+    //       Logger::printf("#action (%s)=>%s", (_activeElement ? _activeElement->id : ""), action.c_str());
+    //     }
+    // #endif
+
+    // actions created at runtime are queued as text and not compiled.
     String tmp = action;
     if (value) {
       tmp.replace("$v", value);
     }
+    _pushText(tmp, split);
+  }
+}  // push
 
-    // #if defined(LOGGER_ENABLED)
-    //     if (Logger::logger_level >= LOGGER_LEVEL_TRACE) {
-    //       Logger::printf("#action (%s)=>%s", (_activeElement ? _activeElement->id : ""), tmp.c_str());
-    //     }
-    // #endif
 
-    if (split) {
-      int len = ListUtils::length(tmp);
-      for (int n = 0; n < len; n++) {
-        actions.push(ListUtils::at(tmp, n).c_str());
-      }
+/** Queue the actions of a configured action template. */
+void push(const ActionString &action, const char *value) {
+  if (action.compiled()) {
+    push(action.compiled(), value);
+  } else {
+    push((const String &)action, value);
+  }
+}  // push
+
+
+void push(const ActionString &action, int value) {
+  if (!action.isEmpty()) {
+    char _convertBuffer[16];
+    itoa(value, _convertBuffer, 10);
+    push(action, _convertBuffer);
+  }
+}  // push
+
+
+void push(const ActionString &action, const String &value) {
+  if (!action.isEmpty()) {
+    push(action, value.c_str());
+  }
+}  // push
+
+
+ActionTemplate *compile(const String &action) {
+  return (action.isEmpty() ? nullptr : _compile(action.c_str()));
+}  // compile()
+
+
+/** Queue the actions of a compiled template. */
+void push(ActionTemplate *t, const char *value) {
+  for (int n = 0; n < t->count; n++) {
+    ActionStep *s = &t->steps[n];
+    if (!s->name) {
+      String tmp = s->target;
+      if (value) tmp.replace("$v", value);
+      _pushText(tmp, true);
+
+    } else if (_setNode(s, value)) {
+      // evaluated by the dataflow graph.
+
+    } else if (s->suffix) {
+      _enqueue(t, s, s->prefix, value ? value : "$v", s->suffix);
+
     } else {
-      actions.push(tmp);
+      _enqueue(t, s, s->prefix);
     }
   }
 }  // push
@@ -191,9 +496,65 @@ void pushItem(const String &action, const String &values, int n) {
 }  // pushItem
 
 
-String pop() {
-  return actions.pop();
-};
+void pushItem(const ActionString &action, const String &values, int n) {
+  if ((action) && (values)) {
+    String v = Element::getItemValue(values, n);
+    if (v) {
+      push(action, v.c_str());
+    }
+  }  // if
+}  // pushItem
+
+
+void dispatchNext(Board *board) {
+  QueueItem *item = _first;
+
+  if (item) {
+    _first = item->next;
+    if (!_first) _last = nullptr;
+
+    ActionStep *s = item->step;
+    int node = s ? _nodeOf(s) : -1;
+    if (node >= 0) {
+      // set the value and evaluate the dataflow graph.
+      Dataflow::set(node, s->name, item->text);
+
+    } else if (s) {
+      if (!s->element) {
+        s->element = board->findById(s->target);
+      }
+      if (s->element) {
+        board->dispatchAction(s->element, s->name, item->text);
+      } else {
+        LOGGER_ERR("dispatch: %s not found", s->target);
+      }
+    } else {
+      board->dispatchAction(String(item->text));
+    }
+    release(item->t);
+    free(item);
+  }
+}  // dispatchNext()
+
+
+void forEachTarget(Board *board, const String &action, std::function<void(Element *)> callback) {
+  ActionTemplate *t = action.isEmpty() ? nullptr : _compile(action.c_str());
+
+  if (t) {
+    for (int n = 0; n < t->count; n++) {
+      ActionStep *s = &t->steps[n];
+      if (s->name) {
+        if (!s->element) {
+          s->element = board->findById(s->target);
+        }
+        if (s->element) {
+          callback(s->element);
+        }
+      }
+    }
+    release(t);
+  }
+}  // forEachTarget()
 
 
 }
@@ -20,16 +20,84 @@
  * * 22.03.2024 created by Matthias Hertel
  * * 10.07.2024 using std:set for fast finding
  * * 07.10.2024 queue of actions and dispatch functions 
+ * * 18.10.2026 action templates are compiled once and shared, the queue holds the resolved actions.
+ * * 18.10.2026 actions to nodes of the dataflow graph are set directly.
+ * * 18.10.2026 actions to nodes of the dataflow graph are queued, only actions between nodes are set directly.
+ * * 18.10.2026 compile() and push() of a compiled template for repeated actions.
+ * * 18.10.2026 only configured templates in ActionString are compiled, other actions are queued as text.
+ * * 18.10.2026 compiled templates are reference counted and freed, ActionString only changes by assignment.
 */
 
 #pragma once
 
 #include <Arduino.h>
+#include <functional>
 
 #include <core/Logger.h>
 
+class Board;
+class Element;
+
 namespace HomeDing::Actions {
 
+/// @brief a compiled action template.
+struct ActionTemplate;
+
+/// @brief Compile an action template once for pushing it many times.
+/// Templates with the same text are shared, every compile() must be paired with a release().
+/// @param action the action template.
+/// @return the compiled template or nullptr when the template cannot be compiled.
+ActionTemplate *compile(const String &action);
+
+/// @brief Release a compiled template, it is freed when it is not used any more.
+/// @param t the compiled template or nullptr.
+void release(ActionTemplate *t);
+
+/// @brief An action template from the configuration of an element.
+/// The template is compiled when it is assigned in set(),
+/// so pushing it needs no lookup in the table of compiled templates.
+/// The text can only be changed by an assignment that compiles it again.
+class ActionString {
+public:
+  ActionString() {}
+  ActionString(const ActionString &other);
+  ~ActionString();
+
+  ActionString &operator=(const ActionString &other);
+  ActionString &operator=(const String &action);
+  ActionString &operator=(const char *action);
+
+  /// @brief the text of the action template.
+  operator const String &() const {
+    return (_text);
+  }
+
+  const char *c_str() const {
+    return (_text.c_str());
+  }
+
+  unsigned int length() const {
+    return (_text.length());
+  }
+
+  bool isEmpty() const {
+    return (_text.isEmpty());
+  }
+
+  explicit operator bool() const {
+    return (!_text.isEmpty());
+  }
+
+  /// @brief the compiled template or nullptr when not compiled.
+  ActionTemplate *compiled() const {
+    return (_compiled);
+  }
+
+private:
+  String _text;
+  ActionTemplate *_compiled = nullptr;
+};
+
 bool _setup();
 
 // find the action name in the Action collection or return null.
@@ -82,11 +150,10 @@ extern const char *Y;
 bool queueIsEmpty();
 
 
-/** Queue an action for later dispatching. */
-  /// @brief Queue an action for later dispatching.
-  /// @param action action or property.
-  /// @param value the value
-  /// @param split
+/// @brief Queue an action for later dispatching as text.
+/// @param action action or property.
+/// @param value the value
+/// @param split true to split a list of actions into multiple actions.
 void push(const String &action, const char *value = nullptr, bool split = true);
 
 /** Queue an action for later dispatching. Integer value version. */
@@ -98,9 +165,33 @@ void push(const String &action, const String &value, bool split = true);
 /** Queue an action with a value from an item in a string baseds value list. */
 void pushItem(const String &action, const String &values, int n);
 
+/// @brief Queue the actions of a compiled template.
+/// @param t the compiled template.
+/// @param value the value or nullptr.
+void push(ActionTemplate *t, const char *value = nullptr);
+
+/// @brief Queue the actions of a configured action template using the compiled form when available.
+void push(const ActionString &action, const char *value = nullptr);
+
+/** Queue the actions of a configured action template. Integer value version. */
+void push(const ActionString &action, int value);
+
+/** Queue the actions of a configured action template. String value version. */
+void push(const ActionString &action, const String &value);
+
+/** Queue a configured action template with a value from an item in a string baseds value list. */
+void pushItem(const ActionString &action, const String &values, int n);
+
+
+/// @brief Dispatch the next action from the queue.
+/// @param board the board with the elements.
+void dispatchNext(Board *board);
+
 
-/// @brief get next action off the list.
-/// @return next action.
-String pop();
+/// @brief Find the target elements of the actions in an action template.
+/// @param board the board with the elements.
+/// @param action the action template.
+/// @param callback callback function that is used for every found target element.
+void forEachTarget(Board *board, const String &action, std::function<void(Element *)> callback);
 
 }
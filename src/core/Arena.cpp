@@ -0,0 +1,130 @@
+/**
+ * @file Arena.cpp
+ *
+ * @brief The Arena collects the Elements and their configuration strings that are created
+ * during the startup of the board in a few larger memory chunks.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see Arena.h
+ */
+
+#include <Arduino.h>
+
+#include <core/Arena.h>
+
+#define TRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
+
+namespace HomeDing::Arena {
+
+/// @brief a chunk of memory, the data follows the header.
+struct Chunk {
+  Chunk *next;
+  uint16_t size;
+  uint16_t used;
+};
+
+static Chunk *_first = nullptr;
+static Chunk *_last = nullptr;
+static bool _open = false;
+
+size_t size = 0;
+size_t used = 0;
+
+
+void open() {
+  _open = (HD_ARENA_CHUNK > 0);
+}  // open()
+
+
+void close() {
+  TRACE("arena: %d/%d", used, size);
+  _open = false;
+}  // close()
+
+
+void *alloc(size_t len, size_t align) {
+  void *p = nullptr;
+
+  if ((_open) && (len > 0) && (len <= HD_ARENA_CHUNK / 2)) {
+    uint16_t pos = _last ? ((_last->used + align - 1) & ~(align - 1)) : 0;
+
+    if ((!_last) || (pos + len > _last->size)) {
+      // start a new chunk, the rest of the last chunk stays unused.
+      Chunk *c = (Chunk *)malloc(sizeof(Chunk) + HD_ARENA_CHUNK);
+      if (c) {
+        c->next = nullptr;
+        c->size = HD_ARENA_CHUNK;
+        c->used = 0;
+        if (_last) {
+          _last->next = c;
+        } else {
+          _first = c;
+        }
+        _last = c;
+        size += HD_ARENA_CHUNK;
+        pos = 0;
+      }
+    }
+
+    if ((_last) && (pos + len <= _last->size)) {
+      p = (uint8_t *)(_last + 1) + pos;
+      used += (pos - _last->used) + len;
+      _last->used = pos + len;
+    }
+  }
+  return (p);
+}  // alloc()
+
+
+bool contains(const void *p) {
+  for (Chunk *c = _first; c; c = c->next) {
+    const uint8_t *data = (const uint8_t *)(c + 1);
+    if ((p >= data) && (p < data + c->size)) {
+      return (true);
+    }
+  }
+  return (false);
+}  // contains()
+
+
+char *strndup(const char *s, size_t len) {
+  char *p = (char *)alloc(len + 1, 1);
+  if (!p) {
+    p = (char *)malloc(len + 1);
+  }
+  if (p) {
+    memcpy(p, s, len);
+    p[len] = '\0';
+  }
+  return (p);
+}  // strndup()
+
+
+void free(void *p) {
+  if ((p) && (!contains(p))) {
+    ::free(p);
+  }
+}  // free()
+
+
+uint32_t maxFreeBlock() {
+#if defined(ESP8266)
+  return (ESP.getMaxFreeBlockSize());
+#elif defined(ESP32)
+  return (ESP.getMaxAllocHeap());
+#else
+  return (0);
+#endif
+}  // maxFreeBlock()
+
+}  // namespace HomeDing::Arena
+
+// End
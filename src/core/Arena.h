@@ -0,0 +1,76 @@
+/**
+ * @file Arena.h
+ *
+ * @brief The Arena collects the Elements and their configuration strings that are created
+ * during the startup of the board in a few larger memory chunks instead of many small
+ * allocations on the heap.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+The Board opens the Arena before the config files are parsed and closes it when the System
+Elements are started. While the Arena is open, Elements and the strings of ArrayString
+objects are bump-allocated from chunks of HD_ARENA_CHUNK bytes. Memory in the Arena is never
+freed as Elements live until the next reboot. Allocations larger than half a chunk and all
+allocations after closing the Arena use the heap.
+
+Define HD_ARENA_CHUNK as 0 to disable the Arena.
+@endverbatim
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#if !defined(HD_ARENA_CHUNK)
+#if defined(ESP8266)
+#define HD_ARENA_CHUNK 2048
+#else
+#define HD_ARENA_CHUNK 4096
+#endif
+#endif
+
+namespace HomeDing::Arena {
+
+/// @brief start allocating from the Arena.
+void open();
+
+/// @brief stop allocating from the Arena.
+void close();
+
+/// @brief Allocate memory from the Arena.
+/// @return pointer to the memory or nullptr when the Arena is not open or the size is too large.
+void *alloc(size_t size, size_t align = 8);
+
+/// @brief Return true when the memory is part of the Arena.
+bool contains(const void *p);
+
+/// @brief Copy len characters of a string into the Arena or onto the heap.
+char *strndup(const char *s, size_t len);
+
+/// @brief Free memory that was allocated using strndup() or malloc().
+void free(void *p);
+
+/// @brief size of all chunks.
+extern size_t size;
+
+/// @brief used memory in the chunks.
+extern size_t used;
+
+/// @brief Return the largest block that can be allocated on the heap.
+uint32_t maxFreeBlock();
+
+}  // namespace HomeDing::Arena
+
+// End
@@ -0,0 +1,155 @@
+/**
+ * @file Dataflow.cpp
+ *
+ * @brief The Dataflow graph evaluates chains of calculating elements like map, and, or, add and
+ * reference in a single pass without using the action queue.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see Dataflow.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <core/Dataflow.h>
+
+#include <vector>
+
+#define TRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
+
+namespace HomeDing::Dataflow {
+
+/// @brief a node of the graph.
+struct Node {
+  Element *element;
+  bool dirty;
+};
+
+/// @brief the board with the elements.
+static Board *_board = nullptr;
+
+/// @brief the nodes in topological order.
+static std::vector<Node> _nodes;
+
+/// @brief index of the node that is evaluated, -1 when no evaluation is running.
+static int _current = -1;
+
+/// @brief a node before the current node got a new value.
+static bool _again = false;
+
+
+void build(Board *board) {
+  std::vector<Element *> elems;
+  std::vector<std::pair<int, int>> edges;
+
+  _board = board;
+  _nodes.clear();
+
+  // collect all nodes
+  board->forEach(Element::CATEGORY::All, [&elems](Element *e) {
+    if (e->active && e->getOutputs([](const String &) {})) {
+      elems.push_back(e);
+    }
+  });
+
+  // resolve the outputs into edges
+  for (int n = 0; n < (int)elems.size(); n++) {
+    elems[n]->getOutputs([&](const String &action) {
+      Actions::forEachTarget(board, action, [&](Element *target) {
+        for (int t = 0; t < (int)elems.size(); t++) {
+          if (elems[t] == target) {
+            TRACE("edge %s -> %s", elems[n]->id, target->id);
+            edges.push_back({ n, t });
+          }
+        }
+      });
+    });
+  }
+
+  // sort the nodes in topological order (Kahn)
+  std::vector<int> inDegree(elems.size(), 0);
+  for (auto &e : edges) inDegree[e.second]++;
+
+  std::vector<int> ready;
+  for (int n = 0; n < (int)elems.size(); n++) {
+    if (inDegree[n] == 0) ready.push_back(n);
+  }
+
+  size_t r = 0;
+  while (r < ready.size()) {
+    int n = ready[r++];
+    _nodes.push_back({ elems[n], false });
+    for (auto &e : edges) {
+      if ((e.first == n) && (--inDegree[e.second] == 0)) {
+        ready.push_back(e.second);
+      }
+    }
+  }
+
+  for (int n = 0; n < (int)elems.size(); n++) {
+    if (inDegree[n] > 0) {
+      LOGGER_ERR("dataflow: %s is in or after a cycle", elems[n]->id);
+    }
+  }
+  _nodes.shrink_to_fit();
+  LOGGER_INFO("dataflow: %d nodes, %d edges", (int)_nodes.size(), (int)edges.size());
+}  // build()
+
+
+int indexOf(Element *e) {
+  for (int n = 0; n < (int)_nodes.size(); n++) {
+    if (_nodes[n].element == e) return (n);
+  }
+  return (-1);
+}  // indexOf()
+
+
+int indexOf(const char *id) {
+  Element *e = _board ? _board->findById(id) : nullptr;
+  return (e ? indexOf(e) : -1);
+}  // indexOf()
+
+
+bool isActive() {
+  return (!_nodes.empty());
+}  // isActive()
+
+
+bool isEvaluating() {
+  return (_current >= 0);
+}  // isEvaluating()
+
+
+void set(int node, const char *name, const char *value) {
+  _board->dispatchAction(_nodes[node].element, name, value);
+  _nodes[node].dirty = true;
+  if (node <= _current) _again = true;
+
+  if (_current < 0) {
+    // evaluate all nodes with new values in topological order.
+    int passes = 0;
+    do {
+      _again = false;
+      for (_current = 0; _current < (int)_nodes.size(); _current++) {
+        Node &n = _nodes[_current];
+        if (n.dirty) {
+          n.dirty = false;
+          n.element->loop();
+        }
+      }
+    } while (_again && (++passes < 4));
+    _current = -1;
+  }
+}  // set()
+
+}  // namespace HomeDing::Dataflow
+
+// End
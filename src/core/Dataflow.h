@@ -0,0 +1,76 @@
+/**
+ * @file Dataflow.h
+ *
+ * @brief The Dataflow graph evaluates chains of calculating elements like map, and, or, add and
+ * reference in a single pass without using the action queue.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ * * 18.10.2026 actions to nodes from other elements are queued.
+ *
+ * @details
+@verbatim
+Elements that calculate an output value from input values report the actions they send with
+the output value using Element::getOutputs(). When the dataflow is enabled by the device
+element ("dataflow": "true") the graph is built after all elements have started:
+
+* Every element that reports outputs is a node of the graph.
+* The actions of the outputs are resolved to the target elements. A target that is also a node
+  creates an edge.
+* The nodes are sorted in topological order. Nodes that are part of a cycle are not used.
+
+Actions to a node are queued like all other actions so the order of the actions is kept. When
+such an action is dispatched the value is set on the element and all nodes with new input values
+are evaluated in the topological order by calling their loop() function so every node is
+calculated once after all of its inputs have been updated.
+
+Actions from a node to another node during the evaluation are set directly and the target is
+evaluated in the same pass. A node that got a new value while the nodes after it were evaluated
+is evaluated in another pass, up to 4 passes.
+
+Actions to other elements are queued as before.
+@endverbatim
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+class Board;
+class Element;
+
+namespace HomeDing::Dataflow {
+
+/// @brief Build the graph from the active elements.
+void build(Board *board);
+
+/// @brief Return the index of the node of the element or -1 when the element is not a node.
+int indexOf(Element *e);
+
+/// @brief Return the index of the node of the element with the given id or -1.
+int indexOf(const char *id);
+
+/// @brief Return true when the graph is built and has nodes.
+bool isActive();
+
+/// @brief Return true while the nodes are evaluated.
+bool isEvaluating();
+
+/// @brief Set a property of a node and evaluate all nodes with new values.
+/// @param node index of the node.
+/// @param name name of the property.
+/// @param value value of the property.
+void set(int node, const char *name, const char *value);
+
+}  // namespace HomeDing::Dataflow
+
+// End
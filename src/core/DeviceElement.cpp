@@ -117,6 +117,9 @@ bool DeviceElement::set(const char *name, const char *value) {
     } else if (_stricmp(name, "cache") == 0) {
       _board->cacheHeader = value;
 
+    } else if (_stricmp(name, "dataflow") == 0) {
+      _board->dataflow = _atob(value);
+
       // ===== Service Discovery =====
     } else if (_stricmp(name, "sd") == 0) {
       _board->_mDnsEnabled = _atob(value);
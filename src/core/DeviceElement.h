@@ -18,6 +18,7 @@
  * * 24.09.2018 description added.
  * * 10.10.2018 startup as SYS element
  * * 24.01.2020 enable reboot via action
+ * * 18.10.2026 dataflow property.
  */
 
 #pragma once
@@ -98,5 +99,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Always register the DeviceElement onto the ElementRegistry.
 bool DeviceElement::registered =
-  ElementRegistry::registerElement("device", DeviceElement::create);
+  ElementRegistry::registerElement("device", DeviceElement::create, sizeof(DeviceElement));
 #endif
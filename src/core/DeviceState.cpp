@@ -2,7 +2,7 @@
  * @file DeviceState.cpp
  * @author Matthias Hertel (https://www.mathertel.de)
  *
- * @brief This class implements some functions to access the variables in RTC Memory for ESP8266.
+ * @brief This class implements some functions to access the variables in RTC Memory.
  *
  * @copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
  * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
@@ -16,59 +16,328 @@
 
 #include "hdfs.h"
 
+#if defined(ESP32)
+#include <Preferences.h>
+#endif
 
+// file of former versions with the state in text format.
 #define PREF_FILENAME "/$pref.txt"
 
+// file with the binary state image (ESP8266).
+#define STATE_FILENAME "/$state.bin"
+
+// NVS namespace and key with the binary state image (ESP32).
+#define STATE_NVS_NAMESPACE "homeding"
+#define STATE_NVS_KEY "state"
+
+// "HDS1"
+#define STATE_MAGIC 0x31534448
+
+// size of the image header.
+#define STATE_HEADER 20
+
+// size of the record header.
+#define STATE_RECORD 4
+
+// The first 128 bytes of the RTC user memory are used by eboot for OTA updates.
+#define STATE_RTC_OFFSET (128 / 4)
+
 // use BOARDTRACE for compiling with detailed TRACE output.
 #define STATETRACE(...) // Logger::LoggerPrint("State", LOGGER_LEVEL_TRACE, __VA_ARGS__)
 
+
+/// @brief binary image of the state.
+struct StateImage {
+  uint32_t magic;
+  uint32_t sum;        ///< checksum of the content starting at resetCount.
+  uint32_t saved;      ///< checksum of the records written to flash.
+  uint8_t savedReset;  ///< reset counter written to flash.
+
+  // content
+  uint8_t resetCount;
+  uint16_t bootCount;
+  uint16_t used;  ///< used bytes in data.
+  uint16_t reserved;
+  uint8_t data[STATE_SIZE - STATE_HEADER];
+};
+
+static_assert(offsetof(StateImage, data) == STATE_HEADER, "StateImage header size");
+
+#if defined(ESP8266)
+static_assert(STATE_SIZE + STATE_RTC_OFFSET * 4 <= 512, "STATE_SIZE exceeds RTC user memory");
+
+// working copy of the RTC user memory.
+static StateImage _image;
+
+#elif defined(ESP32)
+// kept in RTC memory through resets and deep sleep.
+static RTC_NOINIT_ATTR StateImage _image;
+#endif
+
+
 /// @brief state was loaded from perm. memory.
 bool DeviceState::_isLoaded = false;
 
 /// @brief millis() of last change in state.
 unsigned long DeviceState::_lastChange = 0;
 
+/// @brief the state was loaded from RTC memory after a reset or deep sleep.
+bool DeviceState::_fromRTC = false;
 
-// default values used when no PREF file was found.
-int DeviceState::_bootCount = 0;
-int DeviceState::_resetCount = 0;
+// number of values that were not saved because the image was full.
+static uint16_t _overflow = 0;
 
-ArrayString DeviceState::_states;
 
+// ===== static helper functions
 
-/// @brief Initialize local static variables.
-void DeviceState::load() {
-  STATETRACE("load()");
-  if (!_isLoaded) {
-    File f = HomeDingFS::rootFS->open(PREF_FILENAME, "r");
+// FNV-1a hash of some bytes.
+static uint32_t _fnv(const uint8_t *p, size_t len, uint32_t h = 2166136261UL) {
+  while (len--) {
+    h = (h ^ *p++) * 16777619UL;
+  }
+  return (h);
+}  // _fnv()
+
+
+// 16-bit hash of a key.
+static uint16_t _keyHash(const char *key, uint8_t keyLen) {
+  uint32_t h = _fnv((const uint8_t *)key, keyLen);
+  return ((uint16_t)((h >> 16) ^ h));
+}  // _keyHash()
+
+
+// checksum of the content.
+static uint32_t _checksum() {
+  const uint8_t *start = &_image.resetCount;
+  return (_fnv(start, (_image.data + _image.used) - start));
+}  // _checksum()
+
+
+// checksum of the records.
+static uint32_t _recordsSum() {
+  return (_fnv(_image.data, _image.used));
+}  // _recordsSum()
+
+
+// number of bytes of the image to be stored.
+static size_t _imageLen() {
+  return ((STATE_HEADER + _image.used + 3) & ~3);
+}  // _imageLen()
+
+
+static bool _isValid() {
+  return ((_image.magic == STATE_MAGIC) && (_image.used <= sizeof(_image.data)) && (_image.sum == _checksum()));
+}  // _isValid()
+
+
+static void _init() {
+  memset(&_image, 0, STATE_HEADER);
+  _image.magic = STATE_MAGIC;
+  _image.sum = _checksum();
+}  // _init()
+
+
+static void _writeRTC() {
+#if defined(ESP8266)
+  ESP.rtcUserMemoryWrite(STATE_RTC_OFFSET, (uint32_t *)&_image, _imageLen());
+#endif
+  // ESP32: the image is in RTC memory.
+}  // _writeRTC()
+
+
+static void _readFlash() {
+  STATETRACE("read flash");
+#if defined(ESP8266)
+  File f = HomeDingFS::rootFS->open(STATE_FILENAME, "r");
+  if (f) {
+    f.read((uint8_t *)&_image, sizeof(_image));
+    f.close();
+  }
+
+#elif defined(ESP32)
+  Preferences prefs;
+  if (prefs.begin(STATE_NVS_NAMESPACE, true)) {
+    prefs.getBytes(STATE_NVS_KEY, &_image, sizeof(_image));
+    prefs.end();
+  }
+#endif
+}  // _readFlash()
+
+
+static void _writeFlash() {
+  STATETRACE("write flash");
+#if defined(ESP8266)
+  File f = HomeDingFS::rootFS->open(STATE_FILENAME, "w");
+  if (f) {
+    f.write((const uint8_t *)&_image, _imageLen());
+    f.close();
+  }
+
+#elif defined(ESP32)
+  Preferences prefs;
+  if (prefs.begin(STATE_NVS_NAMESPACE, false)) {
+    prefs.putBytes(STATE_NVS_KEY, &_image, _imageLen());
+    prefs.end();
+  }
+#endif
+}  // _writeFlash()
+
+
+// find the record of a key and return the position in data or -1.
+static int _find(const char *key, uint8_t keyLen, uint16_t hash) {
+  uint16_t pos = 0;
+  while (pos < _image.used) {
+    uint8_t *r = _image.data + pos;
+    if ((r[0] == (hash & 0xFF)) && (r[1] == (hash >> 8)) && (r[2] == keyLen)
+        && (memcmp(r + STATE_RECORD, key, keyLen) == 0)) {
+      return (pos);
+    }
+    pos += STATE_RECORD + r[2] + r[3];
+  }
+  return (-1);
+}  // _find()
+
+
+// remove the record at the position.
+static void _remove(int pos) {
+  uint8_t *r = _image.data + pos;
+  uint16_t len = STATE_RECORD + r[2] + r[3];
+  memmove(r, r + len, _image.used - pos - len);
+  _image.used -= len;
+}  // _remove()
+
+
+// add a record at the end of the data.
+static bool _append(const char *key, uint8_t keyLen, uint16_t hash, const char *value, uint8_t valLen) {
+  uint16_t len = STATE_RECORD + keyLen + valLen;
+  if (_image.used + len > sizeof(_image.data)) {
+    return (false);
+  }
+  uint8_t *r = _image.data + _image.used;
+  r[0] = (hash & 0xFF);
+  r[1] = (hash >> 8);
+  r[2] = keyLen;
+  r[3] = valLen;
+  memcpy(r + STATE_RECORD, key, keyLen);
+  memcpy(r + STATE_RECORD + keyLen, value, valLen);
+  _image.used += len;
+  return (true);
+}  // _append()
+
+
+// set the value of a key in the image.
+// @return true when the image was changed.
+static bool _setValue(const char *key, const char *value) {
+  size_t keyLen = strlen(key);
+  size_t valLen = strlen(value);
+  if ((keyLen > 255) || (valLen > 255)) {
+    LOGGER_ERR("state too long");
+    return (false);
+  }
 
-    if (!f) {
-      STATETRACE("no PREF File");
+  uint16_t hash = _keyHash(key, keyLen);
+  int pos = _find(key, keyLen, hash);
+  size_t space = sizeof(_image.data) - _image.used;
+
+  if (pos >= 0) {
+    uint8_t *r = _image.data + pos;
+    uint8_t *v = r + STATE_RECORD + keyLen;
+    if (r[3] == valLen) {
+      if (memcmp(v, value, valLen) == 0) {
+        return (false);  // no change
+      }
+      memcpy(v, value, valLen);  // update in place
+      return (true);
+    }
+    space += STATE_RECORD + keyLen + r[3];
+  }
 
-    } else {
-      _bootCount = f.readStringUntil('\n').toInt();
-      _bootCount++;
-      _lastChange = millis();
+  if (STATE_RECORD + keyLen + valLen > space) {
+    // keep the former value.
+    LOGGER_ERR("state full, %s not saved", key);
+    _overflow++;
+    return (false);
+  }
 
-      _resetCount = f.readStringUntil('\n').toInt();
+  if (pos >= 0) {
+    _remove(pos);
+  }
+  _append(key, keyLen, hash, value, valLen);
+  return (true);
+}  // _setValue()
+
+
+// copy the record as "id?name=value" into buffer with STATE_SIZE bytes.
+static const char *_recordText(char *buffer, uint16_t pos) {
+  uint8_t *r = _image.data + pos;
+  memcpy(buffer, r + STATE_RECORD, r[2]);
+  buffer[r[2]] = '=';
+  memcpy(buffer + r[2] + 1, r + STATE_RECORD + r[2], r[3]);
+  buffer[r[2] + 1 + r[3]] = '\0';
+  return (buffer);
+}  // _recordText()
+
+
+// import the state from a $pref.txt file of former versions.
+static bool _import() {
+  bool ret = false;
+  File f = HomeDingFS::rootFS->open(PREF_FILENAME, "r");
+
+  if (f) {
+    STATETRACE("import PREF File");
+    _image.bootCount = f.readStringUntil('\n').toInt();
+    _image.resetCount = constrain(f.readStringUntil('\n').toInt(), 0, 255);
+
+    String s = f.readStringUntil('\n');
+    s.trim();
+    f.close();
+
+    ArrayString states;
+    states.split(s, VALUE_SEPARATOR);
+    for (int n = 0; n < states.size(); n++) {
+      String entry = states[n];
+      int sep = entry.indexOf('=');
+      if (sep > 0) {
+        _setValue(entry.substring(0, sep).c_str(), entry.c_str() + sep + 1);
+      }
+    }
+    ret = true;
+  }
+  return (ret);
+}  // _import()
 
-      _states.clear();
-      _states.reserve();
-      String s = f.readStringUntil('\n');
-      s.trim();
-      _states.split(s, VALUE_SEPARATOR);
 
-      // while (1) {
-      //   s = f.readStringUntil('\n');
-      //   if (s.isEmpty()) break;
+// ===== DeviceState implementation
 
-      //   STATETRACE("+<%s>", s.c_str());
-      // };
+/// @brief Initialize local static variables.
+void DeviceState::load() {
+  STATETRACE("load()");
+  if (!_isLoaded) {
+    bool imported = false;
+
+#if defined(ESP8266)
+    ESP.rtcUserMemoryRead(STATE_RTC_OFFSET, (uint32_t *)&_image, sizeof(_image));
+#endif
+    _fromRTC = _isValid();
+
+    if (!_fromRTC) {
+      _readFlash();
+      if (!_isValid()) {
+        _init();
+        imported = _import();
+      }
+    }
 
-      f.close();
+    // the boot counter is saved together with the next change.
+    _image.bootCount++;
+    _counted();
+
+    if (imported) {
+      _save();
+      HomeDingFS::rootFS->remove(PREF_FILENAME);
     }
     _isLoaded = true;
-    STATETRACE("boot=%d, reset=%d", _bootCount, _resetCount);
+    STATETRACE("boot=%d, reset=%d, rtc=%d", _image.bootCount, _image.resetCount, _fromRTC);
   }
 }
 
@@ -77,66 +346,133 @@ void DeviceState::load() {
 void DeviceState::save() {
   STATETRACE("save(%d)", _lastChange > 0);
   if (_lastChange) {
-
-    File f = HomeDingFS::rootFS->open(PREF_FILENAME, "w");
-
-    if (f) {
-      f.println(_bootCount);
-      f.println(_resetCount);
-      f.println(getStateString());
-      f.close();
+    if (_recordsSum() != _image.saved) {
+      _save();
     }
-
     _lastChange = 0;
   }
 }  // save()
 
 
+int DeviceState::getBootCount() {
+  return (_image.bootCount);
+}
+
+
 /**
  * @brief Set the Reset Counter object
  */
 int DeviceState::setResetCounter(int cnt) {
   STATETRACE("setResetCounter(%d)", cnt);
-  // The Reset counter supports a counter in the range 0..255
-  // that is stored in the lowest byte of the 32-bit value.
-  // The higher 3 bytes are used to check for a valid entry.
+  // The Reset counter supports a counter in the range 0..255.
 
   if (_isLoaded) {
-    _resetCount = constrain(cnt, 0, 255);
-    _lastChange = millis();
-    save();
+    _image.resetCount = constrain(cnt, 0, 255);
+    _counted();
+
+    // After a reset or deep sleep the counter in RTC memory is sufficient.
+    // The flash is needed for counting power cycles and must be 0 when running.
+    if ((!_fromRTC) ? (_image.resetCount != _image.savedReset) : ((_image.resetCount == 0) && (_image.savedReset != 0))) {
+      _save();
+    }
   }
   return (cnt);
 }  // setResetCounter
 
 
+int DeviceState::getResetCounter() {
+  return (_image.resetCount);
+}
+
+
+String DeviceState::getStateString() {
+  String ret;
+  char buffer[STATE_SIZE];
+
+  uint16_t pos = 0;
+  while (pos < _image.used) {
+    uint8_t *r = _image.data + pos;
+    if (pos > 0) ret.concat(VALUE_SEPARATOR);
+    ret.concat(_recordText(buffer, pos));
+    pos += STATE_RECORD + r[2] + r[3];
+  }
+  return (ret);
+}  // getStateString()
+
+
+void DeviceState::clear() {
+  if (_image.used) {
+    _image.used = 0;
+    _changed();
+  }
+}  // clear()
+
+
 /// @brief Save state information specific for an Element.
 /// @param element The Element that needs the state support.
 /// @param key Then key of a state variable of the element.
 /// @param value The value of a state variable of the element.
 void DeviceState::setElementState(Element *e, const char *key, const char *value) {
   STATETRACE("setElementState(%s, %s, %s)", e->id, key, value);
+  char entry[MAX_ID_LENGTH + 64];
 
-  String entry = String(e->id) + "?" + key + "=";
-
-  int16_t idx = _states.findStartWith(entry);
-  _states.remove(idx);
-  entry.concat(value);
-  _states.push(entry);
-
-  // _states.dump();
-  _lastChange = millis();
+  snprintf(entry, sizeof(entry), "%s?%s", e->id, key);
+  if (_setValue(entry, value ? value : "")) {
+    _changed();
+  }
 }  // setElementState()
 
 
 /// @brief Load all state information from RTC memory and dispatch them as actions.
 void DeviceState::loadElementState(Board *board) {
   STATETRACE("loadElementState()");
+  char buffer[STATE_SIZE];
 
-  for (int n = 0; n < _states.size(); n++) {
-    board->dispatchAction(_states[n]);
+  uint16_t pos = 0;
+  while (pos < _image.used) {
+    uint8_t *r = _image.data + pos;
+    board->dispatchAction(String(_recordText(buffer, pos)));
+    pos += STATE_RECORD + r[2] + r[3];
   }
 };
 
 
+int DeviceState::getStateUsed() {
+  return (_image.used);
+}  // getStateUsed()
+
+
+int DeviceState::getStateSize() {
+  return (sizeof(_image.data));
+}  // getStateSize()
+
+
+int DeviceState::getStateOverflow() {
+  return (_overflow);
+}  // getStateOverflow()
+
+
+// ===== private functions
+
+void DeviceState::_changed() {
+  _counted();
+  _lastChange = millis();
+}  // _changed()
+
+
+void DeviceState::_counted() {
+  _image.sum = _checksum();
+  _writeRTC();
+}  // _counted()
+
+
+void DeviceState::_save() {
+  _image.saved = _recordsSum();
+  _image.savedReset = _image.resetCount;
+  _image.sum = _checksum();
+  _writeRTC();
+  _writeFlash();
+}  // _save()
+
+
 // End.
@@ -5,17 +5,51 @@
  * @brief This class provides some functions to access the variables in RTC Memory.
  *
  * The Reset counter supports a counter in the range 0..255.
- * The State String supports a string memory up to 200 chars length (199 chars + NUL).
+ * The state of the Elements is kept in a binary image of STATE_SIZE bytes.
  *
  * @copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
  * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
  *
  * Changelog:
  * * 21.04.2018 creation
+ * * 18.10.2026 binary state records in RTC memory with coalesced writes to flash.
+ * * 18.10.2026 counters do not mark the state as changed, no value is lost when the state is full.
+ *
+ * @details
+@verbatim
+The state is kept in a binary image with a header (magic, checksum, counters) and a list of
+records. Every record has a 16-bit hash of the key for a fast lookup, the key "id?name" and
+the value:
+
+  [hash:2][keylen:1][vallen:1][key][value]
+
+The image lives in RTC memory that survives a reset and deep sleep:
+* ESP8266: the RTC user memory after the first 128 bytes that are used by the OTA bootloader,
+  followed by the resume snapshot.
+* ESP32: a RTC_NOINIT_ATTR variable.
+
+Every change is written to the RTC memory at once. The flash copy ($state.bin on ESP8266, NVS
+on ESP32) is only written by save() when the records have changed since the last save. The boot
+counter is kept in RTC memory and written to flash together with the records or the reset
+counter. On a deep sleep wakeup the valid RTC image is used and no file system access is needed.
+
+A value that does not fit into the image is not saved and the former value is kept. This is
+logged as an error and the number of lost values is reported in /api/sysinfo.
+
+An existing $pref.txt file from former versions is imported once.
+@endverbatim
  */
 
 #pragma once
 
+#if !defined(STATE_SIZE)
+#if defined(ESP8266)
+#define STATE_SIZE 320
+#else
+#define STATE_SIZE 1024
+#endif
+#endif
+
 class DeviceState {
 
 public:
@@ -26,36 +60,26 @@ public:
   static void save();
 
   // return the number of boots since setup of device & storage
-  static int getBootCount() {
-    return (_bootCount);
-  }
+  static int getBootCount();
 
 
   /// @brief Set the Reset Counter object and save all state
   /// @param cnt The new counter value.
-  /// @param saveNow
   /// @return int The new counter value.
   static int setResetCounter(int cnt);
 
 
   /// @brief return the reset counter value.
-  static int getResetCounter() {
-    return (_resetCount);
-  };
+  static int getResetCounter();
 
 
   /// @brief Get the State String object
   /// @return String The actual state string
-  static String getStateString() {
-    return (_states.concat(VALUE_SEPARATOR));
-  };
+  static String getStateString();
 
 
   /// @brief remove all state information for Elements.
-  static void clear() {
-    _states.clear();
-    _lastChange = millis();
-  };
+  static void clear();
 
 
   /// @brief Save state information specific for an Element.
@@ -75,6 +99,18 @@ public:
   };
 
 
+  /// @brief return the number of bytes used by the state of the elements.
+  static int getStateUsed();
+
+
+  /// @brief return the number of bytes available for the state of the elements.
+  static int getStateSize();
+
+
+  /// @brief return the number of values that were not saved because the state was full.
+  static int getStateOverflow();
+
+
 private:
   /// @brief state was loaded from perm. memory.
   static bool _isLoaded;
@@ -82,13 +118,17 @@ private:
   /// @brief millis() of last change in state.
   static unsigned long _lastChange;
 
-  // === state variables
+  /// @brief the state was loaded from RTC memory after a reset or deep sleep.
+  static bool _fromRTC;
+
+  /// @brief update the checksum and write the image to RTC memory.
+  static void _changed();
 
-  static int _bootCount;
-  static int _resetCount;
+  /// @brief update the checksum and write the image to RTC memory without marking a change for save().
+  static void _counted();
 
-  // Array of current state properties of Elements.
-  static ArrayString _states;
+  /// @brief write the image to flash.
+  static void _save();
 
 };  // class
 
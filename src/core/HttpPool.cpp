@@ -0,0 +1,143 @@
+/**
+ * @file HttpPool.cpp
+ * @author Matthias Hertel (https://www.mathertel.de)
+ *
+ * @brief The HttpPool keeps http connections open for reuse by the HttpClientElement based elements
+ * and caches the results of DNS requests.
+ *
+ * @copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
+ *
+ * Changelog: see HttpPool.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+#include <core/HttpPool.h>
+
+#define POOLTRACE(...)  // LOGGER_JUSTINFO("Pool:" __VA_ARGS__)
+
+HttpPool::Connection HttpPool::_pool[HTTPPOOL_SIZE];
+HttpPool::DnsEntry HttpPool::_dns[HTTPPOOL_DNS_SIZE];
+
+
+bool HttpPool::resolve(const String &host, IPAddress &ip) {
+  unsigned long now = millis();
+  DnsEntry *slot = nullptr;
+
+  for (DnsEntry &e : _dns) {
+    if (e.host == host) {
+      if (now - e.time < HTTPPOOL_DNS_TTL) {
+        ip = e.ip;
+        return (true);
+      }
+      slot = &e;  // outdated entry
+      break;
+    }
+  }  // for
+
+  if (!slot) {
+    // use a free or the oldest entry
+    slot = &_dns[0];
+    for (DnsEntry &e : _dns) {
+      if (e.host.isEmpty()) {
+        slot = &e;
+        break;
+      } else if (now - e.time > now - slot->time) {
+        slot = &e;
+      }
+    }  // for
+  }
+
+  POOLTRACE("resolve %s", host.c_str());
+  if ((!WiFi.hostByName(host.c_str(), ip)) || (!ip)) {
+    return (false);
+  }
+
+  slot->host = host;
+  slot->ip = ip;
+  slot->time = now;
+  return (true);
+}  // resolve()
+
+
+void HttpPool::forget(const String &host) {
+  for (DnsEntry &e : _dns) {
+    if (e.host == host) {
+      e.host = "";
+    }
+  }
+}  // forget()
+
+
+WiFiClient *HttpPool::acquire(const String &host, bool &reused) {
+  Connection *found = nullptr;
+
+  loop();
+  reused = false;
+
+  // reuse an open connection to the host
+  for (Connection &c : _pool) {
+    if ((!c.inUse) && (c.host == host) && (c.client.connected())) {
+      found = &c;
+      reused = true;
+      break;
+    }
+  }
+
+  if (!found) {
+    // take a free slot or the longest idle one
+    unsigned long now = millis();
+    for (Connection &c : _pool) {
+      if (c.inUse) {
+        // not available
+      } else if (c.host.isEmpty()) {
+        found = &c;
+        break;
+      } else if ((!found) || (now - c.lastUsed > now - found->lastUsed)) {
+        found = &c;
+      }
+    }
+    if (found) {
+      found->client.stop();
+      found->host = host;
+    }
+  }
+
+  if (found) {
+    POOLTRACE("acquire %s reused=%d", host.c_str(), reused);
+    found->inUse = true;
+    return (&found->client);
+  }
+  return (nullptr);
+}  // acquire()
+
+
+void HttpPool::release(WiFiClient *client, bool keepAlive) {
+  for (Connection &c : _pool) {
+    if (&c.client == client) {
+      POOLTRACE("release %s keep=%d", c.host.c_str(), keepAlive);
+      if ((!keepAlive) || (!c.client.connected())) {
+        c.client.stop();
+        c.host = "";
+      }
+      c.inUse = false;
+      c.lastUsed = millis();
+    }
+  }
+}  // release()
+
+
+void HttpPool::loop() {
+  unsigned long now = millis();
+
+  for (Connection &c : _pool) {
+    if ((!c.inUse) && (!c.host.isEmpty()) && (now - c.lastUsed > HTTPPOOL_IDLE_TIMEOUT)) {
+      POOLTRACE("close %s", c.host.c_str());
+      c.client.stop();
+      c.host = "";
+    }
+  }
+}  // loop()
+
+// End.
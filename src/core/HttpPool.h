@@ -0,0 +1,73 @@
+/**
+ * @file HttpPool.h
+ * @author Matthias Hertel (https://www.mathertel.de)
+ *
+ * @brief The HttpPool keeps http connections open for reuse by the HttpClientElement based elements
+ * and caches the results of DNS requests.
+ *
+ * @copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ * This work is licensed under a BSD 3-Clause style license, see https://www.mathertel.de/License.aspx
+ *
+ * Changelog:
+ * * 18.10.2026 creation
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+/// @brief Number of connections in the pool.
+#define HTTPPOOL_SIZE 3
+
+/// @brief Idle connections are closed after this time in msecs.
+#define HTTPPOOL_IDLE_TIMEOUT (10 * 1000)
+
+/// @brief Number of cached DNS results.
+#define HTTPPOOL_DNS_SIZE 4
+
+/// @brief Time to live of cached DNS results in msecs.
+#define HTTPPOOL_DNS_TTL (5 * 60 * 1000)
+
+class HttpPool {
+public:
+  /// @brief Get the IP address of a host, using the DNS cache.
+  /// @param host name of the host.
+  /// @param ip IP address of the host.
+  /// @return true when the host is known.
+  static bool resolve(const String &host, IPAddress &ip);
+
+  /// @brief Remove a host from the DNS cache e.g. after failing to connect.
+  static void forget(const String &host);
+
+  /// @brief Get a connection for a host from the pool.
+  /// @param host name of the host.
+  /// @param reused is set to true when the returned connection is already established.
+  /// @return client connection or nullptr when all connections are in use.
+  static WiFiClient *acquire(const String &host, bool &reused);
+
+  /// @brief Return a connection to the pool.
+  /// @param client the connection from acquire().
+  /// @param keepAlive true when the connection can be reused.
+  static void release(WiFiClient *client, bool keepAlive);
+
+  /// @brief Close connections that are idle for too long.
+  static void loop();
+
+private:
+  struct Connection {
+    String host;
+    WiFiClient client;
+    bool inUse;
+    unsigned long lastUsed;
+  };
+
+  struct DnsEntry {
+    String host;
+    IPAddress ip;
+    unsigned long time;
+  };
+
+  static Connection _pool[HTTPPOOL_SIZE];
+  static DnsEntry _dns[HTTPPOOL_DNS_SIZE];
+};
@@ -120,5 +120,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 bool LogElement::registered =
-    ElementRegistry::registerElement("log", LogElement::create);
+    ElementRegistry::registerElement("log", LogElement::create, sizeof(LogElement));
 #endif
@@ -34,6 +34,22 @@ static const char *LOGFILE_NAME = "/log.txt";
 static const char *LOGFILE_OLD_NAME = "/log_old.txt";
 #endif
 
+#if LOGGER_RING_SIZE > 0
+// The ring contains the last log lines as records of [len][file offset][text][NUL].
+// The file offset is the size of the log file before the line and allows reading
+// the lines that are not in the ring any more from the log file.
+#define LOGGER_RING_HEAD (1 + sizeof(uint32_t))
+static char _ring[LOGGER_RING_SIZE];
+static uint16_t _ringUsed = 0;
+
+// sequence number of the first line in the ring and of the next line.
+static uint32_t _ringFirst = 1;
+static uint32_t _ringNext = 1;
+#endif
+
+// current size of the log file.
+static uint32_t _logFileSize = 0;
+
 // initialize file system for log file
 void Logger::init(FILESYSTEM *fs) {
   _fileSystem = fs;
@@ -43,6 +59,14 @@ void Logger::init(FILESYSTEM *fs) {
 // enable/disable log file
 void Logger::setLogFile(bool enable) {
   _logFileEnabled = enable;
+
+#if !defined(HD_MINIMAL)
+  if ((enable) && (_fileSystem)) {
+    File f = _fileSystem->open(LOGFILE_NAME, "r");
+    _logFileSize = (f ? f.size() : 0);
+    f.close();
+  }
+#endif
 }  // setLogFile()
 
 
@@ -95,9 +119,14 @@ void Logger::_print(const char *module, int level, const char *fmt,
 #endif
   hd_yield();
 
-  if ((module) && (_logFileEnabled) && (level < LOGGER_LEVEL_TRACE)) {
-    _printToFile(buffer);
-    hd_yield();
+  if ((module) && (level < LOGGER_LEVEL_TRACE)) {
+    // errors and info of modules are kept like in the log file.
+    _printToRing(buffer);
+
+    if (_logFileEnabled) {
+      _printToFile(buffer);
+      hd_yield();
+    }
   }  // if
 }  // _print
 
@@ -116,6 +145,7 @@ void Logger::_printToFile(char *buffer) {
       f = _fileSystem->open(LOGFILE_NAME, "a");
     }  // if
     f.println(buffer);
+    _logFileSize = f.size();
     f.close();
     hd_yield();
   }
@@ -123,6 +153,70 @@ void Logger::_printToFile(char *buffer) {
 };
 
 
+void Logger::_printToRing(const char *buffer) {
+#if LOGGER_RING_SIZE > 0
+  size_t len = strnlen(buffer, 254);
+
+  // drop the oldest lines until the new line fits.
+  while ((_ringUsed) && (_ringUsed + LOGGER_RING_HEAD + len + 1 > LOGGER_RING_SIZE)) {
+    uint16_t first = LOGGER_RING_HEAD + (uint8_t)_ring[0] + 1;
+    memmove(_ring, _ring + first, _ringUsed - first);
+    _ringUsed -= first;
+    _ringFirst++;
+  }
+
+  char *p = _ring + _ringUsed;
+  *p++ = (char)len;
+  memcpy(p, &_logFileSize, sizeof(uint32_t));
+  p += sizeof(uint32_t);
+  memcpy(p, buffer, len);
+  p[len] = '\0';
+  _ringUsed += LOGGER_RING_HEAD + len + 1;
+  _ringNext++;
+#endif
+}  // _printToRing()
+
+
+uint32_t Logger::getLines(String &out, uint32_t after, uint32_t *fileStart) {
+  uint32_t last = 0;
+  if (fileStart) *fileStart = _logFileSize;
+
+#if LOGGER_RING_SIZE > 0
+  uint32_t seq = _ringFirst;
+  uint16_t pos = 0;
+  bool first = true;
+
+  while (pos < _ringUsed) {
+    uint8_t len = (uint8_t)_ring[pos];
+    if (seq > after) {
+      if ((first) && (fileStart)) memcpy(fileStart, _ring + pos + 1, sizeof(uint32_t));
+      first = false;
+      out.concat(_ring + pos + LOGGER_RING_HEAD);
+      out.concat('\n');
+    }
+    pos += LOGGER_RING_HEAD + len + 1;
+    seq++;
+  }
+  last = _ringNext - 1;
+#endif
+  return (last);
+}  // getLines()
+
+
+uint32_t Logger::fileSize() {
+  return (_logFileSize);
+}  // fileSize()
+
+
+uint32_t Logger::firstLine() {
+#if LOGGER_RING_SIZE > 0
+  return (_ringFirst);
+#else
+  return (1);
+#endif
+}  // firstLine()
+
+
 /// @brief Create Raw Log entry without prefix
 /// @param fmt format string using printf syntax
 /// @param parameters according printf
@@ -19,6 +19,9 @@
  * * 27.10.2018 rolling logfiles and log_old.txt.
  * * 02.02.2019 reduce Flash memory, optimizing
  * * 27.04.2019 add some delay(1) / yield(), enabling network events.
+ * * 18.10.2026 log ring with sequence numbers for /api/log.
+ * * 18.10.2026 log file offsets in the log ring.
+ * * 18.10.2026 the log ring has the same lines as the log file.
  */
 
 #pragma once
@@ -32,6 +35,17 @@
 /** detailed trace level to debug port only. Requires loglevel 2(trace). */
 #define LOGGER_LEVEL_TRACE 2
 
+/** size of the in-memory ring with the last log lines of the log file level. 0 disables the ring. */
+#if !defined(LOGGER_RING_SIZE)
+#if defined(HD_MINIMAL)
+#define LOGGER_RING_SIZE 0
+#elif defined(ESP8266)
+#define LOGGER_RING_SIZE 1024
+#else
+#define LOGGER_RING_SIZE 4096
+#endif
+#endif
+
 // ===== RAW logging
 
 #if defined(ESP8266) && defined(DEBUG_ESP_PORT)
@@ -153,6 +167,19 @@ public:
   /// @param parameters according printf
   static void LoggerEPrint(Element *module, int level, const char *fmt, ...);
 
+  /// @brief Get the lines from the log ring after a sequence number.
+  /// @param out String the lines are appended to.
+  /// @param after sequence number of the last known line.
+  /// @param fileStart returns the size of the log file before the first returned line.
+  /// @return sequence number of the last line in the ring.
+  static uint32_t getLines(String &out, uint32_t after, uint32_t *fileStart = nullptr);
+
+  /// @brief return the current size of the log file.
+  static uint32_t fileSize();
+
+  /// @brief return the sequence number of the oldest line in the log ring.
+  static uint32_t firstLine();
+
 
 private:
   // File System for logging file
@@ -166,6 +193,9 @@ private:
 
   // Print to logfile
   static void _printToFile(char *buffer);
+
+  // Add to log ring
+  static void _printToRing(const char *buffer);
 };
 
 
@@ -10,12 +10,15 @@
  *
  * Changelog:
  * * 30.08.2023 creation
+ * * 18.10.2026 fast connect using the resume snapshot after deep sleep.
+ * * 18.10.2026 re-enable DHCP when connecting without the resume snapshot.
  */
 
 #pragma once
 
 #include <Arduino.h>
 #include <HomeDing.h>
+#include <core/Resume.h>
 
 // #define NETWORKTRACE_ON
 
@@ -51,7 +54,9 @@ public:
     WiFi.persistent(false);
   };
 
-  static void connect(String &deviceName, String &nName, String &nPass) {
+  /// @brief Start connecting to the network.
+  /// @param resume snapshot with access point and IP configuration for a fast connect or nullptr.
+  static void connect(String &deviceName, String &nName, String &nPass, const HomeDing::Resume::Snapshot *resume = nullptr) {
     Logger::printf("connect as '%s' to WiFI %s...", deviceName.c_str(), nName.c_str());
 
     WiFi.mode(WIFI_STA);
@@ -64,7 +69,19 @@ public:
     WiFi.hostname(deviceName);
 #endif
 
-    WiFi.begin(nName.c_str(), nPass.c_str());
+    if (resume) {
+      // same access point without scanning, same IP configuration without DHCP.
+      WiFi.config(IPAddress(resume->ip), IPAddress(resume->gateway), IPAddress(resume->mask), IPAddress(resume->dns));
+      WiFi.begin(nName.c_str(), nPass.c_str(), resume->channel, resume->bssid);
+    } else {
+      // use DHCP, also after a failed fast resume has set a static IP configuration.
+#if defined(ESP32)
+      WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+#elif defined(ESP8266)
+      WiFi.config(0u, 0u, 0u);
+#endif
+      WiFi.begin(nName.c_str(), nPass.c_str());
+    }
     delay(100);
     state = NETSTATE::CONNECTSTA;
   };
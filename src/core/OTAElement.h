@@ -67,5 +67,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Always Register the OTAElement in the ElementRegistry.
 bool OTAElement::registered =
-  ElementRegistry::registerElement("ota", OTAElement::create);
+  ElementRegistry::registerElement("ota", OTAElement::create, sizeof(OTAElement));
 #endif
\ No newline at end of file
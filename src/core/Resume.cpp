@@ -0,0 +1,103 @@
+/**
+ * @file Resume.cpp
+ *
+ * @brief The Resume snapshot keeps the data of the WiFi connection in RTC memory for a fast
+ * reconnect after deep sleep.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog: see Resume.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <core/Resume.h>
+
+#define TRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
+
+// "HDR1"
+#define RESUME_MAGIC 0x31524448
+
+namespace HomeDing::Resume {
+
+#if defined(ESP8266)
+// The snapshot follows the DeviceState in the RTC user memory.
+#define RESUME_RTC_OFFSET ((128 + STATE_SIZE) / 4)
+static_assert((RESUME_RTC_OFFSET * 4) + sizeof(Snapshot) <= 512, "Snapshot exceeds RTC user memory");
+
+// working copy of the RTC user memory.
+Snapshot snapshot;
+
+#elif defined(ESP32)
+// kept in RTC memory through deep sleep.
+RTC_NOINIT_ATTR Snapshot snapshot;
+#endif
+
+
+// FNV-1a checksum of the data after the sum.
+static uint32_t _checksum() {
+  const uint8_t *p = (const uint8_t *)&snapshot.bssid;
+  const uint8_t *end = (const uint8_t *)(&snapshot + 1);
+  uint32_t h = 2166136261UL;
+  while (p < end) {
+    h = (h ^ *p++) * 16777619UL;
+  }
+  return (h);
+}  // _checksum()
+
+
+static void _write() {
+  snapshot.magic = RESUME_MAGIC;
+  snapshot.sum = _checksum();
+#if defined(ESP8266)
+  ESP.rtcUserMemoryWrite(RESUME_RTC_OFFSET, (uint32_t *)&snapshot, sizeof(snapshot));
+#endif
+}  // _write()
+
+
+bool load() {
+#if defined(ESP8266)
+  ESP.rtcUserMemoryRead(RESUME_RTC_OFFSET, (uint32_t *)&snapshot, sizeof(snapshot));
+#endif
+  if ((snapshot.magic != RESUME_MAGIC) || (snapshot.sum != _checksum())) {
+    memset(&snapshot, 0, sizeof(snapshot));
+  }
+  TRACE("resume: ch=%d awake=%d cycles=%d", snapshot.channel, snapshot.awakeTime, snapshot.cycles);
+  return (snapshot.channel != 0);
+}  // load()
+
+
+void save(unsigned long awakeTime) {
+  snapshot.awakeTime = awakeTime;
+  snapshot.cycles++;
+
+  if (WiFi.status() == WL_CONNECTED) {
+    memcpy(snapshot.bssid, WiFi.BSSID(), sizeof(snapshot.bssid));
+    snapshot.channel = WiFi.channel();
+    snapshot.ip = (uint32_t)WiFi.localIP();
+    snapshot.gateway = (uint32_t)WiFi.gatewayIP();
+    snapshot.mask = (uint32_t)WiFi.subnetMask();
+    snapshot.dns = (uint32_t)WiFi.dnsIP();
+  } else {
+    snapshot.channel = 0;
+  }
+  _write();
+}  // save()
+
+
+void clearNetwork() {
+  snapshot.channel = 0;
+  _write();
+}  // clearNetwork()
+
+}  // namespace HomeDing::Resume
+
+// End
@@ -0,0 +1,69 @@
+/**
+ * @file Resume.h
+ *
+ * @brief The Resume snapshot keeps the data of the WiFi connection in RTC memory for a fast
+ * reconnect after deep sleep and measures the time a device is awake.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino.
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+Before the board starts deep sleep the BSSID, channel and the IP configuration received by
+DHCP are saved in RTC memory together with the time since the wakeup. On the next wakeup
+the board connects to the same access point without scanning and uses the IP configuration
+without DHCP. When this fails the normal connect is used.
+
+The state of elements like calibration values is kept by the DeviceState in RTC memory.
+
+* ESP8266: the RTC user memory after the DeviceState.
+* ESP32: a RTC_NOINIT_ATTR variable.
+@endverbatim
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace HomeDing::Resume {
+
+/// @brief the data kept in RTC memory.
+struct Snapshot {
+  uint32_t magic;
+  uint32_t sum;
+  uint8_t bssid[6];
+  uint8_t channel;  ///< 0 when no network data is available.
+  uint8_t reserved;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t mask;
+  uint32_t dns;
+  uint32_t awakeTime;  ///< msecs the device was awake before the last deep sleep.
+  uint32_t cycles;     ///< number of deep sleep cycles.
+};
+
+/// @brief the current snapshot.
+extern Snapshot snapshot;
+
+/// @brief Load the snapshot from RTC memory.
+/// @return true when a valid snapshot with network data was found.
+bool load();
+
+/// @brief Save the WiFi connection data and the awake time before deep sleep.
+void save(unsigned long awakeTime);
+
+/// @brief Remove the network data from the snapshot after a failed fast connect.
+void clearNetwork();
+
+}  // namespace HomeDing::Resume
+
+// End
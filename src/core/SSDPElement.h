@@ -63,5 +63,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the SSDPElement in the ElementRegistry
 bool SSDPElement::registered =
-    ElementRegistry::registerElement("ssdp", SSDPElement::create);
+    ElementRegistry::registerElement("ssdp", SSDPElement::create, sizeof(SSDPElement));
 #endif
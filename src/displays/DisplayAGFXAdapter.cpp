@@ -11,6 +11,11 @@
  */
 
 #include <displays/DisplayAGFXAdapter.h>
+#include <displays/DisplayOutputElement.h>
+
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#endif
 
 #define TRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
 
@@ -27,6 +32,50 @@ Arduino_GFX *gfx = nullptr;
 
 static uint16_t AGFX_drawColor;
 
+
+/// @brief GFX implementation drawing into the pixel buffer of a tile.
+/// The coordinates are the same as on the display, pixels outside of the tile are ignored.
+class TileCanvas : public Arduino_GFX {
+public:
+  TileCanvas(int16_t w, int16_t h, BoundingBox &box, uint16_t *pixels)
+    : Arduino_GFX(w, h) {
+    _box = box;
+    _tileWidth = box.width();
+    _pixels = pixels;
+    // like on the display, texts are not wrapped at the canvas border.
+    setTextWrap(false);
+  }
+
+  bool begin(int32_t /* speed */ = GFX_NOT_DEFINED) override {
+    return (true);
+  }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override {
+    if (_box.contains(x, y)) {
+      _pixels[(y - _box.y_min) * _tileWidth + (x - _box.x_min)] = color;
+    }
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    int16_t x0 = std::max(x, _box.x_min);
+    int16_t x1 = std::min((int16_t)(x + w - 1), _box.x_max);
+    int16_t y0 = std::max(y, _box.y_min);
+    int16_t y1 = std::min((int16_t)(y + h - 1), _box.y_max);
+
+    for (int16_t yy = y0; yy <= y1; yy++) {
+      uint16_t *p = _pixels + (yy - _box.y_min) * _tileWidth + (x0 - _box.x_min);
+      for (int16_t xx = x0; xx <= x1; xx++) {
+        *p++ = color;
+      }
+    }
+  }
+
+private:
+  BoundingBox _box;
+  int16_t _tileWidth;
+  uint16_t *_pixels;
+};
+
 bool DisplayAGFXAdapter::start() {
   PANELTRACE("init: w:%d, h:%d, r:%d\n", displayConfig.width, displayConfig.height, displayConfig.rotation);
   PANELTRACE(" colors: #%08x / #%08x\n", displayConfig.drawColor, displayConfig.backgroundColor);
@@ -117,6 +166,88 @@ BoundingBox DisplayAGFXAdapter::drawText(int16_t x, int16_t y, int16_t h, const
 }  // drawText
 
 
+// ===== drawing using offscreen tiles
+
+bool DisplayAGFXAdapter::drawCached(DisplayOutputElement *de) {
+  Tile *tile = nullptr;
+
+  for (size_t n = 0; n < _tiles.size(); n++) {
+    if (_tiles[n].de == de) {
+      if ((_tiles[n].box.x_min == de->box.x_min) && (_tiles[n].box.y_min == de->box.y_min)
+          && (_tiles[n].box.x_max == de->box.x_max) && (_tiles[n].box.y_max == de->box.y_max)) {
+        tile = &_tiles[n];
+      } else {
+        _freeTile(n);  // the element was moved or resized.
+        de->cacheValid = false;
+      }
+      break;
+    }
+  }
+
+  if ((!tile) || (!de->cacheValid)) {
+    if (!tile) tile = _allocTile(de);
+    if (!tile) return (false);
+
+    // render the element into the tile.
+    TRACE("render tile %s", de->id);
+    TileCanvas canvas(gfx->width(), gfx->height(), tile->box, tile->pixels);
+    Arduino_GFX *display = gfx;
+
+    gfx = &canvas;
+    fillRect(tile->box, displayConfig.backgroundColor);
+    de->draw();
+    gfx = display;
+    de->cacheValid = true;
+  }
+
+  // copy the tile in one block transfer.
+  gfx->draw16bitRGBBitmap(tile->box.x_min, tile->box.y_min, tile->pixels, tile->box.width(), tile->box.height());
+  tile->used = millis();
+  _needFlush = true;
+  return (true);
+}  // drawCached()
+
+
+// allocate a tile within the memory budget, prefer PSRAM.
+DisplayAGFXAdapter::Tile *DisplayAGFXAdapter::_allocTile(DisplayOutputElement *de) {
+  BoundingBox box = de->box;
+  size_t size = (size_t)box.width() * box.height() * sizeof(uint16_t);
+
+  if ((box.isEmpty()) || (size > displayConfig.tileCache)) {
+    return (nullptr);
+  }
+
+  // free the least recently used tiles.
+  while ((!_tiles.empty()) && (_tileBytes + size > displayConfig.tileCache)) {
+    size_t oldest = 0;
+    for (size_t n = 1; n < _tiles.size(); n++) {
+      if ((long)(_tiles[n].used - _tiles[oldest].used) < 0) oldest = n;
+    }
+    _tiles[oldest].de->cacheValid = false;
+    _freeTile(oldest);
+  }
+
+  uint16_t *pixels = nullptr;
+#if defined(ESP32)
+  pixels = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+#endif
+  if (!pixels) pixels = (uint16_t *)malloc(size);
+  if (!pixels) return (nullptr);
+
+  TRACE("alloc tile %s %d bytes", de->id, size);
+  _tiles.push_back({ de, box, pixels, size, millis() });
+  _tileBytes += size;
+  return (&_tiles.back());
+}  // _allocTile()
+
+
+void DisplayAGFXAdapter::_freeTile(size_t n) {
+  free(_tiles[n].pixels);
+  _tileBytes -= _tiles[n].size;
+  _tiles.erase(_tiles.begin() + n);
+}  // _freeTile()
+
+
 // ===== protected functions
 
 /// @brief send all buffered pixels to display.
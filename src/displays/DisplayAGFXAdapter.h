@@ -9,6 +9,8 @@
  * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
  * -----
  * * 27.05.2023 created by Matthias Hertel
+ * * 18.10.2026 spans are drawn using writeFastHLine.
+ * * 18.10.2026 offscreen tiles for cached display elements.
  */
 
 #pragma once
@@ -20,6 +22,8 @@
 
 #include <displays/DisplayAdapter.h>
 
+#include <vector>
+
 using namespace HomeDing;
 
 #include <fonts/font.h>
@@ -87,12 +91,29 @@ public:
     gfx->writePixelPreclipped(x, y, col565(color));
   };
 
+  void writeSpan(int16_t y, int16_t x0, int16_t x1, uint32_t color) override {
+    gfx->writeFastHLine(x0, y, x1 - x0 + 1, col565(color));
+  };
+
+  void writeSpans(const DisplaySpan *spans, uint16_t count, uint32_t color) override {
+    uint16_t col = col565(color);
+    for (uint16_t n = 0; n < count; n++) {
+      gfx->writeFastHLine(spans[n].x0, spans[n].y, spans[n].x1 - spans[n].x0 + 1, col);
+    }
+  };
+
   void endWrite() override {
     DisplayAdapter::endWrite();
     gfx->endWrite();
   }
 
 
+  // ===== drawing using offscreen tiles
+
+  /// @brief Draw an element by copying its offscreen tile or render it into a new tile.
+  bool drawCached(DisplayOutputElement *de) override;
+
+
 protected:
   /// @brief send all buffered pixels to display.
   void flush() override;
@@ -115,4 +136,25 @@ protected:
   void loadFont(int16_t height, int8_t factor = 1);
 
   int baseLine;  // baseline offset
+
+  /// @brief offscreen copy of a drawn element in the 565 color format.
+  struct Tile {
+    DisplayOutputElement *de;
+    BoundingBox box;
+    uint16_t *pixels;
+    size_t size;
+    unsigned long used;
+  };
+
+  /// @brief the allocated tiles.
+  std::vector<Tile> _tiles;
+
+  /// @brief memory used by all tiles.
+  size_t _tileBytes = 0;
+
+  /// @brief allocate a tile for the element within the memory budget.
+  Tile *_allocTile(DisplayOutputElement *de);
+
+  /// @brief free the memory of a tile and remove it.
+  void _freeTile(size_t n);
 };
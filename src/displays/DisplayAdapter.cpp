@@ -154,12 +154,18 @@ bool DisplayAdapter::startFlush(bool force) {
       if (de->active && de->page == page && de->needsDraw) {
         TRACEDRAW(" draw: %d/%d-%d/%d", de->box.x_min, de->box.y_min, de->box.x_max, de->box.y_max);
 
-        if (!(de->isOpaque)) {
+        if ((de->cache) && drawCached(de)) {
+          // copied from the offscreen tile
+
+        } else if (!(de->isOpaque)) {
           // The DisplayOutputElement needs drawing the background
           fillRect(de->box, displayConfig.backgroundColor);
           // fillRect(de->box.x_min, de->box.y_min, de->box.x_max - de->box.x_min + 1, de->box.y_max - de->box.y_min + 1, displayConfig.backgroundColor);
+          de->draw();
+
+        } else {
+          de->draw();
         }
-        de->draw();
         de->needsDraw = false;  // done.
       }
     });
@@ -16,6 +16,8 @@
  * 22.07.2023 cpp file added (from DisplayAdapter.h).
  *            handling lightPin and brightness.
  * 19.02.2024 startFlush(bool) method added.
+ * 18.10.2026 writeSpan() and writeSpans() for drawing horizontal lines of pixels.
+ * 18.10.2026 drawCached() for drawing elements using offscreen tiles.
  */
 
 /*
@@ -28,6 +30,7 @@
 
  * `startWrite()` -- to start a pixel sequence
  * `writePixel(...)` -- draw pixels with a color, be sure not to draw outside the display limits.
+ * `writeSpan(...)` -- draw a horizontal line of pixels with a color, also within the display limits.
  * `endWrite()` -- to stop a pixel sequence
 
  Drawing simple functions
@@ -51,6 +54,15 @@ Therefore after completing any drawing the flush() method must be called to tran
 
 #define MAX_DISPLAY_STRING_LEN 80
 
+class DisplayOutputElement;
+
+/// @brief A horizontal line of pixels in row y from x0 to x1 including both.
+struct DisplaySpan {
+  int16_t y;
+  int16_t x0;
+  int16_t x1;
+};
+
 class DisplayAdapter {
 public:
   virtual ~DisplayAdapter() = default;
@@ -121,6 +133,21 @@ public:
     (void)color;
   };
 
+  /// @brief draw a horizontal line of pixels from x0 to x1 in row y.
+  /// Adapters should override this using a fast line function of the display driver.
+  virtual void writeSpan(int16_t y, int16_t x0, int16_t x1, uint32_t color) {
+    for (int16_t x = x0; x <= x1; x++) {
+      writePixel(x, y, color);
+    }
+  };
+
+  /// @brief draw multiple horizontal lines of pixels with the same color.
+  virtual void writeSpans(const DisplaySpan *spans, uint16_t count, uint32_t color) {
+    for (uint16_t n = 0; n < count; n++) {
+      writeSpan(spans[n].y, spans[n].x0, spans[n].x1, color);
+    }
+  };
+
   virtual void endWrite() {
     _needFlush = true;
   }
@@ -130,6 +157,16 @@ public:
   };
 
 
+  // ===== drawing using offscreen tiles =====
+
+  /// @brief Draw an element by copying its offscreen tile or render it into a new tile.
+  /// @param de The element with the cache flag set.
+  /// @return false when the element was not drawn and must be drawn directly.
+  virtual bool drawCached(DisplayOutputElement * /* de */) {
+    return (false);
+  };
+
+
   // ===== supporting deferred drawing and flushing =====
 
   // @brief remember that flush is required after sequence.
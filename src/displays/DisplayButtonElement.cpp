@@ -45,6 +45,7 @@ bool DisplayButtonElement::touchStart(int16_t xPos, int16_t yPos) {
   bool over = box.contains(xPos, yPos);
   if (over != _pressed) {
     needsDraw = true;
+    cacheValid = false;
     HomeDing::displayAdapter->setFlush();
     TRACE("touch(%d)", over);
   }
@@ -60,6 +61,7 @@ void DisplayButtonElement::touchEnd(int16_t xPos, int16_t yPos) {
   }
   _pressed = false;
   needsDraw = true;
+  cacheValid = false;
   HomeDing::displayAdapter->setFlush();
 }  // touchEnd()
 
@@ -86,6 +88,7 @@ bool DisplayButtonElement::set(const char *name, const char *value) {
   } else if (name == HomeDing::Actions::Text) {
     _text = value;
     needsDraw = true;
+    cacheValid = false;
 
   } else if (_stricmp(name, "onclick") == 0) {
     _clickAction = value;
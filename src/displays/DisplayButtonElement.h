@@ -81,7 +81,7 @@ private:
   bool _pressed;
 
   /// @brief button click event dispatched on button release.
-  String _clickAction;
+  HomeDing::Actions::ActionString _clickAction;
 
   /**
    * @brief displayed value
@@ -92,7 +92,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayButtonElement onto the ElementRegistry.
 bool DisplayButtonElement::registered =
-  ElementRegistry::registerElement("displaybutton", DisplayButtonElement::create);
+  ElementRegistry::registerElement("displaybutton", DisplayButtonElement::create, sizeof(DisplayButtonElement));
 #endif
 
 #endif
@@ -21,7 +21,7 @@
 
 #include <displays/DisplayCircleElement.h>
 
-#include <gfxDraw.h>
+#include <displays/SpanDraw.h>
 
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
@@ -42,10 +42,9 @@ void DisplayCircleElement::draw() {
   TRACE("draw(%d)", bValue);
 
   HomeDing::displayAdapter->startWrite();
-  gfxDraw::drawCircle(
-    gfxDraw::Point((_x0 + _x1) / 2, (_y0 + _y1) / 2), (_x1 - _x0) / 2,
-    HomeDing::writeColor(_strokeColor),
-    bValue ? HomeDing::writeColor(_backgroundColor) : nullptr);
+  SpanDraw::drawCircle(HomeDing::displayAdapter,
+                       (_x0 + _x1) / 2, (_y0 + _y1) / 2, (_x1 - _x0) / 2,
+                       _strokeColor, _backgroundColor, bValue);
   HomeDing::displayAdapter->endWrite();
 
 }  // draw()
@@ -14,6 +14,7 @@
  * Changelog:
  * * 29.04.2018 created by Matthias Hertel
  * * 24.06.2018 no problems when no display is available.
+ * * 18.10.2026 drawing using horizontal spans.
  */
 
 
@@ -46,7 +47,7 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayCircleElement onto the ElementRegistry.
 bool DisplayCircleElement::registered =
-  ElementRegistry::registerElement("displaycircle", DisplayCircleElement::create);
+  ElementRegistry::registerElement("displaycircle", DisplayCircleElement::create, sizeof(DisplayCircleElement));
 #endif
 
 #endif
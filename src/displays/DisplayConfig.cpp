@@ -28,6 +28,7 @@ DisplayConfig::DisplayConfig() {
   busmode = BUSMODE_ANY;
   brightness = 50;
   fontsize = -1; // not set
+  tileCache = 0;
 
   /** Default Draw & Background Color */
   drawColor = RGB_WHITE;
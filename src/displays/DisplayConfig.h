@@ -14,6 +14,7 @@
  * Changelog:
  * * 29.08.2020 created by Matthias Hertel
  * * 17.03.2022 unified HomeDing::DisplayConfig
+ * * 18.10.2026 memory budget for offscreen tiles.
  */
 
 #pragma once
@@ -74,6 +75,9 @@ public:
   /// @brief Size of default font used at startup.
   int fontsize;
 
+  /// @brief Memory in bytes for offscreen tiles of cached display elements, 0 = no caching.
+  uint32_t tileCache;
+
   // bus configurations for any bus
 
   int32_t busSpeed = -1;  // speed
@@ -44,7 +44,7 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayESP32PanelElement onto the ElementRegistry.
 bool DisplayESP32PanelElement::registered =
-  ElementRegistry::registerElement("displayesp32panel", DisplayESP32PanelElement::create);
+  ElementRegistry::registerElement("displayesp32panel", DisplayESP32PanelElement::create, sizeof(DisplayESP32PanelElement));
 #endif
 
 #endif
\ No newline at end of file
@@ -216,6 +216,9 @@ bool DisplayElement::set(const char *name, const char *value) {
   } else if (name == HomeDing::Actions::FontSize) {
     displayConfig.fontsize = value_int;
 
+  } else if (_stricmp(name, "tilecache") == 0) {
+    displayConfig.tileCache = value_int;
+
   } else if (name == HomeDing::Actions::Width) {
     displayConfig.width = value_int;
 
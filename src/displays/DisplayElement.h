@@ -14,6 +14,7 @@
  * Changelog:
  * * 29.08.2020 created by Matthias Hertel
  * * 17.03.2022 unified HomeDing::DisplayConfig
+ * * 18.10.2026 tilecache setting.
  */
 
 #pragma once
@@ -52,5 +52,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayGC9A01Element onto the ElementRegistry.
 bool DisplayGC9A01Element::registered =
-  ElementRegistry::registerElement("DisplayGC9A01", DisplayGC9A01Element::create);
+  ElementRegistry::registerElement("DisplayGC9A01", DisplayGC9A01Element::create, sizeof(DisplayGC9A01Element));
 #endif
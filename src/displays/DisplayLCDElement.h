@@ -53,5 +53,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayLCDElement onto the ElementRegistry.
 bool DisplayLCDElement::registered =
-  ElementRegistry::registerElement("displayLCD", DisplayLCDElement::create);
+  ElementRegistry::registerElement("displayLCD", DisplayLCDElement::create, sizeof(DisplayLCDElement));
 #endif
@@ -21,8 +21,7 @@
 
 #include <displays/DisplayLineElement.h>
 
-#include <gfxDraw.h>
-#include "DisplayLineElement.h"
+#include <displays/SpanDraw.h>
 
 #ifndef GFX_TRACE
 #define GFX_TRACE(...)  // GFXDRAWTRACE(__VA_ARGS__)
@@ -44,12 +43,12 @@ void DisplayLineElement::start() {
 }
 
 
-/// @brief Draw the line by using gfxDraw functions.
+/// @brief Draw the line by using SpanDraw functions.
 void DisplayLineElement::draw() {
   GFX_TRACE("draw(%d/%d - %d/%d)\n", _x0, _y0, _x1, _y1);
 
   HomeDing::displayAdapter->startWrite();
-  gfxDraw::drawLine(_x0, _y0, _x1, _y1, HomeDing::writeColor(_strokeColor));
+  SpanDraw::drawLine(HomeDing::displayAdapter, _x0, _y0, _x1, _y1, _strokeColor);
   HomeDing::displayAdapter->endWrite();
 }  // draw()
 
@@ -14,6 +14,7 @@
  * Changelog:
  * * 29.04.2018 created by Matthias Hertel
  * * 24.06.2018 no problems when no display is available.
+ * * 18.10.2026 drawing using horizontal spans.
  */
 
 
@@ -59,7 +60,7 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayLineElement onto the ElementRegistry.
 bool DisplayLineElement::registered =
-  ElementRegistry::registerElement("displayline", DisplayLineElement::create);
+  ElementRegistry::registerElement("displayline", DisplayLineElement::create, sizeof(DisplayLineElement));
 #endif
 
 #endif
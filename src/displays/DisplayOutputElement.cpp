@@ -20,6 +20,8 @@
 
 #define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
+uint32_t DisplayOutputElement::layoutVersion = 0;
+
 DisplayOutputElement::DisplayOutputElement() {
   category = CATEGORY::Widget;  // no loop
 
@@ -89,8 +91,14 @@ bool DisplayOutputElement::set(const char *name, const char *value) {
     // these properties can be used for configuration only.
 
     if (_stricmp(name, "page") == 0) {
+      if (iValue != page) {
+        layoutVersion++;
+      }
       page = iValue;
 
+    } else if (_stricmp(name, "cache") == 0) {
+      cache = _atob(value);
+
     } else {
       ret = false;
     }  // if
@@ -100,8 +108,15 @@ bool DisplayOutputElement::set(const char *name, const char *value) {
   }  // if
 
   if (ret) {
-    box = BoundingBox(_x0, _y0, _x1, _y1);
+    BoundingBox b(_x0, _y0, _x1, _y1);
+    if ((b.x_min != box.x_min) || (b.y_min != box.y_min) || (b.x_max != box.x_max) || (b.y_max != box.y_max)) {
+      layoutVersion++;
+    }
+    box = b;
     needsDraw = true;
+    if (name != HomeDing::Actions::Redraw) {
+      cacheValid = false;
+    }
     TRACE("box= %d/%d - %d/%d", box.x_min, box.y_min, box.x_max, box.y_max);
   }
 
@@ -126,6 +141,7 @@ void DisplayOutputElement::start() {
     }
 
     Element::start();
+    layoutVersion++;
     needsDraw = true;
     HomeDing::displayAdapter->setFlush();
   }
@@ -14,6 +14,8 @@
  * * 26.01.2024 force redraw on attribute changes
  * * 20.02.2024 added common value handling
  * * 19.11.2024 use global HomeDing::displayAdapter
+ * * 18.10.2026 optional caching of the drawn element in an offscreen tile
+ * * 18.10.2026 layoutVersion to detect changed positions of elements
  */
 
 
@@ -74,6 +76,15 @@ public:
   /// The DisplayOutputElement will draw it's local background usually.
   bool isOpaque = false;
 
+  /// @brief cache is true when the drawn element can be kept in an offscreen tile of the display adapter.
+  bool cache = false;
+
+  /// @brief cacheValid is false when the content of the element has changed since it was cached.
+  bool cacheValid = false;
+
+  /// @brief layoutVersion is incremented whenever an element is started or changes its position or page.
+  static uint32_t layoutVersion;
+
 protected:
   /**
    * @brief This variable corresponds to the x0 parameter.
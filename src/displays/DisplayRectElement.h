@@ -49,7 +49,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayRectElement onto the ElementRegistry.
 bool DisplayRectElement::registered =
-  ElementRegistry::registerElement("displayrect", DisplayRectElement::create);
+  ElementRegistry::registerElement("displayrect", DisplayRectElement::create, sizeof(DisplayRectElement));
 #endif
 
 #endif
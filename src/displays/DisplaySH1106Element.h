@@ -52,6 +52,5 @@ public:
 
 #ifdef HOMEDING_REGISTER
 // Register the DisplaySH1106Element onto the ElementRegistry.
-bool DisplaySH1106Element::registered = ElementRegistry::registerElement(
-  "displaySH1106", DisplaySH1106Element::create);
+bool DisplaySH1106Element::registered = ElementRegistry::registerElement("displaySH1106", DisplaySH1106Element::create, sizeof(DisplaySH1106Element));
 #endif
@@ -42,5 +42,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayST7701Element onto the ElementRegistry.
 bool DisplayST7701Element::registered =
-  ElementRegistry::registerElement("displayst7701", DisplayST7701Element::create);
+  ElementRegistry::registerElement("displayst7701", DisplayST7701Element::create, sizeof(DisplayST7701Element));
 #endif
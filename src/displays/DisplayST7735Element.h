@@ -39,5 +39,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayST7735Element onto the ElementRegistry.
 bool DisplayST7735Element::registered =
-  ElementRegistry::registerElement("DisplayST7735", DisplayST7735Element::create);
+  ElementRegistry::registerElement("DisplayST7735", DisplayST7735Element::create, sizeof(DisplayST7735Element));
 #endif
@@ -52,5 +52,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayST7789Element onto the ElementRegistry.
 bool DisplayST7789Element::registered =
-  ElementRegistry::registerElement("DisplayST7789", DisplayST7789Element::create);
+  ElementRegistry::registerElement("DisplayST7789", DisplayST7789Element::create, sizeof(DisplayST7789Element));
 #endif
@@ -40,5 +40,5 @@ public:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayST7796Element onto the ElementRegistry.
 bool DisplayST7796Element::registered =
-  ElementRegistry::registerElement("displayst7796", DisplayST7796Element::create);
+  ElementRegistry::registerElement("displayst7796", DisplayST7796Element::create, sizeof(DisplayST7796Element));
 #endif
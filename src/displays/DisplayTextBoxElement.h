@@ -76,7 +76,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayTextBoxElement onto the ElementRegistry.
 bool DisplayTextBoxElement::registered =
-    ElementRegistry::registerElement("displaytextbox", DisplayTextBoxElement::create);
+    ElementRegistry::registerElement("displaytextbox", DisplayTextBoxElement::create, sizeof(DisplayTextBoxElement));
 #endif
 
 #endif
@@ -41,9 +41,11 @@ bool DisplayTextElement::set(const char *name, const char *value) {
 
   } else if (_stricmp(name, "prefix") == 0) {
     _prefix = value;
+    cacheValid = false;
 
   } else if (_stricmp(name, "postfix") == 0) {
     _postfix = value;
+    cacheValid = false;
 
   } else {
     ret = false;
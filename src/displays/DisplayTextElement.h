@@ -74,5 +74,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayTextElement onto the ElementRegistry.
 bool DisplayTextElement::registered =
-    ElementRegistry::registerElement("displaytext", DisplayTextElement::create);
+    ElementRegistry::registerElement("displaytext", DisplayTextElement::create, sizeof(DisplayTextElement));
 #endif
@@ -53,7 +53,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayTouchCST816Element onto the ElementRegistry.
 bool DisplayTouchCST816Element::registered =
-  ElementRegistry::registerElement("displaytouchcst816", DisplayTouchCST816Element::create);
+  ElementRegistry::registerElement("displaytouchcst816", DisplayTouchCST816Element::create, sizeof(DisplayTouchCST816Element));
 #endif
 
 #endif
@@ -26,6 +26,107 @@
 
 /* ===== Private functions ===== */
 
+// remember the signal from the touch controller to read the new data in the next loop.
+IRAM_ATTR void DisplayTouchElement::_onInterrupt(void *arg) {
+  ((DisplayTouchElement *)arg)->_signaled = true;
+}  // _onInterrupt()
+
+
+/// @brief Build the grid index of the buttons on the current page.
+void DisplayTouchElement::_buildIndex() {
+  DisplayAdapter *da = HomeDing::displayAdapter;
+
+  _indexPage = da->page;
+  _indexVersion = DisplayOutputElement::layoutVersion;
+  _buttons.clear();
+  memset(_cells, 0, sizeof(_cells));
+
+  // the displayBox holds width and height in x_max and y_max.
+  _cellWidth = max(1, (da->displayBox.x_max + TOUCH_GRID - 1) / TOUCH_GRID);
+  _cellHeight = max(1, (da->displayBox.y_max + TOUCH_GRID - 1) / TOUCH_GRID);
+
+  _board->forEach(CATEGORY::Widget, [this](Element *e) {
+    if (Element::_stristartswith(e->id, "displaybutton/")) {
+      DisplayButtonElement *be = (DisplayButtonElement *)e;
+
+      if (be->page == _indexPage) {
+        if (_buttons.size() < 32) {
+          // mark all cells covered by the button
+          uint32_t bit = 1UL << _buttons.size();
+          int cx0 = constrain(be->box.x_min / _cellWidth, 0, TOUCH_GRID - 1);
+          int cx1 = constrain(be->box.x_max / _cellWidth, 0, TOUCH_GRID - 1);
+          int cy0 = constrain(be->box.y_min / _cellHeight, 0, TOUCH_GRID - 1);
+          int cy1 = constrain(be->box.y_max / _cellHeight, 0, TOUCH_GRID - 1);
+
+          for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+              _cells[cy * TOUCH_GRID + cx] |= bit;
+            }
+          }
+        }
+        _buttons.push_back(be);
+      }
+    }
+  });
+  TRACE("index page=%d buttons=%d", _indexPage, _buttons.size());
+}  // _buildIndex()
+
+
+/// @brief Send the action of a recognized gesture.
+bool DisplayTouchElement::_dispatchGesture(TouchGesture::GESTURE g) {
+  bool ret = false;
+
+  if ((g != TouchGesture::None) && (!_gestureAction[g].isEmpty())) {
+    int v = 0;
+    if (g == TouchGesture::Pinch) {
+      v = _gesture.scale;
+    } else if ((g == TouchGesture::SwipeLeft) || (g == TouchGesture::SwipeRight)) {
+      v = abs(_gesture.velocityX);
+    } else if ((g == TouchGesture::SwipeUp) || (g == TouchGesture::SwipeDown)) {
+      v = abs(_gesture.velocityY);
+    }
+    TRACE("gesture %d (%d)", g, v);
+    HomeDing::Actions::push(_gestureAction[g], v);
+    ret = true;
+  }
+  return (ret);
+}  // _dispatchGesture()
+
+
+/// @brief Find the button at the given position.
+DisplayButtonElement *DisplayTouchElement::_findButton(int16_t x, int16_t y) {
+  DisplayAdapter *da = HomeDing::displayAdapter;
+  DisplayButtonElement *found = nullptr;
+
+  if (da) {
+    if ((da->page != _indexPage) || (DisplayOutputElement::layoutVersion != _indexVersion)) {
+      _buildIndex();
+    }
+
+    if ((x >= 0) && (y >= 0) && (x / _cellWidth < TOUCH_GRID) && (y / _cellHeight < TOUCH_GRID)) {
+      uint32_t mask = _cells[(y / _cellHeight) * TOUCH_GRID + (x / _cellWidth)];
+
+      while ((!found) && (mask)) {
+        DisplayButtonElement *be = _buttons[__builtin_ctz(mask)];
+        if ((be->active) && (be->box.contains(x, y))) {
+          found = be;
+        }
+        mask &= mask - 1;  // clear lowest bit
+      }
+    }
+
+    // buttons not in the grid are checked one by one.
+    for (size_t n = 32; (!found) && (n < _buttons.size()); n++) {
+      DisplayButtonElement *be = _buttons[n];
+      if ((be->active) && (be->box.contains(x, y))) {
+        found = be;
+      }
+    }
+  }
+  return (found);
+}  // _findButton()
+
+
 /* ===== Element functions ===== */
 
 DisplayTouchElement::DisplayTouchElement() {
@@ -76,6 +177,24 @@ bool DisplayTouchElement::set(const char *name, const char *value) {
   } else if (_stricmp(name, "ontouch") == 0) {
     _touchAction = value;
 
+  } else if (_stricmp(name, "onswipeleft") == 0) {
+    _gestureAction[TouchGesture::SwipeLeft] = value;
+
+  } else if (_stricmp(name, "onswiperight") == 0) {
+    _gestureAction[TouchGesture::SwipeRight] = value;
+
+  } else if (_stricmp(name, "onswipeup") == 0) {
+    _gestureAction[TouchGesture::SwipeUp] = value;
+
+  } else if (_stricmp(name, "onswipedown") == 0) {
+    _gestureAction[TouchGesture::SwipeDown] = value;
+
+  } else if (_stricmp(name, "onlongpress") == 0) {
+    _gestureAction[TouchGesture::LongPress] = value;
+
+  } else if (_stricmp(name, "onpinch") == 0) {
+    _gestureAction[TouchGesture::Pinch] = value;
+
   } else {
     ret = false;
   }  // if
@@ -108,15 +227,37 @@ void DisplayTouchElement::start() {
   nextRead = millis() + 50;
   _bFound = nullptr;
   _isTouched = false;
+  _indexPage = -1;
+
+  if (_interruptPin >= 0) {
+    // the touch controller signals new data on the interrupt pin
+    pinMode(_interruptPin, INPUT_PULLUP);
+    _signaled = true;
+    attachInterruptArg(digitalPinToInterrupt(_interruptPin), DisplayTouchElement::_onInterrupt, this, CHANGE);
+  }
 }  // start()
 
 
+/// @brief stop all activities and go inactive.
+void DisplayTouchElement::term() {
+  if (active && (_interruptPin >= 0)) {
+    detachInterrupt(digitalPinToInterrupt(_interruptPin));
+  }
+  Element::term();
+}  // term()
+
+
 /// @brief Poll the touch controller for touch points
 void DisplayTouchElement::loop() {
   Element::loop();
   unsigned long now = millis();
 
-  if (now > nextRead) {
+  if ((_interruptPin >= 0) && (!_signaled) && (!_isTouched) && (!_bFound) && (!_gesture.isActive())) {
+    // no new data signaled by the touch controller.
+
+  } else if (now > nextRead) {
+    _signaled = false;
+    _spread = 0;
 
     if (pullSensorData()) {
       // got lastX and lastY
@@ -148,18 +289,21 @@ void DisplayTouchElement::loop() {
       }
       _isTouched = true;
 
+      if (!_gesture.isActive()) {
+        _gestureSent = false;
+      }
+      if (_dispatchGesture(_gesture.add(now, lastX, lastY, _spread))) {
+        _gestureSent = true;
+      }
+
       // as of now only interested in the first.
       TRACE(" touch %d/%d", lastX, lastY);
       if (!_bFound) {
-        // find displaybutton at x/y
-        _board->forEach(CATEGORY::Widget, [this](Element *e) {
-          if ((!_bFound) && (Element::_stristartswith(e->id, "displaybutton/"))) {
-            DisplayButtonElement *be = (DisplayButtonElement *)e;
-            if (be->touchStart(lastX, lastY)) {
-              _bFound = be;
-            }
-          }
-        });
+        // find displaybutton at x/y on the current page
+        DisplayButtonElement *be = _findButton(lastX, lastY);
+        if ((be) && (be->touchStart(lastX, lastY))) {
+          _bFound = be;
+        }
 
       } else {
         bool over = _bFound->touchStart(lastX, lastY);
@@ -170,16 +314,25 @@ void DisplayTouchElement::loop() {
       }
 
     } else {
+      if ((_gesture.isActive()) && (_dispatchGesture(_gesture.end()))) {
+        _gestureSent = true;
+      }
+
       if (_bFound) {
         TRACE("-end");
-        // call touchEnd to found button
-        _bFound->touchEnd(lastX, lastY);
+        // call touchEnd to found button, a handled gesture is not a click.
+        if (_gestureSent) {
+          _bFound->touchEnd(-1, -1);
+        } else {
+          _bFound->touchEnd(lastX, lastY);
+        }
         _bFound = nullptr;
       }  // if
       _isTouched = false;
     }  // if
 
-    nextRead = millis() + 50;
+    // sample faster while touched to follow gestures.
+    nextRead = millis() + (_gesture.isActive() ? 20 : 50);
   }
 }  // loop()
 
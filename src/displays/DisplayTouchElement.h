@@ -13,6 +13,8 @@
  * * 25.10.2023 created
  * * 17.11.2023 rotation support
  * * 14.01.2024 use default width and height from the display.
+ * * 18.10.2026 grid index of the buttons on the current page and reading on interrupt.
+ * * 18.10.2026 swipe, long press and pinch gestures.
  */
 
 #pragma once
@@ -20,6 +22,12 @@
 #if defined(ESP32)
 
 #include <displays/DisplayButtonElement.h>
+#include <displays/TouchGesture.h>
+
+#include <vector>
+
+/// @brief number of grid cells in each direction used to find the buttons.
+#define TOUCH_GRID 8
 
 /**
  * @brief
@@ -58,6 +66,9 @@ public:
    */
   virtual void loop() override;
 
+  /// @brief stop all activities and go inactive.
+  virtual void term() override;
+
 protected:
   // Configuration Properties
 
@@ -82,16 +93,58 @@ protected:
   // position of last touch event
   int16_t lastX, lastY;
 
+  /// @brief distance between the first two touch points or 0 when only one point is touched.
+  uint16_t _spread;
+
   /// Any touch event
   bool _isTouched;
 
   /// Any touch event
-  String _touchAction;
+  HomeDing::Actions::ActionString _touchAction;
 
   // found button at first touch position
   DisplayButtonElement *_bFound;
 
   unsigned long nextRead;
+
+  /// @brief The touch controller signaled new data by the interrupt pin.
+  volatile bool _signaled = false;
+
+  /// @brief Interrupt routine of the interrupt pin.
+  static void _onInterrupt(void *arg);
+
+private:
+  /// @brief recognize gestures from the touch samples.
+  TouchGesture _gesture;
+
+  /// @brief actions for the recognized gestures.
+  HomeDing::Actions::ActionString _gestureAction[TouchGesture::Pinch + 1];
+
+  /// @brief a gesture action was sent during the current touch.
+  bool _gestureSent = false;
+
+  /// @brief Send the action of a recognized gesture.
+  /// @return true when an action is configured for the gesture.
+  bool _dispatchGesture(TouchGesture::GESTURE g);
+
+  /// @brief buttons on the indexed page.
+  std::vector<DisplayButtonElement *> _buttons;
+
+  /// @brief bitmask of the buttons in _buttons[0...31] overlapping each grid cell.
+  uint32_t _cells[TOUCH_GRID * TOUCH_GRID];
+
+  /// @brief size of a grid cell.
+  int16_t _cellWidth, _cellHeight;
+
+  /// @brief page and layoutVersion of the current index.
+  int _indexPage = -1;
+  uint32_t _indexVersion = 0;
+
+  /// @brief Build the grid index of the buttons on the current page.
+  void _buildIndex();
+
+  /// @brief Find the button at the given position.
+  DisplayButtonElement *_findButton(int16_t x, int16_t y);
 };
 
 #endif
@@ -41,13 +41,19 @@ bool DisplayTouchFT6336Element::pullSensorData() {
   if (_found) {
     uint8_t registers[15];  // 0..E
 
-    WireUtils::readBuffer(I2C_ADDR, 0, registers, 7);
+    WireUtils::readBuffer(I2C_ADDR, 0, registers, 13);
 
-    int count = registers[2];
+    int count = registers[2] & 0x0F;
 
     if (count > 0) {
       lastX = ((registers[3] & 0x0F) << 8) + registers[4];
       lastY = ((registers[5] & 0x0F) << 8) + registers[6];
+      if (count > 1) {
+        // second touch point in registers 9..C
+        int16_t x2 = ((registers[9] & 0x0F) << 8) + registers[10];
+        int16_t y2 = ((registers[11] & 0x0F) << 8) + registers[12];
+        _spread = TouchGesture::spread(lastX, lastY, x2, y2);
+      }
       return (true);
     }
   }
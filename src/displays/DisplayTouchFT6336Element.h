@@ -12,6 +12,7 @@
  *
  * Changelog:
  * * 27.05.2023 created
+ * * 18.10.2026 report the distance of a second touch point.
  */
 
 #pragma once
@@ -51,7 +52,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DisplayTouchFT6336Element onto the ElementRegistry.
 bool DisplayTouchFT6336Element::registered =
-  ElementRegistry::registerElement("displaytouchft6336", DisplayTouchFT6336Element::create);
+  ElementRegistry::registerElement("displaytouchft6336", DisplayTouchFT6336Element::create, sizeof(DisplayTouchFT6336Element));
 #endif
 
 #endif
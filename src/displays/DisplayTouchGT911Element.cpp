@@ -40,9 +40,11 @@ bool DisplayTouchGT911Element::pullSensorData() {
   uint8_t count = tp->getTouchPoints(points);
 
   if (count > 0) {
-    // as of now only interested in the first.
     lastX = points[0].x;
     lastY = points[0].y;
+    if (count > 1) {
+      _spread = TouchGesture::spread(points[0].x, points[0].y, points[1].x, points[1].y);
+    }
     return (true);
   } else {
     return (false);
@@ -13,6 +13,7 @@
  *
  * Changelog:
  * * 27.05.2023 created
+ * * 18.10.2026 report the distance of a second touch point.
  */
 
 #pragma once
@@ -56,7 +57,7 @@ public:
  #ifdef HOMEDING_REGISTER
 // Register the DisplayTouchGT911Element onto the ElementRegistry.
 bool DisplayTouchGT911Element::registered =
-  ElementRegistry::registerElement("displaytouchgt911", DisplayTouchGT911Element::create);
+  ElementRegistry::registerElement("displaytouchgt911", DisplayTouchGT911Element::create, sizeof(DisplayTouchGT911Element));
 #endif
 
 #endif
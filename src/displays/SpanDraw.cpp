@@ -0,0 +1,397 @@
+/**
+ * @file SpanDraw.cpp
+ *
+ * @brief Drawing functions for the DisplayOutputElements that rasterize primitives
+ * into horizontal spans of pixels.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * See https://www.mathertel.de/License.aspx.
+ *
+ * Changelog: see SpanDraw.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <displays/SpanDraw.h>
+
+#include <vector>
+
+namespace SpanDraw {
+
+/// @brief Collect spans of one color clipped to the display and pass them in batches to the adapter.
+class SpanBuffer {
+public:
+  SpanBuffer(DisplayAdapter *da, uint32_t color) {
+    _da = da;
+    _color = color;
+    // the displayBox holds width and height in x_max and y_max.
+    _width = da->displayBox.x_max;
+    _height = da->displayBox.y_max;
+  }
+
+  ~SpanBuffer() {
+    flush();
+  }
+
+  void add(int16_t y, int16_t x0, int16_t x1) {
+    if (x0 > x1) {
+      int16_t t = x0;
+      x0 = x1;
+      x1 = t;
+    }
+    if ((y < 0) || (y >= _height) || (x1 < 0) || (x0 >= _width)) {
+      return;  // not visible
+    }
+    if (x0 < 0) x0 = 0;
+    if (x1 >= _width) x1 = _width - 1;
+
+    if (_count == SPANDRAW_BATCH) {
+      flush();
+    }
+    _spans[_count++] = { y, x0, x1 };
+  }
+
+  void flush() {
+    if (_count) {
+      _da->writeSpans(_spans, _count, _color);
+      _count = 0;
+    }
+  }
+
+private:
+  DisplayAdapter *_da;
+  uint32_t _color;
+  int16_t _width;
+  int16_t _height;
+  DisplaySpan _spans[SPANDRAW_BATCH];
+  uint16_t _count = 0;
+};
+
+
+// integer square root.
+static int32_t _isqrt(int32_t v) {
+  int32_t res = 0;
+  int32_t bit = 1L << 30;
+
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (res);
+}  // _isqrt()
+
+
+// half width of a circle row dy from the center or -1 when outside.
+// Using r*r + r gives the same shape as the midpoint circle algorithm.
+static int16_t _extent(int32_t r, int32_t dy) {
+  int32_t v = (r * r) + r - (dy * dy);
+  return ((r < 0) || (v < 0) ? -1 : _isqrt(v));
+}  // _extent()
+
+
+void drawCircle(DisplayAdapter *da, int16_t cx, int16_t cy, int16_t r, uint32_t stroke, uint32_t fill, bool useFill) {
+  SpanBuffer s(da, stroke);
+  SpanBuffer f(da, fill);
+
+  for (int16_t dy = -r; dy <= r; dy++) {
+    int16_t y = cy + dy;
+    int16_t xo = _extent(r, dy);
+    int16_t xi = _extent(r - 1, dy);
+
+    if (xi < 0) {
+      // row is not part of the inner area.
+      s.add(y, cx - xo, cx + xo);
+
+    } else {
+      // the outline has at least 1 pixel on both sides.
+      int16_t e = (xi < xo) ? xi + 1 : xo;
+      s.add(y, cx - xo, cx - e);
+      if (e > 0) {
+        s.add(y, cx + e, cx + xo);
+        if ((useFill) && (e > 1)) {
+          f.add(y, cx - e + 1, cx + e - 1);
+        }
+      }
+    }
+  }
+}  // drawCircle()
+
+
+void fillCircle(DisplayAdapter *da, int16_t cx, int16_t cy, int16_t r, uint32_t color) {
+  SpanBuffer s(da, color);
+
+  for (int16_t dy = -r; dy <= r; dy++) {
+    int16_t xo = _extent(r, dy);
+    s.add(cy + dy, cx - xo, cx + xo);
+  }
+}  // fillCircle()
+
+
+void drawLine(DisplayAdapter *da, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color) {
+  SpanBuffer s(da, color);
+
+  // Bresenham algorithm collecting the pixels in the same row.
+  int16_t dx = abs(x1 - x0);
+  int16_t sx = (x0 < x1) ? 1 : -1;
+  int16_t dy = -abs(y1 - y0);
+  int16_t sy = (y0 < y1) ? 1 : -1;
+  int32_t err = dx + dy;
+  int16_t runStart = x0;
+
+  while ((x0 != x1) || (y0 != y1)) {
+    int32_t e2 = 2 * err;
+    int16_t px = x0;
+
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      s.add(y0, runStart, px);
+      y0 += sy;
+      runStart = x0;
+    }
+  }
+  s.add(y0, runStart, x0);
+}  // drawLine()
+
+
+void drawThickLine(DisplayAdapter *da, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t width, uint32_t color) {
+  if (width <= 1) {
+    drawLine(da, x0, y0, x1, y1, color);
+
+  } else {
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float len = sqrtf(dx * dx + dy * dy);
+
+    if (len == 0) {
+      fillCircle(da, x0, y0, width / 2, color);
+
+    } else {
+      // normal vector with half of the width
+      float nx = -dy * width / (2 * len);
+      float ny = dx * width / (2 * len);
+
+      int16_t xy[8] = {
+        (int16_t)lroundf(x0 + nx), (int16_t)lroundf(y0 + ny),
+        (int16_t)lroundf(x1 + nx), (int16_t)lroundf(y1 + ny),
+        (int16_t)lroundf(x1 - nx), (int16_t)lroundf(y1 - ny),
+        (int16_t)lroundf(x0 - nx), (int16_t)lroundf(y0 - ny)
+      };
+      fillPolygon(da, xy, 4, color);
+    }
+  }
+}  // drawThickLine()
+
+
+void fillPolygon(DisplayAdapter *da, const int16_t *xy, uint16_t count, uint32_t color) {
+  if ((count < 3) || (count > SPANDRAW_MAX_POINTS)) {
+    return;
+  }
+
+  SpanBuffer s(da, color);
+  int16_t nodes[SPANDRAW_MAX_POINTS];
+  int16_t yMin = xy[1];
+  int16_t yMax = xy[1];
+
+  for (uint16_t i = 1; i < count; i++) {
+    yMin = min(yMin, xy[2 * i + 1]);
+    yMax = max(yMax, xy[2 * i + 1]);
+  }
+
+  for (int16_t y = yMin; y <= yMax; y++) {
+    // find the crossings of all edges with the center of the row (y + 0.5).
+    int32_t yc2 = 2 * y + 1;
+    uint16_t n = 0;
+
+    for (uint16_t i = 0, j = count - 1; i < count; j = i++) {
+      int32_t xi = xy[2 * i], yi = xy[2 * i + 1];
+      int32_t xj = xy[2 * j], yj = xy[2 * j + 1];
+
+      if (((2 * yi) < yc2) != ((2 * yj) < yc2)) {
+        nodes[n++] = xi + ((yc2 - 2 * yi) * (xj - xi)) / (2 * (yj - yi));
+      }
+    }
+
+    // sort the crossings, there are only a few.
+    for (uint16_t i = 1; i < n; i++) {
+      int16_t v = nodes[i];
+      uint16_t k = i;
+      while ((k > 0) && (nodes[k - 1] > v)) {
+        nodes[k] = nodes[k - 1];
+        k--;
+      }
+      nodes[k] = v;
+    }
+
+    for (uint16_t i = 0; i + 1 < n; i += 2) {
+      s.add(y, nodes[i], nodes[i + 1]);
+    }
+  }
+}  // fillPolygon()
+
+
+// blend 2 colors, alpha in range 0...64.
+static uint32_t _blend(uint32_t color, uint32_t background, uint16_t alpha) {
+  uint32_t res = 0;
+  for (int shift = 0; shift < 24; shift += 8) {
+    uint32_t c = (color >> shift) & 0xFF;
+    uint32_t b = (background >> shift) & 0xFF;
+    res |= (((c * alpha) + (b * (64 - alpha)) + 32) >> 6) << shift;
+  }
+  return (res);
+}  // _blend()
+
+
+void fillPolygonAA(DisplayAdapter *da, const int16_t *xy, uint16_t count, uint32_t color, uint32_t background) {
+  // 4 rows of samples per pixel with SPANDRAW_SUBPIXEL horizontal resolution
+  // result in a coverage of 0...64 per pixel.
+  const int16_t SUB = SPANDRAW_SUBPIXEL;
+  static_assert(SPANDRAW_SUBPIXEL == 16, "pixel positions are calculated using >> 4");
+
+  if ((count < 3) || (count > SPANDRAW_MAX_POINTS)) {
+    return;
+  }
+
+  int16_t xMin = xy[0], xMax = xy[0];
+  int16_t yMin = xy[1], yMax = xy[1];
+  for (uint16_t i = 1; i < count; i++) {
+    xMin = min(xMin, xy[2 * i]);
+    xMax = max(xMax, xy[2 * i]);
+    yMin = min(yMin, xy[2 * i + 1]);
+    yMax = max(yMax, xy[2 * i + 1]);
+  }
+
+  int16_t px0 = (xMin >> 4);
+  int16_t width = (xMax >> 4) - px0 + 1;
+  int16_t dWidth = da->displayBox.x_max;
+  int16_t dHeight = da->displayBox.y_max;
+
+  SpanBuffer s(da, color);
+  std::vector<uint8_t> cover(width);
+  int16_t nodes[SPANDRAW_MAX_POINTS];
+
+  for (int16_t y = (yMin >> 4); y <= (yMax >> 4); y++) {
+    std::fill(cover.begin(), cover.end(), 0);
+
+    for (int16_t sub = 0; sub < 4; sub++) {
+      int32_t yc = (y * SUB) + (sub * SUB / 4) + (SUB / 8);
+      uint16_t n = 0;
+
+      for (uint16_t i = 0, j = count - 1; i < count; j = i++) {
+        int32_t xi = xy[2 * i], yi = xy[2 * i + 1];
+        int32_t xj = xy[2 * j], yj = xy[2 * j + 1];
+
+        if ((yi < yc) != (yj < yc)) {
+          nodes[n++] = xi + ((yc - yi) * (xj - xi)) / (yj - yi);
+        }
+      }
+
+      for (uint16_t i = 1; i < n; i++) {
+        int16_t v = nodes[i];
+        uint16_t k = i;
+        while ((k > 0) && (nodes[k - 1] > v)) {
+          nodes[k] = nodes[k - 1];
+          k--;
+        }
+        nodes[k] = v;
+      }
+
+      // add the covered part of every pixel in the range [a, b).
+      for (uint16_t i = 0; i + 1 < n; i += 2) {
+        int16_t a = nodes[i];
+        int16_t b = nodes[i + 1];
+        for (int16_t px = (a >> 4); (px * SUB) < b; px++) {
+          int16_t c = std::min<int16_t>(b, (px + 1) * SUB) - std::max<int16_t>(a, px * SUB);
+          cover[px - px0] += c;
+        }
+      }
+    }
+
+    // fully covered pixels are passed as spans, edge pixels are blended.
+    int16_t runStart = -1;
+    for (int16_t i = 0; i <= width; i++) {
+      uint8_t c = (i < width) ? cover[i] : 0;
+      int16_t px = px0 + i;
+
+      if (c >= 4 * SUB) {
+        if (runStart < 0) runStart = px;
+        continue;
+      }
+      if (runStart >= 0) {
+        s.add(y, runStart, px - 1);
+        runStart = -1;
+      }
+      if ((c > 0) && (px >= 0) && (px < dWidth) && (y >= 0) && (y < dHeight)) {
+        da->writeSpan(y, px, px, _blend(color, background, c));
+      }
+    }
+  }
+}  // fillPolygonAA()
+
+
+// ===== PixelSpans
+
+PixelSpans::PixelSpans(DisplayAdapter *da) {
+  _da = da;
+  _width = da->displayBox.x_max;
+  _height = da->displayBox.y_max;
+}
+
+
+PixelSpans::~PixelSpans() {
+  flush();
+}
+
+
+void PixelSpans::add(int16_t x, int16_t y, uint32_t color) {
+  if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) {
+    return;  // not visible
+  }
+
+  if ((_count) && (color == _color)) {
+    DisplaySpan &last = _spans[_count - 1];
+    if (last.y == y) {
+      if (x == last.x1 + 1) {
+        last.x1 = x;
+        return;
+      } else if (x == last.x0 - 1) {
+        last.x0 = x;
+        return;
+      } else if ((x >= last.x0) && (x <= last.x1)) {
+        return;  // pixel already drawn
+      }
+    }
+  }
+
+  if ((_count == SPANDRAW_BATCH) || ((_count) && (color != _color))) {
+    flush();
+  }
+  _color = color;
+  _spans[_count++] = { y, x, x };
+}  // add()
+
+
+void PixelSpans::flush() {
+  if (_count) {
+    _da->writeSpans(_spans, _count, _color);
+    _count = 0;
+  }
+}  // flush()
+
+}  // namespace SpanDraw
+
+// End
@@ -0,0 +1,104 @@
+/**
+ * @file SpanDraw.h
+ *
+ * @brief Drawing functions for the DisplayOutputElements that rasterize primitives
+ * into horizontal spans of pixels.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * See https://www.mathertel.de/License.aspx.
+ * More information on https://www.mathertel.de/Arduino
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+The functions collect the horizontal spans of a primitive clipped to the display
+and pass them in batches to DisplayAdapter::writeSpans() instead of calling writePixel
+for every single pixel.
+
+The functions must be used between startWrite() and endWrite() of the adapter.
+@endverbatim
+ */
+
+#pragma once
+
+#include <displays/DisplayAdapter.h>
+
+/// @brief max. number of points in a polygon.
+#define SPANDRAW_MAX_POINTS 16
+
+/// @brief number of spans collected before passing them to the adapter.
+#define SPANDRAW_BATCH 32
+
+/// @brief subpixel resolution of the coordinates of antialiased polygons.
+#define SPANDRAW_SUBPIXEL 16
+
+namespace SpanDraw {
+
+/// @brief Draw a circle with a stroke color and an optional fill color.
+/// @param da the display adapter.
+/// @param cx x coordinate of the center.
+/// @param cy y coordinate of the center.
+/// @param r radius.
+/// @param stroke color of the outline.
+/// @param fill color of the inner area.
+/// @param useFill true to fill the inner area.
+void drawCircle(DisplayAdapter *da, int16_t cx, int16_t cy, int16_t r, uint32_t stroke, uint32_t fill, bool useFill);
+
+/// @brief Fill a circle with a color.
+void fillCircle(DisplayAdapter *da, int16_t cx, int16_t cy, int16_t r, uint32_t color);
+
+/// @brief Draw a line with a width of 1 pixel.
+void drawLine(DisplayAdapter *da, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color);
+
+/// @brief Draw a line with the given width.
+void drawThickLine(DisplayAdapter *da, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t width, uint32_t color);
+
+/// @brief Fill a polygon using the even-odd rule.
+/// @param da the display adapter.
+/// @param xy list of point coordinates x0, y0, x1, y1, ...
+/// @param count number of points, max. SPANDRAW_MAX_POINTS.
+/// @param color fill color.
+void fillPolygon(DisplayAdapter *da, const int16_t *xy, uint16_t count, uint32_t color);
+
+/// @brief Fill a polygon with antialiased edges using the even-odd rule.
+/// The edge pixels are blended with the background color by their coverage.
+/// @param da the display adapter.
+/// @param xy list of point coordinates in 1/SPANDRAW_SUBPIXEL pixels.
+/// The center of the pixel x/y is at x * SPANDRAW_SUBPIXEL + SPANDRAW_SUBPIXEL / 2.
+/// @param count number of points, max. SPANDRAW_MAX_POINTS.
+/// @param color fill color.
+/// @param background color of the area behind the polygon.
+void fillPolygonAA(DisplayAdapter *da, const int16_t *xy, uint16_t count, uint32_t color, uint32_t background);
+
+
+/// @brief Merge single pixels from a pixel based drawing function like the gfxDraw widgets
+/// into spans. Neighboring pixels in a row with the same color are passed as one span.
+class PixelSpans {
+public:
+  PixelSpans(DisplayAdapter *da);
+  ~PixelSpans();
+
+  /// @brief Add a pixel.
+  void add(int16_t x, int16_t y, uint32_t color);
+
+  /// @brief Pass the collected spans to the adapter.
+  void flush();
+
+private:
+  DisplayAdapter *_da;
+  uint32_t _color = 0;
+  int16_t _width;
+  int16_t _height;
+  DisplaySpan _spans[SPANDRAW_BATCH];
+  uint16_t _count = 0;
+};
+
+}  // namespace SpanDraw
+
+// End
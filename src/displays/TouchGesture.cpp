@@ -0,0 +1,119 @@
+/**
+ * @file TouchGesture.cpp
+ *
+ * @brief Recognize gestures from a sequence of touch samples.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * See https://www.mathertel.de/License.aspx.
+ *
+ * Changelog: see TouchGesture.h
+ */
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <displays/TouchGesture.h>
+
+#define TRACE(...)  // LOGGER_TRACE(__VA_ARGS__)
+
+
+uint16_t TouchGesture::spread(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  int32_t dx = x1 - x0;
+  int32_t dy = y1 - y0;
+  return ((uint16_t)sqrtf((float)(dx * dx + dy * dy)));
+}  // spread()
+
+
+TouchGesture::Sample &TouchGesture::_latest(uint8_t n) {
+  return (_ring[(_head + TOUCH_SAMPLES - 1 - n) % TOUCH_SAMPLES]);
+}  // _latest()
+
+
+TouchGesture::GESTURE TouchGesture::add(unsigned long ms, int16_t x, int16_t y, uint16_t spread) {
+  GESTURE g = None;
+  Sample s = { ms, x, y, spread };
+
+  if (_count == 0) {
+    _first = s;
+    _moved = false;
+    _longPressed = false;
+    _head = 0;
+  } else if ((_first.spread == 0) && (spread)) {
+    // the second point was added later.
+    _first.spread = spread;
+  }
+
+  _ring[_head] = s;
+  _head = (_head + 1) % TOUCH_SAMPLES;
+  if (_count < 0xFFFF) _count++;
+
+  if ((abs(x - _first.x) > slop) || (abs(y - _first.y) > slop)) {
+    _moved = true;
+  }
+
+  if ((!_moved) && (!_longPressed) && (!_first.spread) && (ms - _first.ms >= longPressTime)) {
+    _longPressed = true;
+    g = LongPress;
+  }
+  return (g);
+}  // add()
+
+
+TouchGesture::GESTURE TouchGesture::end() {
+  GESTURE g = None;
+
+  if (_count) {
+    Sample &last = _latest(0);
+    int dx = last.x - _first.x;
+    int dy = last.y - _first.y;
+
+    // velocity from the oldest sample in the time window
+    uint8_t n = 0;
+    uint8_t available = (_count < TOUCH_SAMPLES) ? _count : TOUCH_SAMPLES;
+    while ((n + 1 < available) && (last.ms - _latest(n + 1).ms <= TOUCH_VELOCITY_TIME)) {
+      n++;
+    }
+    Sample &old = _latest(n);
+    unsigned long duration = last.ms - old.ms;
+    if (duration > 0) {
+      velocityX = (int)((long)(last.x - old.x) * 1000 / (long)duration);
+      velocityY = (int)((long)(last.y - old.y) * 1000 / (long)duration);
+    } else {
+      velocityX = velocityY = 0;
+    }
+    TRACE("end d=%d/%d v=%d/%d", dx, dy, velocityX, velocityY);
+
+    if (_longPressed) {
+      // already reported.
+
+    } else if ((_first.spread) && (last.spread)) {
+      // two points at start and end
+      scale = (int)((long)last.spread * 100 / _first.spread);
+      if ((scale < 80) || (scale > 120)) {
+        g = Pinch;
+      }
+
+    } else if (_moved) {
+      bool horizontal = (abs(dx) >= abs(dy));
+      int dist = horizontal ? dx : dy;
+      int v = horizontal ? velocityX : velocityY;
+
+      if ((abs(dist) >= swipeDistance) || ((abs(v) >= swipeVelocity) && (v * dist > 0))) {
+        if (horizontal) {
+          g = (dist < 0) ? SwipeLeft : SwipeRight;
+        } else {
+          g = (dist < 0) ? SwipeUp : SwipeDown;
+        }
+      }
+    }
+  }
+
+  _count = 0;
+  return (g);
+}  // end()
+
+// End
@@ -0,0 +1,121 @@
+/**
+ * @file TouchGesture.h
+ *
+ * @brief Recognize gestures from a sequence of touch samples.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license.
+ * See https://www.mathertel.de/License.aspx.
+ * More information on https://www.mathertel.de/Arduino
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+The touch elements add a sample for every read of the touch controller while the display is
+touched and call end() when the touch is released.
+
+The samples are kept in a small ring buffer with timestamps. The velocity is estimated from
+the samples of the last TOUCH_VELOCITY_TIME msecs.
+
+Recognized gestures:
+* Swipe: The touch moved at least swipeDistance pixels or was released with a velocity above
+  swipeVelocity in one main direction.
+* LongPress: The touch stayed within the slop distance for longPressTime msecs.
+  This is reported while the display is still touched.
+* Pinch: Two points were touched at start and end and their distance changed by more than
+  20 percent. The scale is given in percent.
+@endverbatim
+ */
+
+#pragma once
+
+/// @brief number of samples in the ring buffer.
+#define TOUCH_SAMPLES 16
+
+/// @brief time window in msecs used to estimate the velocity.
+#define TOUCH_VELOCITY_TIME 100
+
+class TouchGesture {
+public:
+  enum GESTURE : uint8_t {
+    None = 0,
+    SwipeLeft,
+    SwipeRight,
+    SwipeUp,
+    SwipeDown,
+    LongPress,
+    Pinch
+  };
+
+  /// @brief a touch sample with position and distance of a second point.
+  struct Sample {
+    unsigned long ms;
+    int16_t x;
+    int16_t y;
+    uint16_t spread;  ///< distance to the second point or 0.
+  };
+
+  /// @brief min. distance in pixels for a swipe.
+  uint16_t swipeDistance = 60;
+
+  /// @brief min. velocity in pixels per second for a short swipe.
+  uint16_t swipeVelocity = 600;
+
+  /// @brief max. distance in pixels a touch may move for a long press.
+  uint16_t slop = 12;
+
+  /// @brief time in msecs for a long press.
+  unsigned long longPressTime = 800;
+
+  /// @brief scale in percent of a recognized pinch gesture.
+  int scale = 100;
+
+  /// @brief velocity at the end of the touch in pixels per second.
+  int velocityX = 0;
+  int velocityY = 0;
+
+  /// @brief Calculate the distance between two points.
+  static uint16_t spread(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+  /// @brief Add a sample while the display is touched.
+  /// @return LongPress when recognized with this sample, otherwise None.
+  GESTURE add(unsigned long ms, int16_t x, int16_t y, uint16_t spread = 0);
+
+  /// @brief The touch was released.
+  /// @return the recognized gesture.
+  GESTURE end();
+
+  /// @brief Return true while samples of a touch are collected.
+  bool isActive() {
+    return (_count > 0);
+  }
+
+private:
+  /// @brief ring buffer of the last samples.
+  Sample _ring[TOUCH_SAMPLES];
+
+  /// @brief position of the next sample in the ring buffer.
+  uint8_t _head = 0;
+
+  /// @brief number of samples since the touch started.
+  uint16_t _count = 0;
+
+  /// @brief first sample of the touch.
+  Sample _first;
+
+  /// @brief the touch moved out of the slop distance.
+  bool _moved = false;
+
+  /// @brief a long press was reported.
+  bool _longPressed = false;
+
+  /// @brief Get the n-th latest sample, 0 is the last one.
+  Sample &_latest(uint8_t n);
+};
+
+// End
@@ -56,5 +56,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the APA102Element onto the ElementRegistry.
 bool APA102Element::registered =
-  ElementRegistry::registerElement("apa102", APA102Element::create);
+  ElementRegistry::registerElement("apa102", APA102Element::create, sizeof(APA102Element));
 #endif
@@ -142,7 +142,7 @@ private:
   /**
    * @brief The _valueAction holds the actions that is submitted when the color changes.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   /**
    * @brief linked elements by ID
@@ -160,11 +160,11 @@ private:
   /**
    * @brief The _brightnessAction holds the actions that is submitted when the brightness changes.
    */
-  String _brightnessAction;
+  HomeDing::Actions::ActionString _brightnessAction;
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the ColorElement in the ElementRegistry.
 bool ColorElement::registered =
-  ElementRegistry::registerElement("color", ColorElement::create);
+  ElementRegistry::registerElement("color", ColorElement::create, sizeof(ColorElement));
 #endif
@@ -130,5 +130,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the LightElement onto the ElementRegistry.
 bool LightElement::registered =
-    ElementRegistry::registerElement("light", LightElement::create);
+    ElementRegistry::registerElement("light", LightElement::create, sizeof(LightElement));
 #endif
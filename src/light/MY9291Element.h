@@ -75,7 +75,7 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the MY9291Element onto the ElementRegistry.
 bool MY9291Element::registered =
-    ElementRegistry::registerElement("my9291", MY9291Element::create);
+    ElementRegistry::registerElement("my9291", MY9291Element::create, sizeof(MY9291Element));
 #endif
 
 #elif defined(ESP32)
@@ -80,5 +80,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the NeoElement onto the ElementRegistry.
 bool NeoElement::registered =
-  ElementRegistry::registerElement("neo", NeoElement::create);
+  ElementRegistry::registerElement("neo", NeoElement::create, sizeof(NeoElement));
 #endif
@@ -72,5 +72,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the P9813Element onto the ElementRegistry.
 bool P9813Element::registered =
-    ElementRegistry::registerElement("p9813", P9813Element::create);
+    ElementRegistry::registerElement("p9813", P9813Element::create, sizeof(P9813Element));
 #endif
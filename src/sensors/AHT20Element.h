@@ -76,5 +76,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the AHT20Element in the ElementRegistry.
-bool AHT20Element::registered = ElementRegistry::registerElement("aht20", AHT20Element::create);
+bool AHT20Element::registered = ElementRegistry::registerElement("aht20", AHT20Element::create, sizeof(AHT20Element));
 #endif
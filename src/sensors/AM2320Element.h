@@ -68,5 +68,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the AM2320Element in the ElementRegistry.
-bool AM2320Element::registered = ElementRegistry::registerElement("am2320", AM2320Element::create);
+bool AM2320Element::registered = ElementRegistry::registerElement("am2320", AM2320Element::create, sizeof(AM2320Element));
 #endif
@@ -72,7 +72,7 @@ private:
   uint8_t _mode = 0x20;  // default operating mode: 1 lux resolution, one shot
 
   /** The actions emitted when a new value was read from the sensor. */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   float _factor = 1.2f;
 
@@ -82,5 +82,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the BH1750Element in the ElementRegistry.
 bool BH1750Element::registered =
-  ElementRegistry::registerElement("bh1750", BH1750Element::create);
+  ElementRegistry::registerElement("bh1750", BH1750Element::create, sizeof(BH1750Element));
 #endif
@@ -19,72 +19,52 @@
 
 #include <sensors/BME680Element.h>
 
-#include <lib/bme680.h>
 #include <WireUtils.h>
 
-/* ===== Define local constants and often used strings ===== */
+#define TRACE(...)  // LOGGER_ETRACE(__VA_ARGS__)
 
-struct bme680_dev gas_sensor;
+// ===== BME680 specific funtions. see data Data Sheet.
 
-// ===== adapter functions for bme library
+// registers of the chip.
 
-static void delay_msec(uint32_t ms) {
-  delay(ms);
-}
+#define BME680_REG_RES_HEAT_VAL 0x00
+#define BME680_REG_RES_HEAT_RANGE 0x02
+#define BME680_REG_RANGE_SW_ERR 0x04
+#define BME680_REG_DATA 0x1D  // 15 bytes of status and data
+#define BME680_REG_RES_HEAT0 0x5A
+#define BME680_REG_GAS_WAIT0 0x64
+#define BME680_REG_CTRL_GAS1 0x71
+#define BME680_REG_CTRL_HUM 0x72
+#define BME680_REG_CTRL_MEAS 0x74
+#define BME680_REG_CONFIG 0x75
+#define BME680_REG_CALIB1 0x89  // 25 bytes for calibration
+#define BME680_REG_ID 0xD0
+#define BME680_REG_CALIB2 0xE1  // 16 bytes for calibration
 
-static int8_t i2c_read(uint8_t dev_id, uint8_t reg_addr, uint8_t *reg_data, uint16_t len) {
-  int8_t readLen = WireUtils::readBuffer(dev_id, reg_addr, reg_data, len);
-  return (readLen != len);
-}
+#define BME680_CHIP_ID 0x61
 
-static int8_t i2c_write(uint8_t dev_id, uint8_t reg_addr, uint8_t *reg_data, uint16_t len) {
-  uint8_t tmp[44];
-  tmp[0] = reg_addr;
-  memcpy(tmp + 1, reg_data, len);
-  WireUtils::writeBuffer(dev_id, tmp, len + 1);
-  return (0);
-}
+// Control settings
+#define BME680_MODE_FORCED 0x01
+#define BME680_OSH_2 0x02
+#define BME680_OSP_4 (0x03 << 2)
+#define BME680_OST_8 (0x04 << 5)
+#define BME680_FILTER_3 (0x02 << 2)
+#define BME680_RUN_GAS 0x10
 
+// Status bits
+#define BME680_NEW_DATA 0x80
+#define BME680_GAS_VALID 0x20
+#define BME680_HEAT_STAB 0x10
 
-// ===== private methods
+// heater profile: 320 °C for 150 msec.
+#define BME680_HEATER_TEMP 320
+#define BME680_HEATER_DUR 0x65  // 150 msec = 37 * 4 encoded as 37 + 1 * 64
 
-unsigned long BME680Element::beginReading(void) {
-  uint8_t set_required_settings;
-  uint16_t meas_period;
+// duration of a measurement in msec:
+// TPH: (8 + 4 + 2) cycles * 1963 usec + 4 * 477 usec + 5 * 477 usec + 500 usec = 33 msec
+// Gas: heater duration.
+#define BME680_MEASURE_DUR (33 + 150)
 
-  /* Set the temperature, pressure and humidity settings */
-  gas_sensor.tph_sett.os_hum = BME680_OS_2X;
-  gas_sensor.tph_sett.os_pres = BME680_OS_4X;
-  gas_sensor.tph_sett.os_temp = BME680_OS_8X;
-  gas_sensor.tph_sett.filter = BME680_FILTER_SIZE_3;
-
-  /* Set the remaining gas sensor settings and link the heating profile */
-  gas_sensor.gas_sett.run_gas = BME680_ENABLE_GAS_MEAS;
-  /* Create a ramp heat waveform in 3 steps */
-  gas_sensor.gas_sett.heatr_temp = 320; /* degree Celsius */
-  gas_sensor.gas_sett.heatr_dur = 150;  /* milliseconds */
-
-  /* Select the power mode */
-  /* Must be set before writing the sensor configuration */
-  gas_sensor.power_mode = BME680_FORCED_MODE;
-
-  /* Set the required sensor settings needed */
-  set_required_settings = BME680_OST_SEL | BME680_OSP_SEL | BME680_OSH_SEL | BME680_FILTER_SEL | BME680_GAS_SENSOR_SEL;
-
-  /* Set the desired sensor configuration */
-  bme680_set_sensor_settings(set_required_settings, &gas_sensor);
-
-  /* Set the power mode */
-  bme680_set_sensor_mode(&gas_sensor);
-
-  /* Get the total measurement duration so as to sleep or wait till the measurement is complete */
-  bme680_get_profile_dur(&meas_period, &gas_sensor);
-  // TRACE("meas_period=%d", meas_period);
-
-  return (millis() + meas_period);
-}  // beginReading()
-
-/* ===== Static factory function ===== */
 
 /**
  * @brief static factory function to create a new BME680Element
@@ -109,23 +89,21 @@ bool BME680Element::set(const char *name, const char *value) {
 
   } else if (name == HomeDing::Actions::Address) {
     _address = _atoi(value);
-    ret = true;
 
   } else if (name == HomeDing::Actions::OnTemperature) {
-    _temperatureAction = value;
-    ret = true;
+    _actions[0] = value;
 
   } else if (name == HomeDing::Actions::OnHumidity) {
-    _humidityAction = value;
-    ret = true;
+    _actions[1] = value;
 
   } else if (name == HomeDing::Actions::OnPressure) {
-    _pressureAction = value;
-    ret = true;
+    _actions[2] = value;
 
   } else if (_stricmp(name, "ongas") == 0) {
-    _gasAction = value;
-    ret = true;
+    _actions[3] = value;
+
+  } else if (_stricmp(name, "oniaq") == 0) {
+    _actions[4] = value;
 
   } else {
     ret = false;
@@ -139,85 +117,220 @@ bool BME680Element::set(const char *name, const char *value) {
  * @brief Activate the BME680Element.
  */
 void BME680Element::start() {
-  // TRACE("start()");
-  // Setup sensor connectivity and check if sensor is present.
-  gas_sensor.dev_id = _address;
-  gas_sensor.intf = BME680_I2C_INTF;
-  gas_sensor.read = i2c_read;
-  gas_sensor.write = i2c_write;
-  gas_sensor.delay_ms = delay_msec;
-  /* amb_temp can be set to 25 prior to configuring the gas sensor
-   * or by performing a few temperature readings without operating the gas sensor.
-   */
-  gas_sensor.amb_temp = 25;  // just a first guess. will be updated.
-
-  int8_t rslt = bme680_init(&gas_sensor);
-
-  if (rslt != BME680_OK) {
+  TRACE("start()");
+
+  // test if a device is attached
+  if (!WireUtils::exists(_address)) {
+    LOGGER_EERR("not found");
+    term();
+
+  } else if (WireUtils::readRegister(_address, BME680_REG_ID) != BME680_CHIP_ID) {
     LOGGER_EERR("no sensor found");
+    term();
+
   } else {
+    _readCalibration();
+    _phase = 0;
+    _valuesCount = 5;
+    _stateKeys = "temperature,humidity,pressure,gas,iaq";
     SensorElement::start();
-  }
+  }  // if
 }  // start()
 
 
-bool BME680Element::getProbe(String &values) {
-  bool newData = false;
-  char buffer[48];
-
-  if (!_dataAvailable) {
-    // start reading
-    _dataAvailable = beginReading();
-
-  } else if (_dataAvailable && (millis() < _dataAvailable)) {
-    // wait
-
-  } else if (_dataAvailable) {
-    // read data from chip
-    struct bme680_field_data data;
-    int rslt = bme680_get_sensor_data(&data, &gas_sensor);
-    if (rslt) {
-      LOGGER_EERR("get_sensor_data err %d", rslt);
-
-    } else {
-      snprintf(buffer, sizeof(buffer),
-               //  "%.2f,%.2f,%.0f,%.0f,%d",
-               "%d.%02d,%ld.%03ld,%ld.%02ld,%ld",
-               data.temperature / 100, data.temperature % 100,
-               data.humidity / 1000, data.humidity % 1000,
-               data.pressure / 100, data.pressure % 100,
-               data.gas_resistance);  // data.gas_index
-      // LOGGER_EINFO("data=%s", buffer);
-      // update ambient temperature for next read
-      gas_sensor.amb_temp = (data.temperature + 50) / 100;
-      // LOGGER_EINFO("amb temp=%d", gas_sensor.amb_temp);
-      values = buffer;
-      newData = true;
-    }
-    _dataAvailable = 0;
+// ===== private functions
+
+void BME680Element::_readCalibration() {
+  uint8_t c[41];
+  WireUtils::readBuffer(_address, BME680_REG_CALIB1, c, 25);
+  WireUtils::readBuffer(_address, BME680_REG_CALIB2, c + 25, 16);
+
+  par_t1 = WU_U16(c, 33);
+  par_t2 = WU_S16(c, 1);
+  par_t3 = (int8_t)c[3];
+
+  par_p1 = WU_U16(c, 5);
+  par_p2 = WU_S16(c, 7);
+  par_p3 = (int8_t)c[9];
+  par_p4 = WU_S16(c, 11);
+  par_p5 = WU_S16(c, 13);
+  par_p6 = (int8_t)c[16];
+  par_p7 = (int8_t)c[15];
+  par_p8 = WU_S16(c, 19);
+  par_p9 = WU_S16(c, 21);
+  par_p10 = c[23];
+
+  par_h1 = (uint16_t)((c[27] << 4) | (c[26] & 0x0F));
+  par_h2 = (uint16_t)((c[25] << 4) | (c[26] >> 4));
+  par_h3 = (int8_t)c[28];
+  par_h4 = (int8_t)c[29];
+  par_h5 = (int8_t)c[30];
+  par_h6 = c[31];
+  par_h7 = (int8_t)c[32];
+
+  par_gh1 = (int8_t)c[37];
+  par_gh2 = WU_S16(c, 35);
+  par_gh3 = (int8_t)c[38];
+
+  res_heat_range = (WireUtils::readRegister(_address, BME680_REG_RES_HEAT_RANGE) & 0x30) / 16;
+  res_heat_val = (int8_t)WireUtils::readRegister(_address, BME680_REG_RES_HEAT_VAL);
+  range_sw_err = ((int8_t)WireUtils::readRegister(_address, BME680_REG_RANGE_SW_ERR) & (int8_t)0xF0) / 16;
+}  // _readCalibration()
+
+
+// Returns the value for the res_heat register for the target temperature in degree celsius.
+uint8_t BME680Element::_heaterResistance(uint16_t temp) {
+  int32_t var1 = (((int32_t)_ambTemp * par_gh3) / 1000) * 256;
+  int32_t var2 = (par_gh1 + 784) * (((((par_gh2 + 154009) * temp * 5) / 100) + 3276800) / 10);
+  int32_t var3 = var1 + (var2 / 2);
+  int32_t var4 = (var3 / (res_heat_range + 4));
+  int32_t var5 = (131 * res_heat_val) + 65536;
+  int32_t res_x100 = (int32_t)(((var4 / var5) - 250) * 34);
+  return ((uint8_t)((res_x100 + 50) / 100));
+}  // _heaterResistance()
+
+
+// Returns the estimated iaq value in the range 0..500.
+int BME680Element::_calcIAQ(uint32_t gas, int32_t hum) {
+  // rolling baseline: follow cleaner air fast and polluted air slowly.
+  if (!_gasBaseline) {
+    _gasBaseline = gas;
+  } else if (gas > _gasBaseline) {
+    _gasBaseline += (gas - _gasBaseline) / 4;
+  } else {
+    _gasBaseline -= (_gasBaseline - gas) / 256;
   }
-  return (newData);
-}  // getProbe()
 
+  // gas score 0..75
+  int32_t gasScore = 75;
+  if (gas < _gasBaseline) {
+    gasScore = (int32_t)(((uint64_t)gas * 75) / _gasBaseline);
+  }
 
-void BME680Element::sendData(String &values) {
-  HomeDing::Actions::pushItem(_temperatureAction, values, 0);
-  HomeDing::Actions::pushItem(_humidityAction, values, 1);
-  HomeDing::Actions::pushItem(_pressureAction, values, 2);
-  HomeDing::Actions::pushItem(_gasAction, values, 3);
-}  // sendData()
+  // humidity score 0..25, best at 40%
+  int32_t humScore;
+  if (hum >= 40000) {
+    humScore = ((100000 - hum) * 25) / 60000;
+  } else {
+    humScore = (hum * 25) / 40000;
+  }
 
+  TRACE("gas=%lu base=%lu score=%d+%d", gas, _gasBaseline, gasScore, humScore);
+  return ((100 - (gasScore + humScore)) * 5);
+}  // _calcIAQ()
 
-/**
- * @brief push the current value of all properties to the callback.
- */
-void BME680Element::pushState(
-  std::function<void(const char *pName, const char *eValue)> callback) {
-  SensorElement::pushState(callback);
-  callback("temperature", Element::getItemValue(_lastValues, 0).c_str());
-  callback("humidity", Element::getItemValue(_lastValues, 1).c_str());
-  callback("pressure", Element::getItemValue(_lastValues, 2).c_str());
-  callback("gas", Element::getItemValue(_lastValues, 3).c_str());
-}  // pushState()
+
+// ===== Sensor functions
+
+/** return true when reading a probe is done.
+ * return any existing value or empty for no data could be read. */
+bool BME680Element::getProbe(String &values) {
+  if (_phase == 0) {
+    // trigger: start a new measurement with the heater profile.
+    WireUtils::write(_address, BME680_REG_CTRL_HUM, BME680_OSH_2);
+    WireUtils::write(_address, BME680_REG_CONFIG, BME680_FILTER_3);
+    WireUtils::write(_address, BME680_REG_RES_HEAT0, _heaterResistance(BME680_HEATER_TEMP));
+    WireUtils::write(_address, BME680_REG_GAS_WAIT0, BME680_HEATER_DUR);
+    WireUtils::write(_address, BME680_REG_CTRL_GAS1, BME680_RUN_GAS);
+    WireUtils::write(_address, BME680_REG_CTRL_MEAS, BME680_OST_8 | BME680_OSP_4 | BME680_MODE_FORCED);
+    _phase = 1;
+    setWait(BME680_MEASURE_DUR);
+    return (false);
+  }  // if
+
+  // read: status and data
+  uint8_t data[15];
+  if (WireUtils::readBuffer(_address, BME680_REG_DATA, data, 15) != 15) {
+    LOGGER_EERR("read failed");
+    _phase = 0;
+    values.clear();
+    return (true);
+
+  } else if (!(data[0] & BME680_NEW_DATA)) {
+    setWait(10);  // not ready yet
+    return (false);
+  }
+  _phase = 0;
+
+  // temperature in 1/100 degree celsius
+  int32_t adc_T = (int32_t)((data[5] << 12) | (data[6] << 4) | (data[7] >> 4));
+  int64_t tvar1 = (adc_T >> 3) - ((int32_t)par_t1 << 1);
+  int64_t tvar2 = (tvar1 * (int32_t)par_t2) >> 11;
+  int64_t tvar3 = ((((tvar1 >> 1) * (tvar1 >> 1)) >> 12) * ((int32_t)par_t3 << 4)) >> 14;
+  t_fine = (int32_t)(tvar2 + tvar3);
+  int32_t temp = ((t_fine * 5) + 128) >> 8;
+
+  // pressure in Pa
+  int32_t adc_P = (int32_t)((data[2] << 12) | (data[3] << 4) | (data[4] >> 4));
+  int32_t var1 = (t_fine >> 1) - 64000;
+  int32_t var2 = ((((var1 >> 2) * (var1 >> 2)) >> 11) * (int32_t)par_p6) >> 2;
+  var2 = var2 + ((var1 * (int32_t)par_p5) << 1);
+  var2 = (var2 >> 2) + ((int32_t)par_p4 << 16);
+  var1 = (((((var1 >> 2) * (var1 >> 2)) >> 13) * ((int32_t)par_p3 << 5)) >> 3) + (((int32_t)par_p2 * var1) >> 1);
+  var1 = var1 >> 18;
+  var1 = ((32768 + var1) * (int32_t)par_p1) >> 15;
+  int32_t press = 1048576 - adc_P;
+  press = (int32_t)((press - (var2 >> 12)) * ((uint32_t)3125));
+  if (press >= 0x40000000) {
+    press = ((press / var1) << 1);
+  } else {
+    press = ((press << 1) / var1);
+  }
+  var1 = ((int32_t)par_p9 * (int32_t)(((press >> 3) * (press >> 3)) >> 13)) >> 12;
+  var2 = ((int32_t)(press >> 2) * (int32_t)par_p8) >> 13;
+  int32_t var3 = ((int32_t)(press >> 8) * (int32_t)(press >> 8) * (int32_t)(press >> 8) * (int32_t)par_p10) >> 17;
+  press = press + ((var1 + var2 + var3 + ((int32_t)par_p7 << 7)) >> 4);
+
+  // humidity in 1/1000 %
+  int32_t adc_H = (int32_t)((data[8] << 8) | data[9]);
+  int32_t temp_scaled = temp;
+  var1 = (adc_H - ((int32_t)par_h1 * 16)) - (((temp_scaled * (int32_t)par_h3) / 100) >> 1);
+  var2 = ((int32_t)par_h2
+          * (((temp_scaled * (int32_t)par_h4) / 100)
+             + (((temp_scaled * ((temp_scaled * (int32_t)par_h5) / 100)) >> 6) / 100)
+             + (int32_t)(1 << 14)))
+         >> 10;
+  var3 = var1 * var2;
+  int32_t var4 = (((int32_t)par_h6 << 7) + ((temp_scaled * (int32_t)par_h7) / 100)) >> 4;
+  int32_t var5 = ((var3 >> 14) * (var3 >> 14)) >> 10;
+  int32_t hum = (((var3 + ((var4 * var5) >> 1)) >> 10) * 1000) >> 12;
+  hum = constrain(hum, 0, 100000);
+
+  char buffer[64];
+  int len = snprintf(buffer, sizeof(buffer), "%s%d.%02d,%ld.%03ld,%ld.%02ld",
+                     (temp < 0 ? "-" : ""), (int)abs(temp / 100), (int)abs(temp % 100),
+                     (long)(hum / 1000), (long)(hum % 1000),
+                     (long)(press / 100), (long)(press % 100));
+
+  // gas resistance in Ohm, only when the heater was stable.
+  if ((data[14] & BME680_GAS_VALID) && (data[14] & BME680_HEAT_STAB)) {
+    static const uint32_t lookup1[16] = {
+      2147483647UL, 2147483647UL, 2147483647UL, 2147483647UL, 2147483647UL, 2126008810UL, 2147483647UL, 2130303777UL,
+      2147483647UL, 2147483647UL, 2143188679UL, 2136746228UL, 2147483647UL, 2126008810UL, 2147483647UL, 2147483647UL
+    };
+    static const uint32_t lookup2[16] = {
+      4096000000UL, 2048000000UL, 1024000000UL, 512000000UL, 255744255UL, 127110228UL, 64000000UL, 32258064UL,
+      16016016UL, 8000000UL, 4000000UL, 2000000UL, 1000000UL, 500000UL, 250000UL, 125000UL
+    };
+    uint16_t adc_G = (uint16_t)((data[13] << 2) | (data[14] >> 6));
+    uint8_t range = data[14] & 0x0F;
+
+    int64_t gvar1 = (int64_t)((1340 + (5 * (int64_t)range_sw_err)) * ((int64_t)lookup1[range])) >> 16;
+    int64_t gvar2 = (((int64_t)adc_G << 15) - (int64_t)(16777216)) + gvar1;
+    int64_t gvar3 = (((int64_t)lookup2[range] * gvar1) >> 9);
+    uint32_t gas = (uint32_t)((gvar3 + (gvar2 >> 1)) / gvar2);
+
+    snprintf(buffer + len, sizeof(buffer) - len, ",%lu,%d", (unsigned long)gas, _calcIAQ(gas, hum));
+  } else {
+    snprintf(buffer + len, sizeof(buffer) - len, ",,");
+  }
+
+  // update ambient temperature for next heater setting
+  _ambTemp = (int8_t)((temp + 50) / 100);
+
+  TRACE("data=%s", buffer);
+  values = buffer;
+  return (true);
+}  // getProbe()
 
 // End
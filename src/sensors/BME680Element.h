@@ -16,6 +16,8 @@
  * * 12.02.2020 rebased on SensorElement.
  * * 15.04.2020 switch to original bosch https://github.com/BoschSensortec/BME680_driver
  *              no dependency on Adafruit Unified Sensor and Adafruit BME680 Library.
+ * * 18.10.2026 non-blocking measurement with fixed point compensation and IAQ estimation,
+ *              no dependency on the bosch driver.
  */
 
 #pragma once
@@ -23,17 +25,29 @@
 #include <sensors/SensorElement.h>
 
 /**
- * @brief BME680Element implements...
+ * @brief BME680Element implements reading temperature, humidity, pressure and gas resistance
+ * from a BME680 sensor using the I2C bus.
  * @details
 @verbatim
 
-The BME680Element can ...
+The BME680Element reads the sensor in forced mode in 3 steps without blocking the loop:
+
+* trigger: the heater profile and the forced mode is written to the chip.
+* wait: the SensorElement waits for the duration of the measurement using setWait().
+* read: the raw data is read and compensated using integer arithmetic as documented in the
+  data sheet.
+
+The values are reported as "temperature,humidity,pressure,gas,iaq".
+
+The gas resistance is only reported when the heater was stable. The iaq value is a simple
+estimation of the indoor air quality in the range 0 (good) to 500 (bad) using the gas
+resistance compared to a rolling baseline (75%) and the distance of the humidity to 40% (25%).
+The baseline follows higher resistance values quickly and lower resistance values slowly.
 
 @endverbatim
  */
 
-class BME680Element : public SensorElement
-{
+class BME680Element : public SensorElement {
 public:
   /**
    * @brief Factory function to create a BME680Element.
@@ -62,53 +76,68 @@ public:
    */
   virtual void start() override;
 
-  /**
-   * @brief push the current value of all properties to the callback.
-   * @param callback callback function that is used for every property.
-   */
-  virtual void pushState(
-      std::function<void(const char *pName, const char *eValue)> callback) override;
-
 protected:
-  virtual bool getProbe(String &values);
-  virtual void sendData(String &values);
+  virtual bool getProbe(String &values) override;
 
 private:
-  unsigned long beginReading(void);
+  int _address = 0x77;  // BME680 I2C addresses are 0x76 or 0x77
 
   /**
    * @brief state in reading values from the sensor.
-   * 0: wait for next time
-   * 1: reading initiated, wait for _endTime
-   */
-  unsigned long _dataAvailable;
-
-  int _address = 0x77; // BME680 I2C addresses are 0x76 or 0x77
-
-  /**
-   * @brief The actions emitted when a new temperature value was read from the
-   * sensor.
-   */
-  String _temperatureAction;
-
-  /**
-   * @brief The actions emitted when a new humidity value was read from the
-   * sensor.
-   */
-  String _humidityAction;
-
-  /** The actions emitted when a new pressure value was read from the sensor. */
-  String _pressureAction;
-
-  /**
-   * @brief The actions emitted when a new gas value was read from the sensor.
+   * 0: start a new measurement
+   * 1: measurement started, read data when available
    */
-  String _gasAction;
+  int _phase = 0;
+
+  /// @brief read the calibration data from the chip.
+  void _readCalibration();
+
+  /// @brief calculate the heater resistance setting for the target temperature.
+  uint8_t _heaterResistance(uint16_t temp);
+
+  /// @brief update the gas baseline and calculate the iaq value.
+  int _calcIAQ(uint32_t gas, int32_t humidity);
+
+  // calibration data
+  uint16_t par_t1;
+  int16_t par_t2;
+  int8_t par_t3;
+  uint16_t par_p1;
+  int16_t par_p2;
+  int8_t par_p3;
+  int16_t par_p4;
+  int16_t par_p5;
+  int8_t par_p6;
+  int8_t par_p7;
+  int16_t par_p8;
+  int16_t par_p9;
+  uint8_t par_p10;
+  uint16_t par_h1;
+  uint16_t par_h2;
+  int8_t par_h3;
+  int8_t par_h4;
+  int8_t par_h5;
+  uint8_t par_h6;
+  int8_t par_h7;
+  int8_t par_gh1;
+  int16_t par_gh2;
+  int8_t par_gh3;
+  uint8_t res_heat_range;
+  int8_t res_heat_val;
+  int8_t range_sw_err;
+
+  int32_t t_fine;
+
+  /// ambient temperature in degree celsius used for the heater setting.
+  int8_t _ambTemp = 25;
+
+  /// rolling baseline of the gas resistance in Ohm.
+  uint32_t _gasBaseline = 0;
 };
 
 
 #ifdef HOMEDING_REGISTER
-// Register the DHTElement in the ElementRegistry.
+// Register the BME680Element in the ElementRegistry.
 bool BME680Element::registered =
-    ElementRegistry::registerElement("bme680", BME680Element::create);
+  ElementRegistry::registerElement("bme680", BME680Element::create, sizeof(BME680Element));
 #endif
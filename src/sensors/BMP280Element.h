@@ -87,5 +87,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the BMP280Element  in the ElementRegistry.
-bool BMP280Element::registered = ElementRegistry::registerElement("bmp280", BMP280Element::create);
+bool BMP280Element::registered = ElementRegistry::registerElement("bmp280", BMP280Element::create, sizeof(BMP280Element));
 #endif
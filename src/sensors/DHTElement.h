@@ -87,5 +87,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the DHTElement in the ElementRegistry.
-bool DHTElement::registered = ElementRegistry::registerElement("dht", DHTElement::create);
+bool DHTElement::registered = ElementRegistry::registerElement("dht", DHTElement::create, sizeof(DHTElement));
 #endif
@@ -1,8 +1,8 @@
 /**
  * @file DallasElement.cpp
  *
- * @brief Sensor Element for the HomeDing Library to read DS18B20 and other OneLine sensors supported
- * by the DallasTemperature library and create actions.
+ * @brief Sensor Element for the HomeDing Library to read DS18B20 and other OneWire temperature
+ * sensors and create actions.
  *
  * @author Matthias Hertel, https://www.mathertel.de
  *
@@ -24,27 +24,81 @@
 #define TRACE(...)  // LOGGER_JUSTINFO(__VA_ARGS__)
 
 #include <OneWire.h>
-#include <DallasTemperature.h>
+
+// max. number of probes on the bus.
+#define DALLAS_MAX_PROBES 8
+
+// OneWire commands
+#define DALLAS_CONVERT_T 0x44
+#define DALLAS_WRITE_SCRATCHPAD 0x4E
+#define DALLAS_READ_SCRATCHPAD 0xBE
+
+// family code of the DS18S20 with a fixed 9 bit resolution.
+#define DALLAS_DS18S20 0x10
 
 class DallasElementImpl {
 public:
-  OneWire *oneWire;
-  DallasTemperature *sensors;
+  OneWire *oneWire = nullptr;
 
   int pin = -1;
-  uint8_t addr[8];
-  uint8_t resolution;
+  uint8_t resolution = 12;
+
+  /** ROM codes of the probes found on the bus. */
+  uint8_t rom[DALLAS_MAX_PROBES][8];
+  int count = 0;
+
+  /** msecs of a conversion on all probes. DS18S20 probes always need 750 msecs. */
+  uint16_t convTime = 750;
+
+  /** number of scratchpads with a wrong CRC per probe. */
+  uint16_t crcErrors[DALLAS_MAX_PROBES];
+
+  /** index of the next probe to read, -1 when a conversion must be started. */
+  int next = -1;
 
-  /** time in msecs when data is ready */
-  unsigned long dataIsReady;
+  /** values of the probes read so far. */
+  String values;
 
   /**
-   * @brief The tempAction is emitted when a new temp was read from the DHT
-   * sensor.
+   * @brief The tempAction is emitted when a new temp was read from the first probe.
    */
-  String tempAction;
+  HomeDing::Actions::ActionString tempAction;
+
+  /**
+   * @brief The actions emitted when a new temp was read from a probe.
+   */
+  HomeDing::Actions::ActionString probeActions[DALLAS_MAX_PROBES];
+
+  /** Read the temperature of a probe in 1/100 degree celsius. */
+  bool readProbe(int n, int &temp);
 };
 
+
+bool DallasElementImpl::readProbe(int n, int &temp) {
+  uint8_t data[9];
+
+  oneWire->reset();
+  oneWire->select(rom[n]);
+  oneWire->write(DALLAS_READ_SCRATCHPAD);
+  oneWire->read_bytes(data, 9);
+
+  if (OneWire::crc8(data, 8) != data[8]) {
+    crcErrors[n]++;
+    LOGGER_ERR("crc error probe %d", n);
+    return (false);
+  }
+
+  // raw value in 1/16 degree celsius
+  int16_t raw = (int16_t)((data[1] << 8) | data[0]);
+  if (rom[n][0] == DALLAS_DS18S20) {
+    // extended resolution using the count remain register.
+    raw = ((raw << 3) & 0xFFF0) + 12 - data[6];
+  }
+  temp = (raw * 100) / 16;
+  return (true);
+}  // readProbe()
+
+
 /**
  * @brief static factory function to create a new DallasElement
  * @return DallasElement* created element
@@ -59,7 +113,6 @@ Element *DallasElement::create() {
  */
 DallasElement::DallasElement() {
   _impl = new DallasElementImpl();
-  pinMode(12, OUTPUT);
 }
 
 
@@ -81,6 +134,16 @@ bool DallasElement::set(const char *name, const char *value) {
 
   } else if (_stricmp(name, HomeDing::Actions::OnTemperature) == 0) {
     _impl->tempAction = value;
+
+  } else if (_stristartswith(name, "probes[")) {
+    size_t i;
+    String iName;
+    _scanIndexParam(name, i, iName);
+
+    if ((i < DALLAS_MAX_PROBES) && (iName.equalsIgnoreCase(HomeDing::Actions::OnTemperature))) {
+      _impl->probeActions[i] = value;
+    }
+
   } else {
     ret = false;
   }  // if
@@ -93,25 +156,45 @@ bool DallasElement::set(const char *name, const char *value) {
  */
 void DallasElement::start() {
   TRACE("start(pin=%d)", _impl->pin);
-  int n = 0;
-  if (_impl->pin >= 0) {
+  DallasElementImpl *impl = _impl;
 
-    _impl->oneWire = new (std::nothrow) OneWire(_impl->pin);
-
-    if (_impl->oneWire) {
-      _impl->sensors = new (std::nothrow) DallasTemperature(_impl->oneWire);
+  if (impl->pin >= 0) {
+    if (!impl->oneWire) {
+      impl->oneWire = new (std::nothrow) OneWire(impl->pin);
+    }
 
-      _impl->sensors->begin();
-      n = _impl->sensors->getDeviceCount();
-      TRACE("count=%d", n);
+    if ((impl->oneWire) && (impl->count == 0)) {
+      // search the ROM codes once.
+      uint8_t *a = impl->rom[0];
+      impl->oneWire->reset_search();
+      while ((impl->count < DALLAS_MAX_PROBES) && (impl->oneWire->search(a))) {
+        if (OneWire::crc8(a, 7) == a[7]) {
+          TRACE("rom[%d]: %02x %02x %02x %02x %02x %02x %02x %02x", impl->count, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+
+          if (a[0] != DALLAS_DS18S20) {
+            // set resolution in the config register, alarm registers are not used.
+            impl->oneWire->reset();
+            impl->oneWire->select(a);
+            impl->oneWire->write(DALLAS_WRITE_SCRATCHPAD);
+            impl->oneWire->write(0);
+            impl->oneWire->write(0);
+            impl->oneWire->write(((impl->resolution - 9) << 5) | 0x1F);
+          }
+          impl->crcErrors[impl->count] = 0;
+          impl->count++;
+          a = impl->rom[impl->count];
+        }
+      }  // while
+      TRACE("count=%d", impl->count);
+
+      impl->convTime = 750 >> (12 - impl->resolution);
+      for (int n = 0; n < impl->count; n++) {
+        if (impl->rom[n][0] == DALLAS_DS18S20) impl->convTime = 750;
+      }
     }
 
-    if ((_impl->oneWire) && (n > 0)) {
-      // _impl->sensors->getAddress(_impl->addr, 0);
-      // uint8_t *a = _impl->addr;
-      // TRACE("Address: %02x %02x %02x %02x %02x %02x %02x %02x", a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
-      _impl->sensors->setWaitForConversion(false);
-      _impl->sensors->setResolution(_impl->resolution);
+    if (impl->count > 0) {
+      impl->next = -1;
       SensorElement::start();
     } else {
       LOGGER_EERR("no address");
@@ -123,23 +206,40 @@ void DallasElement::start() {
 /** return true when reading a probe is done.
  * return any existing value or empty for no data could be read. */
 bool DallasElement::getProbe(String &values) {
-  // TRACE("getProbe()");
+  DallasElementImpl *impl = _impl;
   bool newData = false;
-  unsigned long now = millis();
 
-  if (_impl->dataIsReady == 0) {
-    // start conversion now
+  if (impl->next < 0) {
+    // start conversion on all probes using "Skip ROM" and wait.
     TRACE("probe-start");
-    _impl->sensors->requestTemperatures();
-    _impl->dataIsReady = now + _impl->sensors->millisToWaitForConversion(_impl->resolution);
+    impl->oneWire->reset();
+    impl->oneWire->skip();
+    impl->oneWire->write(DALLAS_CONVERT_T, 1);  // keep power on for parasite powered probes
+    impl->values.clear();
+    impl->next = 0;
+    setWait(impl->convTime);
 
-  } else if (_impl->dataIsReady < now) {
-    TRACE("probe-done");
-    float temp = _impl->sensors->getTempCByIndex(0);
-    values = String(temp, 2);
+  } else {
+    // read one probe in every loop.
+    int n = impl->next;
+    int temp;
+    char buffer[16];
 
-    _impl->dataIsReady = 0;
-    newData = true;
+    if (impl->readProbe(n, temp)) {
+      snprintf(buffer, sizeof(buffer), "%s%d.%02d", (temp < 0 ? "-" : ""), abs(temp / 100), abs(temp % 100));
+    } else {
+      buffer[0] = '\0';
+    }
+    if (n > 0) impl->values.concat(',');
+    impl->values.concat(buffer);
+
+    impl->next++;
+    if (impl->next >= impl->count) {
+      TRACE("probe-done %s", impl->values.c_str());
+      values = impl->values;
+      impl->next = -1;
+      newData = true;
+    }
   }  // if
 
   return (newData);
@@ -147,16 +247,29 @@ bool DallasElement::getProbe(String &values) {
 
 
 void DallasElement::sendData(String &values) {
-  // dispatch value.
+  // dispatch values.
   TRACE("sending %s", values.c_str());
-  HomeDing::Actions::push(_impl->tempAction, values);
+  HomeDing::Actions::pushItem(_impl->tempAction, values, 0);
+  for (int n = 0; n < _impl->count; n++) {
+    HomeDing::Actions::pushItem(_impl->probeActions[n], values, n);
+  }
 }  // sendData()
 
 
 void DallasElement::pushState(
   std::function<void(const char *pName, const char *eValue)> callback) {
   SensorElement::pushState(callback);
-  callback("temperature", _lastValues.c_str());
+  callback("temperature", Element::getItemValue(_lastValues, 0).c_str());
+  if (_impl->count > 1) {
+    callback("temperatures", _lastValues.c_str());
+  }
+
+  String errors;
+  for (int n = 0; n < _impl->count; n++) {
+    if (n > 0) errors.concat(',');
+    errors.concat(_impl->crcErrors[n]);
+  }
+  callback("crcerrors", errors.c_str());
 }  // pushState()
 
 
@@ -1,8 +1,8 @@
 /**
  * @file DallasElement .h
  *
- * @brief Sensor Element for the HomeDing Library to read DS18B20 and other OneLine sensors supported 
- * by the DallasTemperature library and create actions.
+ * @brief Sensor Element for the HomeDing Library to read DS18B20 and other OneWire temperature
+ * sensors and create actions.
  *
  * @author Matthias Hertel, https://www.mathertel.de
  *
@@ -17,6 +17,8 @@
  * * 14.02.2020 created by Matthias Hertel
  * * 07.05.2022 can read more Dallas Temp Sensors using DallasTemperature library.
  *              renamed from DS18B20Element to DallasElement.
+ * * 18.10.2026 read multiple probes without blocking using a broadcast conversion.
+ * * 18.10.2026 full conversion time when a DS18S20 is on the bus.
  */
 
 #pragma once
@@ -26,6 +28,22 @@
 /**
  * @brief The DallasElement  is an special Element that creates actions based on a
  * digital IO signal.
+ * @details
+@verbatim
+
+The ROM codes of up to 8 probes on the bus are searched once when the element starts.
+
+A reading starts a conversion on all probes with a single broadcast "CONVERT T" command and
+waits for the conversion time of the configured resolution. Then the scratchpad of one probe
+is read in every loop so the loop is only blocked for a single transfer.
+
+The values of all probes are reported as "t0,t1,...". The value of a probe is empty when the
+CRC of the scratchpad was wrong and the number of CRC errors of every probe is counted.
+
+The value of the first probe is sent with the ontemperature action,
+the value of every probe is sent with the probes[n]/ontemperature action.
+
+@endverbatim
  */
 class DallasElement : public SensorElement {
 
@@ -82,5 +100,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DallasElement  in the ElementRegistry.
 bool DallasElement ::registered =
-  ElementRegistry::registerElement("dallas", DallasElement ::create);
+  ElementRegistry::registerElement("dallas", DallasElement::create, sizeof(DallasElement));
 #endif
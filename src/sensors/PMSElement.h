@@ -90,14 +90,14 @@ private:
   /**
    * @brief The _changeAction holds the actions that is submitted when new data was received from the sensor.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 };
 
 /* ===== Register the Element ===== */
 
 #ifdef HOMEDING_REGISTER
 bool PMSElement::registered =
-    ElementRegistry::registerElement("pms", PMSElement::create);
+    ElementRegistry::registerElement("pms", PMSElement::create, sizeof(PMSElement));
 #endif
 
 #elif defined(ESP32)
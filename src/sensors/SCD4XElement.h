@@ -83,5 +83,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the SCD4XElement in the ElementRegistry.
-bool SCD4XElement::registered = ElementRegistry::registerElement("scd4x", SCD4XElement::create);
+bool SCD4XElement::registered = ElementRegistry::registerElement("scd4x", SCD4XElement::create, sizeof(SCD4XElement));
 #endif
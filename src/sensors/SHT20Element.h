@@ -76,5 +76,5 @@ private:
 
 #ifdef HOMEDING_REGISTER
 // Register the SHT20Element in the ElementRegistry.
-bool SHT20Element::registered = ElementRegistry::registerElement("sht20", SHT20Element::create);
+bool SHT20Element::registered = ElementRegistry::registerElement("sht20", SHT20Element::create, sizeof(SHT20Element));
 #endif
@@ -19,6 +19,7 @@
 #include <HomeDing.h>
 
 #include <sensors/SensorElement.h>
+#include <ListUtils.h>
 
 #if ! defined(TRACE)
 #define TRACE(...) // LOGGER_ETRACE(__VA_ARGS__)
@@ -29,6 +30,12 @@
 #define STATE_READ 2  // Reading a value
 #define STATE_SEND 3  // Sending Data
 
+#define FILTER_LIST "none,average,median,smooth"
+#define FILTER_NONE 0
+#define FILTER_AVERAGE 1
+#define FILTER_MEDIAN 2
+#define FILTER_SMOOTH 3
+
 SensorElement::SensorElement() {}
 
 /**
@@ -41,6 +48,40 @@ bool SensorElement::set(const char *name, const char *value) {
     // done.
   } else if (_stricmp(name, "readtime") == 0) {
     _readTime = _scanDuration(value);
+    _curReadTime = _readTime;
+
+  } else if (_stricmp(name, "minreadtime") == 0) {
+    _minReadTime = _scanDuration(value);
+
+  } else if ((_stricmp(name, "filter") == 0) || (_stricmp(name, "deadband") == 0)) {
+    // a list of settings per value, the last setting is used for the remaining values.
+    if (!_filters) {
+      _filters = new (std::nothrow) ValueFilter[SENSOR_MAX_VALUES];
+    }
+    if (_filters) {
+      bool isFilter = (_stricmp(name, "filter") == 0);
+      String item;
+      for (int n = 0; n < SENSOR_MAX_VALUES; n++) {
+        String next = ListUtils::at(value, n);
+        if (!next.isEmpty()) item = next;
+        if (isFilter) {
+          _filters[n].type = max(ListUtils::indexOf(FILTER_LIST, item.c_str()), FILTER_NONE);
+        } else {
+          _filters[n].deadband = item.toFloat();
+        }
+      }
+    }
+
+  } else if (_stricmp(name, "filtersize") == 0) {
+    _filterSize = constrain(_atoi(value), 2, 16);
+    if (_filters) {
+      // restart filtering with the new size
+      for (int n = 0; n < SENSOR_MAX_VALUES; n++) {
+        delete[] _filters[n].data;
+        _filters[n].data = nullptr;
+        _filters[n].count = _filters[n].pos = 0;
+      }
+    }
 
   } else if (_stricmp(name, "resendtime") == 0) {
     _resendTime = _scanDuration(value);
@@ -68,6 +109,7 @@ void SensorElement::start() {
 
   // _sensorWorkedOnce = false;
   _state = STATE_WAIT;
+  _curReadTime = _readTime;
   _lastRead = now + _warmupTime - _readTime;  // now + some seconds. allowing the sensor to get values.
   _nextSend = 0;
 }  // start()
@@ -102,7 +144,7 @@ void SensorElement::loop() {
     }
 
   } else if (_state == STATE_WAIT) {
-    if ((now - _lastRead) < _readTime) {
+    if ((now - _lastRead) < _curReadTime) {
       // just wait on...
 
     } else {
@@ -115,16 +157,31 @@ void SensorElement::loop() {
     // TRACE("reading...");
 
     if (getProbe(value)) {
+      bool changed = false;
+
       if (value.length() > 0) {
         // it's a valid value from the sensor
         _sensorWorkedOnce = true;
-        if (!value.equals(_lastValues)) {
+        bool inDeadband = (_filters && _filterValues(value));
+        if (!inDeadband && !value.equals(_lastValues)) {
           _lastValues = value;
           _nextSend = now;  // enforce sending now
-          _state = STATE_SEND;
+          changed = true;
+        } else {
+          _suppressedCount++;
         }  // if
+      }  // if
+
+      if (_minReadTime) {
+        // read faster while values are changing, slower while stable.
+        if (changed) {
+          _curReadTime = max(_minReadTime, _curReadTime / 2);
+        } else {
+          _curReadTime = min(_readTime, _curReadTime * 2);
+        }
+      }  // if
 
-      } else if (_nextSend && (_nextSend < now)) {
+      if (changed || (_nextSend && (_nextSend <= now))) {
         _state = STATE_SEND;
 
       } else {
@@ -137,8 +194,10 @@ void SensorElement::loop() {
   } else if (_state == STATE_SEND) {
     // time to send sensor data
     // TRACE("sending...");
-    if (!_lastValues.isEmpty())
+    if (!_lastValues.isEmpty()) {
       sendData(_lastValues);
+      _sentCount++;
+    }
 
     _lastRead = now;
     _nextSend = (_resendTime ? now + _resendTime : 0);
@@ -155,9 +214,95 @@ void SensorElement::pushState(
       Element::getItemValue(_stateKeys, n).c_str(),
       Element::getItemValue(_lastValues, n).c_str());
   }
+  callback("sent", String(_sentCount).c_str());
+  callback("suppressed", String(_suppressedCount).c_str());
 }  // pushState()
 
 
+// ===== private functions =====
+
+// Filter all numeric values and format them with the same number of decimals.
+// Returns true when all values are within the deadband of the last sent values.
+bool SensorElement::_filterValues(String &values) {
+  String out;
+  bool inDeadband = !_lastValues.isEmpty();
+  int count = ListUtils::length(values);
+
+  for (int n = 0; n < count; n++) {
+    String item = ListUtils::at(values, n);
+    String last = ListUtils::at(_lastValues, n);
+    ValueFilter *f = &_filters[min(n, SENSOR_MAX_VALUES - 1)];
+
+    if (n >= SENSOR_MAX_VALUES) {
+      // not filtered
+      if (!item.equals(last)) inDeadband = false;
+
+    } else if (!item.isEmpty()) {
+      float v = item.toFloat();
+
+      if (f->type != FILTER_NONE) {
+        if (!f->data) {
+          f->data = new (std::nothrow) float[_filterSize];
+        }
+        if (f->data) {
+          if (f->type == FILTER_SMOOTH) {
+            // exponential smoothing with alpha = 1 / filtersize
+            f->data[0] = f->count ? f->data[0] + (v - f->data[0]) / _filterSize : v;
+            f->count = 1;
+            v = f->data[0];
+
+          } else {
+            f->data[f->pos] = v;
+            f->pos = (f->pos + 1) % _filterSize;
+            if (f->count < _filterSize) f->count++;
+
+            float s[16];
+            memcpy(s, f->data, f->count * sizeof(float));
+            if (f->type == FILTER_AVERAGE) {
+              v = 0;
+              for (int i = 0; i < f->count; i++) v += s[i];
+              v = v / f->count;
+
+            } else {
+              // median using insertion sort
+              for (int i = 1; i < f->count; i++) {
+                float x = s[i];
+                int j = i - 1;
+                while ((j >= 0) && (s[j] > x)) {
+                  s[j + 1] = s[j];
+                  j--;
+                }
+                s[j + 1] = x;
+              }
+              v = s[f->count / 2];
+            }
+          }  // if
+
+          // format like the sensor value
+          const char *dot = strchr(item.c_str(), '.');
+          item = String(v, dot ? strlen(dot + 1) : 0);
+        }
+      }  // if
+
+      if (f->deadband > 0) {
+        if (last.isEmpty() || (fabs(v - last.toFloat()) > f->deadband)) inDeadband = false;
+      } else if (!item.equals(last)) {
+        inDeadband = false;
+      }
+
+    } else if (!last.isEmpty()) {
+      inDeadband = false;
+    }  // if
+
+    if (n > 0) out.concat(',');
+    out.concat(item);
+  }  // for
+
+  values = out;
+  return (inDeadband);
+}  // _filterValues()
+
+
 // ===== protected functions =====
 
 void SensorElement::setWait(unsigned long waitMilliseconds) {
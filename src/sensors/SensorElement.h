@@ -14,10 +14,29 @@
  *
  * Changelog:
  * * 12.02.2020 created by Matthias Hertel from DHT Element implemenation.
+ * * 18.10.2026 support 5 values.
+ * * 18.10.2026 value filters, deadband, adaptive read time and counters.
+ *
+ * @details
+@verbatim
+The values of a sensor can be filtered before they are compared to the last values:
+
+* filter: "average", "median" or "smooth" (exponential smoothing) over filtersize samples.
+  A list like "median,none" configures the filter per value.
+* deadband: a new value is not sent when it differs less than the deadband from the last
+  sent value. A list like "0.2,1" configures the deadband per value.
+* minreadtime: the read time is halved down to minreadtime when the values change and
+  doubled up to readtime while they are stable.
+
+The state reports the number of sent and suppressed values.
+@endverbatim
  */
 
 #pragma once
 
+/// max. number of values of a sensor that can be filtered.
+#define SENSOR_MAX_VALUES 8
+
 /**
  * @brief The SensorElement acts as the base class for sensor elements that need collecting sensor data on a regular basis.
  */
@@ -68,7 +87,7 @@ protected:
   String _stateKeys;  ///< list of keys in the state used for sensor values
 
   // The actions for value[0], value[1]
-  String _actions[4];
+  HomeDing::Actions::ActionString _actions[5];
 
   /// set duration for waiting to next communication with the sensor
   virtual void setWait(unsigned long waitMilliseconds);
@@ -80,9 +99,36 @@ protected:
   virtual void sendData(String &values);
 
 private:
+  /// filter settings and samples of a single value
+  struct ValueFilter {
+    uint8_t type = 0;        ///< 0: none, 1: average, 2: median, 3: smooth
+    uint8_t count = 0;       ///< number of samples in data
+    uint8_t pos = 0;         ///< next position in data
+    float deadband = 0;      ///< min. difference to the last sent value
+    float *data = nullptr;   ///< the last samples, allocated when needed
+  };
+
+  /// filters of the values, allocated when filter or deadband is configured.
+  ValueFilter *_filters = nullptr;
+
+  /// number of samples used by the filters.
+  uint8_t _filterSize = 5;
+
+  /// apply the filters and return true when the values are within the deadband.
+  bool _filterValues(String &values);
+
   /// The time between reading 2 probes. Default Setting: 60 seconds.
   unsigned long _readTime = 60 * 1000;
 
+  /// The min. time between reading 2 probes when values are changing. 0: no adaptive read time.
+  unsigned long _minReadTime = 0;
+
+  /// The current time between reading 2 probes.
+  unsigned long _curReadTime = 60 * 1000;
+
+  unsigned long _sentCount = 0;  ///< number of sent values
+  unsigned long _suppressedCount = 0;  ///< number of read values that were not sent
+
   /// The current values should be emitted again after some time even when not changing.
   unsigned long _resendTime = 0;
 
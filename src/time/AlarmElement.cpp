@@ -37,6 +37,7 @@ Element *AlarmElement::create()
 
 AlarmElement::AlarmElement() {
   startupMode = Element::STARTUPMODE::Time;
+  category = CATEGORY::Standard; // woken up by the board calendar
 }
 
 
@@ -49,6 +50,9 @@ bool AlarmElement::set(const char *name, const char *value)
 
   if (_stricmp(name, "time") == 0) {
     _time = _atotime(value);
+    if (active) {
+      _board->wakeAt(this, 0);
+    }
 
   } else if (_stricmp(name, "onTime") == 0) {
     _timeAction = value;
@@ -72,6 +76,7 @@ void AlarmElement::start()
 
   // if (parameters ok) {
   Element::start();
+  _board->wakeAt(this, 0);
   // } // if
 
 } // start()
@@ -91,6 +96,9 @@ void AlarmElement::loop()
     }
     _lastTime = ct;
   } // if
+
+  // sleep until the alarm time
+  _board->wakeAt(this, Board::nextTimeOfDay(_time));
 } // loop()
 
 
@@ -13,6 +13,7 @@
  * 
  * Changelog:
  * * 20.11.2018 created by Matthias Hertel
+ * * 18.10.2026 sleeping until the alarm time using the board calendar.
  */
 
 #pragma once
@@ -86,7 +87,7 @@ private:
   /**
    * @brief The _timeAction holds the actions that is submitted when ...
    */
-  String _timeAction;
+  HomeDing::Actions::ActionString _timeAction;
 };
 
 /* ===== Register the Element ===== */
@@ -94,5 +95,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the AlarmElement onto the ElementRegistry.
 bool AlarmElement::registered =
-    ElementRegistry::registerElement("alarm", AlarmElement::create);
+    ElementRegistry::registerElement("alarm", AlarmElement::create, sizeof(AlarmElement));
 #endif
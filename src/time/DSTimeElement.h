@@ -102,5 +102,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the DSTimeElement onto the ElementRegistry.
 bool DSTimeElement::registered =
-    ElementRegistry::registerElement("dstime", DSTimeElement::create);
+    ElementRegistry::registerElement("dstime", DSTimeElement::create, sizeof(DSTimeElement));
 #endif
@@ -77,5 +77,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the NTPTimeElement onto the ElementRegistry.
 bool NTPTimeElement::registered =
-    ElementRegistry::registerElement("ntptime", NTPTimeElement::create);
+    ElementRegistry::registerElement("ntptime", NTPTimeElement::create, sizeof(NTPTimeElement));
 #endif
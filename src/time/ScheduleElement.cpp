@@ -43,6 +43,7 @@ Element *ScheduleElement::create()
 ScheduleElement::ScheduleElement()
 {
   startupMode = Element::STARTUPMODE::Time;
+  category = CATEGORY::Standard; // woken up by the board calendar
 }
 
 /**
@@ -66,9 +67,11 @@ bool ScheduleElement::set(const char *name, const char *value)
 
   if (_stricmp(name, "ontime") == 0) {
     _startTime = _atotime(value);
+    _wakeup();
 
   } else if (_stricmp(name, "offtime") == 0) {
     _endTime = _atotime(value);
+    _wakeup();
 
   } else if (_stricmp(name, "onon") == 0) {
     _onAction = value;
@@ -84,6 +87,7 @@ bool ScheduleElement::set(const char *name, const char *value)
     } else if (_stricmp(value, "timer") == 0) {
       _mode = Mode::TIMER;
     }
+    _wakeup();
 
   } else if (name == HomeDing::Actions::OnValue) {
     _valueAction = value;
@@ -108,6 +112,7 @@ void ScheduleElement::start()
     LOGGER_EERR("no time set");
   } else {
     Element::start();
+    _wakeup();
   } // if
 } // start()
 
@@ -151,6 +156,11 @@ void ScheduleElement::loop()
   } // if
   _init = true;
   _value = newValue;
+
+  // sleep until the next switching time
+  time_t next = Board::nextTimeOfDay(_startTime);
+  time_t nextEnd = Board::nextTimeOfDay(_endTime);
+  _board->wakeAt(this, (nextEnd < next) ? nextEnd : next);
 } // loop()
 
 
@@ -167,4 +177,15 @@ void ScheduleElement::pushState(
   callback(HomeDing::Actions::Value, _value ? "1" : "0");
 } // pushState()
 
+
+/**
+ * @brief evaluate the schedule as soon as possible after a configuration change.
+ */
+void ScheduleElement::_wakeup()
+{
+  if (active) {
+    _board->wakeAt(this, 0);
+  }
+} // _wakeup()
+
 // End
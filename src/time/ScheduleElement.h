@@ -13,6 +13,7 @@
  *
  * Changelog:
  * * 30.07.2018 created by Matthias Hertel
+ * * 18.10.2026 sleeping until the next switching time using the board calendar.
  */
 
 #pragma once
@@ -100,21 +101,26 @@ private:
   /**
    * @brief The _onAction holds the actions that is submitted when the scheduled time period starts.
    */
-  String _onAction;
+  HomeDing::Actions::ActionString _onAction;
 
   /**
    * @brief The _offAction holds the actions that is submitted when the scheduled time period ends.
    */
-  String _offAction;
+  HomeDing::Actions::ActionString _offAction;
 
   /**
    * @brief The _valueAction holds the actions that is submitted when the scheduled time period starts or ends with a value of 1 and 0.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
+
+  /**
+   * @brief evaluate the schedule as soon as possible after a configuration change.
+   */
+  void _wakeup();
 };
 
 #ifdef HOMEDING_REGISTER
 // Register the ScheduleElement onto the ElementRegistry.
 bool ScheduleElement::registered =
-    ElementRegistry::registerElement("schedule", ScheduleElement::create);
+    ElementRegistry::registerElement("schedule", ScheduleElement::create, sizeof(ScheduleElement));
 #endif
@@ -45,6 +45,7 @@ Element *TimeElement::create() {
 
 TimeElement::TimeElement() {
   startupMode = Element::STARTUPMODE::Time;
+  category = CATEGORY::Standard;  // woken up by the board calendar
 }
 
 
@@ -85,6 +86,7 @@ void TimeElement::start() {
   _lastDate = 0;
 
   Element::start();
+  _board->wakeAt(this, 0);
 }  // start()
 
 
@@ -92,29 +94,36 @@ void TimeElement::start() {
  * @brief check the state of the DHT values and eventually create actions.
  */
 void TimeElement::loop() {
-  time_t ct = time(nullptr);  // will not return 0, as a TIME element is started after localtime is available.
+  time_t ct = time(nullptr);
+  const struct tm *lt = Board::getLocalTime(&ct);  // shared local time of the board.
 
   // check for time actions...
-  if ((ct > 0) && (_lastTimestamp != ct)) {
-    struct tm *lt = localtime(&ct);
+  if ((lt) && (_lastTimestamp != ct)) {
     _sendAction(_timeAction, TIME_timeFmt, lt);
     _sendAction(_timestampAction, TIME_timestampFmt, lt);
     _lastTimestamp = ct;
 
     // ignore seconds
-    ct -= (ct % 60);
-    if (_lastMinute != ct) {
+    time_t minute = ct - lt->tm_sec;
+    if (_lastMinute != minute) {
       _sendAction(_minuteAction, TIME_minuteFmt, lt);
-      _lastMinute = ct;
+      _lastMinute = minute;
     }  // if
 
-    // ignore time
-    ct -= (ct % (24 * 60 * 60));
-    if (_lastDate != ct) {
+    // the local date
+    time_t date = (lt->tm_year * 400) + lt->tm_yday;
+    if (_lastDate != date) {
       _sendAction(_dateAction, TIME_dateFmt, lt);
-      _lastDate = ct;
+      _lastDate = date;
     }  // if
   }    // if
+
+  // sleep until the next second or minute
+  if ((!lt) || (_timeAction.length()) || (_timestampAction.length())) {
+    _board->wakeAt(this, ct + 1);
+  } else {
+    _board->wakeAt(this, ct - lt->tm_sec + 60);
+  }
 }  // loop()
 
 
@@ -126,7 +135,7 @@ void TimeElement::loop() {
  * @param fmt Format for the value.
  * @param tmp the local time
  */
-void TimeElement::_sendAction(String &action, const char *fmt, struct tm *tmp) {
+void TimeElement::_sendAction(HomeDing::Actions::ActionString &action, const char *fmt, const struct tm *tmp) {
   if (action.length()) {
     char b[32];
     strftime(b, sizeof(b), fmt, tmp);
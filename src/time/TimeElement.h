@@ -14,6 +14,7 @@
  *
  * Changelog:
  * * 09.10.2018 created by Matthias Hertel
+ * * 18.10.2026 using the shared local time and the board calendar.
  */
 
 #pragma once
@@ -69,23 +70,23 @@ private:
    * @param fmt Format for the value.
    * @param tmp the local time
    */
-  void _sendAction(String &action, const char *fmt, struct tm *tmp);
+  void _sendAction(HomeDing::Actions::ActionString &action, const char *fmt, const struct tm *tmp);
 
   time_t _lastTimestamp;
   time_t _lastMinute;
   time_t _lastDate;
 
   // action send everytime the time has changed, value = hh:mm:ss
-  String _timeAction;
+  HomeDing::Actions::ActionString _timeAction;
 
   // action send everytime the date has changed, value = YYYY-MM-DD hh:mm:ss
-  String _timestampAction;
+  HomeDing::Actions::ActionString _timestampAction;
 
   // action send everytime the time has changed, value = hh:mm
-  String _minuteAction;
+  HomeDing::Actions::ActionString _minuteAction;
 
   // action send everytime the date has changed, value = YYYY-MM-DD
-  String _dateAction;
+  HomeDing::Actions::ActionString _dateAction;
 };
 
 // ===== Register =====
@@ -93,5 +94,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the TimeElement onto the ElementRegistry.
 bool TimeElement::registered =
-    ElementRegistry::registerElement("time", TimeElement::create);
+    ElementRegistry::registerElement("time", TimeElement::create, sizeof(TimeElement));
 #endif
@@ -124,24 +124,24 @@ private:
    * @brief The _highAction holds the actions that is submitted when the pulse
    * period starts.
    */
-  String _highAction;
+  HomeDing::Actions::ActionString _highAction;
 
   /**
    * @brief The _lowAction holds the actions that is submitted when the pulse
    * period ends.
    */
-  String _lowAction;
+  HomeDing::Actions::ActionString _lowAction;
 
   /**
    * @brief The _valueAction holds the actions that are submitted when a new pulse
    * level is available on start or end of the pulse period.
    */
-  String _valueAction;
+  HomeDing::Actions::ActionString _valueAction;
 
   /**
    * @brief The _endAction holds the actions that is submitted when the timer cycletime is over.
    */
-  String _endAction;
+  HomeDing::Actions::ActionString _endAction;
 
   /**
    * @brief The effective time (in milliseconds) the timer has started.
@@ -153,5 +153,5 @@ private:
 #ifdef HOMEDING_REGISTER
 // Register the TimerElement onto the ElementRegistry.
 bool TimerElement::registered =
-    ElementRegistry::registerElement("timer", TimerElement::create);
+    ElementRegistry::registerElement("timer", TimerElement::create, sizeof(TimerElement));
 #endif
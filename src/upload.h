@@ -1,14 +1,134 @@
 // file: upload.h
-// contains the minimal html for uploading files
+// contains the minimal html pages gzip compressed.
+// created by builtin/mkupload.py, do not edit.
 
-// minimized from setup.htm: configure the network
-static const char setupContent[] PROGMEM =
-R"==(<!doctype html><html lang="en"><head><meta charset="utf-8"><meta name="viewport"content="width=device-width,initial-scale=1"><title>Setup WiFi</title></head><body style="width:300px"><h1>Setup WiFi</h1><div style="display:grid;grid-template-columns:10ch auto;grid-gap:1ch"><label>Devicename:</label><span id="d">.</span> <label>Network:</label><span><select id="n"style="width:12em"><option selected="selected"disabled="disabled">scanning...</option></select></span><label>Passphrase:</label><input id="pass"type="password"style="width:12em"><label>format:</label><span><input id="fmt"type="checkbox"></span></div><div style="text-align:right"><button id="b">Connect</button></div><script>var timer,dn,d=document,s=0,oSel=d.getElementById("n"),oBtn=d.getElementById("b");async function check(){let e,t;0==s?(s=1,e=await fetch("/api/sysinfo"),t=await e.text(),t.length>0&&(dn=JSON.parse(t).devicename,d.getElementById("d").textContent=dn,s=2)):2==s?(s=3,e=await fetch("/api/scan"),t=await e.text(),0==t.length?s=2:(scanned(JSON.parse(t)),s=4)):4==s&&(window.clearInterval(timer),timer=0)}function scanned(e){oSel.innerHTML="";var t=d.createElement("option");t.value=0,t.text="select...",t.disabled=!0,oSel.options.add(t),e.forEach(function(e){var t=d.createElement("option");t.value=t.text=e.id,oSel.options.add(t)})}oBtn.addEventListener("click",async()=>{if(4==s){let e=`/api/connect?n=${oSel.value}&p=${d.getElementById("pass").value}`;d.getElementById("fmt").checked&&(e+="f=1");try{await fetch(e)}catch(e){}s=5,oBtn.textContent=">>>"}else 5==s&&(location.href=`//${dn}/$update.htm`)}),timer=window.setInterval(check,300)</script></body></html>)==";
+#pragma once
 
-// minimized from upload.htm
-static const char uploadContent[] PROGMEM =
-R"==(<!doctype html><html lang="en"><head><meta charset="utf-8"><meta name="viewport"content="width=device-width,initial-scale=1"><title>Upload</title></head><body style="width:300px"><h1>Upload</h1><div id="zone"style="width:260px;height:5em;padding:20px;background-color:#ddd">Drop here</div><a href="#i">I-Upload</a><hr><p style="text-align:right"><a href="/microide.htm">&gt;&gt;&gt;</a></p><script>function dragHelper(e){e.stopPropagation(),e.preventDefault()}function dropped(e){dragHelper(e);for(var n=e.dataTransfer.files,r=new FormData,t="/"+(location.hash?location.hash.substring(1)+"/":""),a=0;a<n.length;a++)r.append("file",n[a],t+n[a].name);fetch("/",{method:"POST",body:r}).then(function(){window.alert("done.")})}var zoneObj=document.getElementById("zone");zoneObj.addEventListener("dragenter",dragHelper,!1),zoneObj.addEventListener("dragover",dragHelper,!1),zoneObj.addEventListener("drop",dropped,!1)</script></body></html>)==";
+// setup.htm: configure the network (1647 bytes)
+static const uint8_t setupContent[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x55,0x51,0x8f,0xdb,0x36,0x0c,0xfe,0x2b,0xae,
+  0x50,0x1c,0x6c,0xcc,0x91,0x93,0x6b,0x0b,0x0c,0x89,0xe5,0x03,0xda,0xde,0xb0,0x16,0x6d,0x37,0xe0,0x06,
+  0xf4,0xf5,0x14,0x89,0x89,0x85,0x93,0x65,0xc3,0xa2,0x93,0x06,0x41,0xfe,0x7b,0x29,0xcb,0xb9,0x35,0xbb,
+  0x3c,0xec,0xc5,0xb6,0x28,0x8a,0xfc,0xc8,0xef,0xa3,0x5c,0xbe,0xd2,0xad,0xc2,0x43,0x07,0x49,0x8d,0x8d,
+  0xad,0xca,0xf0,0x4c,0xac,0x74,0x5b,0xc1,0xc0,0x31,0x5a,0x83,0xd4,0x55,0xd9,0x00,0xca,0x44,0xd5,0xb2,
+  0xf7,0x80,0x82,0x0d,0xb8,0x99,0xfd,0xce,0x26,0xab,0x93,0x0d,0x08,0xb6,0x33,0xb0,0xef,0xda,0x1e,0x99,
+  0x6a,0x1d,0x82,0x23,0xa7,0xbd,0xd1,0x58,0x0b,0x0d,0x3b,0xa3,0x60,0x36,0x2e,0x72,0xe3,0x0c,0x1a,0x69,
+  0x67,0x5e,0x49,0x0b,0x62,0x41,0x11,0xd0,0xa0,0x85,0xea,0x01,0x70,0xe8,0x92,0xef,0xe6,0x0f,0x53,0x16,
+  0xd1,0x52,0x16,0x31,0xef,0xba,0xd5,0x87,0xc4,0xe3,0x81,0xdc,0x63,0xc0,0xe5,0x9b,0xf9,0xbc,0xfb,0x11,
+  0x70,0x2d,0x2e,0x8e,0xd1,0xb2,0xd4,0x66,0x77,0xf6,0xd5,0xc6,0x77,0x56,0x1e,0x96,0xdb,0xde,0xe8,0x55,
+  0x78,0xcc,0x10,0x1a,0xb2,0x20,0xcc,0x54,0x6b,0x87,0xc6,0xf9,0xe5,0x62,0xae,0xea,0x44,0x0e,0xd8,0xc6,
+  0xfd,0xad,0xec,0x96,0x0b,0x55,0x53,0x64,0x2b,0xd7,0x60,0xab,0x8f,0x23,0xf0,0x50,0xdc,0xb2,0x2c,0xa2,
+  0xa9,0xf4,0x9d,0x74,0x89,0xd1,0x14,0x9e,0x55,0xbc,0x2c,0xc2,0xb2,0x4a,0x26,0xff,0x6f,0x80,0xfb,0xb6,
+  0x7f,0xba,0x74,0xa6,0x27,0x58,0x50,0x38,0x1e,0x72,0xec,0xa2,0x90,0xc5,0x2d,0x34,0x94,0xad,0xed,0xd0,
+  0xb4,0x2e,0x89,0x7e,0x40,0x6e,0xe7,0xaf,0x50,0x83,0x5c,0xdb,0x60,0x3a,0x7f,0xb1,0x8a,0x3a,0xe7,0x9c,
+  0x71,0x5b,0xce,0x29,0x7f,0x3c,0x4a,0xbd,0x8a,0x47,0xaa,0x09,0xd1,0x04,0xe8,0x6f,0xe9,0x7d,0x57,0xf7,
+  0xd2,0xff,0x52,0x80,0x71,0xdd,0x10,0xc1,0x74,0xb4,0xcb,0x02,0xed,0xf1,0x93,0xa0,0xeb,0xab,0xf0,0xe2,
+  0xc1,0x4d,0xdb,0x37,0x12,0xff,0x5b,0xdb,0xbf,0xd1,0x36,0x0d,0x4e,0xc1,0x54,0x0d,0xea,0x69,0xdd,0x06,
+  0x86,0x26,0x34,0x05,0xd1,0x72,0xc1,0x0d,0xc2,0x0f,0x9c,0x49,0x6b,0xb6,0x6e,0xd9,0x9b,0x6d,0x8d,0xe4,
+  0xba,0x1e,0x10,0xdb,0xd8,0xda,0x35,0xab,0x3e,0xb4,0xce,0x51,0x3d,0x65,0x11,0xcd,0xe7,0x10,0x5e,0xf5,
+  0xa6,0xc3,0x6a,0x27,0xfb,0x04,0x4d,0x03,0x7d,0xae,0x5d,0xae,0x05,0xa9,0x77,0x68,0x48,0x70,0xb9,0x17,
+  0xf3,0xbc,0x7d,0x00,0x2b,0x34,0xdf,0x02,0xde,0x5b,0x08,0xd6,0xf7,0x87,0x4f,0x3a,0xa5,0xce,0x67,0x79,
+  0xfb,0x1e,0xdd,0x95,0xad,0x35,0xcb,0x56,0xd2,0x1f,0x9c,0x4a,0x36,0x83,0x53,0x23,0x15,0x63,0x09,0x69,
+  0x76,0xb4,0x80,0x09,0xe4,0xb8,0x9a,0x0b,0xe1,0xef,0x52,0x2f,0x16,0x39,0x08,0xb9,0x97,0x06,0x93,0x0d,
+  0xa0,0xaa,0x53,0x56,0xc8,0xce,0x14,0xfe,0xe0,0x8d,0xdb,0xb4,0x94,0x01,0xa7,0x5d,0xe0,0xa1,0xc2,0x94,
+  0x0c,0xdc,0x82,0xdb,0x62,0x5d,0xcd,0x6f,0x6e,0x52,0xed,0xc4,0xe7,0x87,0xbf,0xbe,0xf1,0x2e,0xcc,0x50,
+  0x8a,0x19,0xd7,0xcf,0x02,0xcb,0x5f,0xc2,0xd2,0x2c,0x1b,0xa3,0x7c,0x98,0xa6,0x89,0x4a,0xf5,0xe2,0x36,
+  0xcb,0x96,0xb7,0x13,0x98,0x37,0xd7,0xc1,0x90,0x3c,0xae,0x21,0xa1,0x12,0xce,0x60,0xee,0x28,0xce,0x32,
+  0x1d,0x75,0x04,0x3a,0xbd,0x80,0x94,0x51,0x8e,0xb7,0x94,0xe3,0x2d,0xe5,0x20,0xc4,0x7b,0xe3,0x74,0xbb,
+  0xe7,0xca,0x82,0xec,0x3f,0x11,0x8c,0x7e,0x27,0x6d,0x3a,0x76,0x9e,0x32,0x84,0x97,0x98,0x67,0xa7,0xe7,
+  0xae,0x9d,0x23,0x42,0x76,0x0c,0x2c,0x70,0x43,0xab,0xfe,0xcf,0x7f,0xbe,0x7e,0x11,0x8c,0xad,0x46,0xce,
+  0xa8,0xfb,0xaa,0x07,0x1a,0xc1,0xa9,0xd2,0x94,0x45,0x01,0x13,0x03,0xc8,0x29,0xf6,0x00,0xc4,0x20,0x8e,
+  0x90,0xcf,0x53,0x40,0x32,0x67,0x64,0x7a,0x9e,0x84,0x57,0x91,0x62,0x1e,0x0f,0x7a,0x2e,0xb5,0x26,0xdc,
+  0x39,0x70,0x12,0xe8,0xbd,0xa4,0x36,0x9c,0xe1,0x04,0x18,0xff,0x37,0xe9,0x94,0x12,0xb8,0xd1,0xd7,0xa2,
+  0x9f,0xb2,0x53,0xd0,0x4e,0x58,0xdd,0xef,0x28,0xc2,0x17,0xe3,0x89,0x12,0xe8,0x53,0xa6,0xac,0x51,0x4f,
+  0x2c,0x1f,0xe5,0x93,0x66,0xa2,0x3a,0x9a,0x4d,0x1a,0x7a,0x37,0x49,0x47,0x3c,0x8e,0x9c,0xa8,0xa8,0xe6,
+  0x3b,0x27,0x5e,0xc7,0xce,0x8c,0x59,0x4f,0x37,0x1d,0xad,0x5f,0x12,0x3f,0xce,0x65,0x36,0xf9,0x3c,0xae,
+  0x5e,0x3a,0x84,0x51,0xcb,0xf8,0xa8,0x51,0xd0,0xc4,0x12,0xfc,0x46,0xe3,0x47,0x77,0x29,0xd5,0xd3,0x1f,
+  0x8e,0xbf,0x4a,0x02,0xb2,0x93,0x92,0xf1,0xe3,0x78,0xf2,0xe2,0xdd,0x38,0x02,0x17,0xaa,0x62,0x55,0x55,
+  0xb1,0x13,0x58,0x0f,0xc9,0xbb,0xc8,0xb9,0x6d,0xe9,0x08,0x15,0xcf,0xeb,0x1e,0x36,0x54,0x40,0x41,0x18,
+  0xdd,0xa9,0x78,0x3d,0x74,0x9a,0x7a,0xc8,0xe9,0xe7,0xf0,0x48,0x0d,0x99,0xe8,0x9f,0x04,0x42,0xbf,0x84,
+  0x67,0x79,0x8c,0xb8,0x72,0xba,0xa3,0x33,0x1a,0xff,0x38,0xaf,0x34,0xc6,0x74,0x89,0x87,0x1b,0x3d,0xfc,
+  0x5f,0x7e,0x02,0xc3,0x91,0xaf,0x9c,0x6f,0x06,0x00,0x00,
+};
 
-// minimized from boot.htm
-static const char updateContent[] PROGMEM =
-R"==(<!doctype html><html lang="en"><head><meta charset="utf-8"><meta name="viewport"content="width=device-width,initial-scale=1"><title>Web Update</title></head><body style="width:300px"><h1>Web Update</h1><div style="display:grid"><progress value="0"max="20"></progress><span id="l"style="height:2rem"></span></div><div style="text-align:right"><button>Start</button></div><script>var w,si,r,d=document,s=0,repo="https://homeding.github.io/",eBar=d.querySelector("progress"),oBtn=d.querySelector("button"),x=0,a=0,t=0,seed="?"+(new Date).valueOf();function log(e){d.querySelector("#l").innerText=e}async function doF(){var e=w.shift();if(log(e),"-"!==e[0]){r=await fetch(repo+e+seed),r=await r.arrayBuffer();var t=new FormData;t.append("file",new Blob([r]),"/"+e),await fetch("/",{method:"POST",body:t})}}location.hash?repo+=location.hash.substring(1)+"/":repo+="v09/",log("loading from:\n"+repo),d.querySelector("button").addEventListener("click",()=>{0===s?(oBtn.textContent="-",t=window.setInterval(async function(){a||(a=1,0==s?(log("sysinfo..."),r=await fetch("/api/sysinfo"+seed),si=await r.text()):1==s?(log("list..."),(si=JSON.parse(si)).fsTotalBytes<2e5&&(repo=repo.replace(/(v\d+)\/$/,"$1m/")),r=await fetch(repo+"list.txt"+seed),r=await r.text(),w=r.replace(/\r?\n/g,";").replace(/;$/,"").split(";"),eBar.max=w.length+3):2==s?(log("clean..."),await fetch("/api/cleanweb")):3==s?w.length>0&&(await doF(),s--):4==s&&(window.clearInterval(t),log("done"),oBtn.textContent=">>>"),eBar.value=++x,s++,a=0)},100)):5===s&&(location.href="/updateicons.htm")})</script></body></html>)==";
+// upload.htm: upload files (936 bytes)
+static const uint8_t uploadContent[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x53,0xef,0x6b,0xdb,0x30,0x10,0xfd,0x57,0x5c,
+  0x15,0x86,0x4d,0x1c,0xb9,0xe9,0xd8,0x18,0xfe,0x35,0x18,0xed,0x58,0x61,0xd0,0xc2,0xba,0x4f,0x63,0x1f,
+  0x2e,0xd6,0xd9,0xd6,0xa6,0x48,0x42,0xbe,0x24,0xcd,0x4a,0xfe,0xf7,0x9d,0x92,0x66,0x5d,0xbf,0x0c,0xf6,
+  0xc1,0xb2,0x4e,0xba,0x77,0xf7,0xf4,0xf4,0x54,0x9f,0x29,0xd7,0xd1,0xce,0x63,0x32,0xd2,0xca,0xb4,0x75,
+  0x1c,0x13,0x03,0x76,0x68,0x04,0x5a,0xc1,0x31,0x82,0x6a,0xeb,0x15,0x12,0x24,0xdd,0x08,0x61,0x42,0x6a,
+  0xc4,0x9a,0xfa,0xf9,0x3b,0xf1,0xb4,0x6a,0x61,0x85,0x8d,0xd8,0x68,0xdc,0x7a,0x17,0x48,0x74,0xce,0x12,
+  0x5a,0x4e,0xda,0x6a,0x45,0x63,0xa3,0x70,0xa3,0x3b,0x9c,0x1f,0x82,0x5c,0x5b,0x4d,0x1a,0xcc,0x7c,0xea,
+  0xc0,0x60,0xb3,0xe0,0x0a,0xa4,0xc9,0x60,0xfb,0xd5,0x1b,0x07,0xaa,0x2e,0x8e,0x51,0x5d,0x1c,0x7b,0x2e,
+  0x9d,0xda,0x25,0x13,0xed,0x38,0xf5,0x58,0xac,0x7c,0x7d,0x71,0xe1,0x1f,0x22,0xa7,0xc5,0x1f,0x08,0x4f,
+  0x6b,0xa5,0x37,0x89,0x56,0x8d,0xf8,0xe5,0x2c,0x8a,0x17,0x80,0xcb,0xb7,0x0c,0xa8,0x46,0xd4,0xc3,0x48,
+  0xe5,0x1b,0x5c,0x55,0x1e,0x94,0xd2,0x76,0x28,0x2f,0xe3,0xfa,0x12,0xba,0x9f,0x43,0x70,0x6b,0xab,0xe6,
+  0x9d,0x33,0x2e,0x94,0xe7,0x4a,0x29,0xd1,0x5e,0x05,0xe7,0x93,0x11,0x03,0xd6,0x05,0x57,0x6e,0x6b,0x48,
+  0xc6,0x80,0x7d,0x23,0xce,0xb5,0x68,0x6f,0xe6,0xa7,0xc6,0xc0,0x34,0x42,0x5b,0xfb,0x13,0x43,0xc2,0x07,
+  0x9a,0x83,0xd1,0x83,0x2d,0x43,0x6c,0x27,0x9e,0x81,0xc5,0x4a,0x77,0xc1,0x69,0x85,0x92,0xc5,0x15,0xed,
+  0xab,0x81,0xaa,0xd3,0x77,0xa8,0x53,0xf8,0xb6,0x9e,0xba,0xa0,0x3d,0xb5,0xfd,0xda,0x76,0xa4,0x9d,0x4d,
+  0x54,0x80,0xe1,0x13,0x1a,0x8f,0x21,0xc5,0xec,0x11,0xe5,0x44,0xce,0xdf,0x31,0x31,0x18,0x20,0xee,0xa7,
+  0x59,0x8e,0xd2,0x07,0xdc,0xb0,0xd4,0x57,0xd8,0xc3,0xda,0x50,0x9a,0xed,0xff,0x42,0x3b,0xef,0x51,0x45,
+  0xe8,0x8b,0x42,0x55,0xef,0x42,0xba,0x81,0x90,0xd8,0x06,0xa5,0x02,0x82,0xfb,0x00,0x76,0xea,0x31,0xc8,
+  0x5e,0x1b,0x9c,0xf2,0xd0,0x58,0xdc,0x26,0x1f,0x5d,0x58,0x5d,0xf1,0x66,0xce,0xb7,0x58,0x88,0x59,0x6a,
+  0x5c,0x77,0x68,0x2a,0x47,0x98,0xc6,0xf7,0x2f,0x22,0x39,0xad,0x97,0x13,0x05,0x96,0x34,0x5d,0x64,0x33,
+  0xce,0x2e,0x85,0xc8,0x72,0x68,0x2e,0x2a,0xa8,0xad,0x34,0x68,0x07,0x1a,0x2b,0x98,0xcd,0xb2,0x20,0x81,
+  0x19,0x59,0x95,0x8a,0xd8,0x49,0xe4,0xf6,0x1b,0x7c,0xcf,0x69,0x16,0x7f,0x32,0x3a,0x88,0xa9,0x21,0x75,
+  0x63,0xca,0x25,0xf2,0x47,0xf6,0xd5,0xe8,0x54,0x29,0xee,0x6e,0xbf,0xdc,0x8b,0x3c,0xfa,0xa0,0x0c,0xfb,
+  0x4c,0xd2,0x88,0x36,0x3d,0x9d,0x31,0xcd,0x1e,0xb7,0xda,0x2a,0xb7,0x95,0xec,0xa5,0x40,0xa9,0x50,0x7c,
+  0xfb,0x52,0x64,0xfb,0x6c,0x1f,0x0f,0x18,0xbd,0x70,0xbb,0xfc,0xd1,0xb0,0xb9,0xd7,0x2b,0x16,0x49,0x0e,
+  0x48,0xd7,0x06,0xe3,0xf4,0xc3,0xee,0x86,0x69,0x1c,0xcc,0x92,0x55,0x4f,0x79,0x92,0x7d,0x71,0x1d,0xc5,
+  0xfc,0xac,0x27,0xb6,0x2f,0x8b,0x25,0xa2,0x70,0xbc,0x80,0x41,0xe4,0xcf,0x1a,0xe6,0x67,0x8b,0x2c,0xff,
+  0x37,0xc6,0x6d,0xfe,0x13,0xe2,0x7c,0x4c,0x3f,0x5c,0x58,0xcc,0xad,0x8b,0x27,0x2f,0xd4,0x45,0x3c,0x79,
+  0x7c,0x0e,0xf1,0x61,0xfe,0x06,0xe9,0x92,0x60,0x3c,0xa8,0x03,0x00,0x00,
+};
+
+// boot.htm: update from GitHub (1580 bytes)
+static const uint8_t updateContent[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x55,0xdb,0x6e,0xe3,0x36,0x10,0xfd,0x15,0x2d,
+  0xbb,0x58,0x88,0x10,0x2d,0xc9,0x49,0x17,0x68,0x15,0x53,0x01,0xd2,0x76,0x81,0x16,0x45,0x53,0x20,0x29,
+  0xfa,0xb0,0xd9,0x07,0x5a,0x1a,0x59,0x44,0x69,0x52,0x25,0xc7,0x37,0x78,0xfd,0xef,0x1d,0x4a,0x76,0xd2,
+  0x34,0xe8,0x83,0x68,0x70,0xe6,0xf0,0xcc,0xe5,0x90,0xe3,0xc5,0xbb,0xd6,0x35,0x78,0x18,0x20,0xe9,0x71,
+  0x6d,0xea,0x45,0x5c,0x13,0xa3,0xec,0x4a,0x32,0xb0,0x8c,0xf6,0xa0,0xda,0x7a,0xb1,0x06,0x54,0x49,0xd3,
+  0x2b,0x1f,0x00,0x25,0xdb,0x60,0x37,0xfb,0x8e,0x9d,0xad,0x56,0xad,0x41,0xb2,0xad,0x86,0xdd,0xe0,0x3c,
+  0xb2,0xc6,0x59,0x04,0x4b,0xa0,0x9d,0x6e,0xb1,0x97,0x2d,0x6c,0x75,0x03,0xb3,0x71,0x23,0xb4,0xd5,0xa8,
+  0x95,0x99,0x85,0x46,0x19,0x90,0x73,0x62,0x40,0x8d,0x06,0xea,0x3f,0x61,0x99,0xfc,0x31,0xb4,0x0a,0x61,
+  0x51,0x4c,0x96,0x45,0x31,0xc5,0x5d,0xba,0xf6,0x90,0x04,0x3c,0x10,0x7c,0x22,0xac,0xae,0xcb,0x72,0xd8,
+  0xc7,0xbc,0xe6,0xaf,0x8e,0xd1,0x76,0xd1,0xea,0xed,0x05,0xdb,0xea,0x30,0x18,0x75,0xa8,0x56,0x5e,0xb7,
+  0x04,0x1e,0xbc,0x5b,0x79,0x08,0x21,0xd9,0x2a,0xb3,0x21,0x77,0xc9,0xd6,0x6a,0x2f,0xd9,0x55,0x49,0xbe,
+  0xe2,0xe2,0xac,0x17,0x61,0x50,0x36,0xd1,0xad,0x64,0x86,0x9d,0x79,0x7a,0xd0,0xab,0x1e,0xab,0x2b,0x0f,
+  0xeb,0x08,0x8d,0x00,0xfa,0xa1,0x40,0xaf,0xa2,0x21,0xec,0x71,0xa6,0x8c,0x5e,0xd9,0xca,0x47,0x3c,0x41,
+  0x97,0x1b,0x44,0x67,0xeb,0x07,0x54,0x1e,0x17,0xc5,0x79,0x77,0x3e,0x19,0x1a,0xaf,0x07,0xac,0xb7,0xca,
+  0x27,0x3b,0x11,0xb4,0xf0,0xa2,0x95,0x24,0xc2,0x66,0x4d,0x7d,0x13,0x41,0x96,0xc2,0xc3,0xe0,0x28,0x36,
+  0xe2,0x10,0xaa,0xa2,0xe8,0xdd,0x1a,0x5a,0x6d,0x57,0xf9,0x4a,0x63,0xbf,0x59,0xe6,0xda,0x15,0x4c,0xc0,
+  0x9d,0xf2,0xb2,0xcd,0xff,0xde,0x80,0x3f,0x3c,0x80,0x81,0x06,0x9d,0x4f,0xd9,0xa5,0x14,0xc6,0x85,0xbb,
+  0x43,0xfb,0x16,0x30,0x25,0x42,0xee,0x3d,0x85,0x51,0xf4,0x21,0x7d,0x01,0x80,0x6a,0xbe,0x65,0x59,0x6a,
+  0x61,0x97,0xfc,0x48,0xfd,0xe4,0xf9,0xd8,0xa8,0xfb,0x2e,0xe5,0x37,0xdd,0xc6,0x36,0xa8,0x9d,0x4d,0x8c,
+  0x5b,0xa5,0xc0,0x8f,0x6f,0x38,0xbf,0x31,0x8c,0xe7,0xda,0x5a,0xf0,0x8f,0xd4,0x07,0x09,0x27,0x15,0x0e,
+  0xb6,0x49,0x9e,0xcf,0xb5,0xee,0x53,0xca,0x8f,0xb1,0x5a,0x90,0xbb,0x3c,0xf4,0xba,0x43,0xa2,0xd5,0x5d,
+  0x3a,0x11,0x0a,0x36,0x63,0xef,0xa4,0x84,0xcf,0xe5,0x17,0x7e,0xf4,0x52,0xed,0x94,0xc6,0xa4,0x03,0x6c,
+  0xfa,0x34,0xf6,0x21,0x83,0x2c,0xe6,0xc7,0xc5,0xc5,0xe5,0x73,0xe5,0xbd,0x3a,0xdc,0x6d,0xba,0x0e,0x3c,
+  0x11,0x45,0x62,0x94,0x31,0xf3,0x4f,0xce,0xaf,0x29,0x7b,0x75,0x83,0xb9,0x1a,0x06,0xb0,0x6d,0xca,0x3a,
+  0x6d,0x80,0x89,0xe8,0xbc,0x33,0x6e,0x99,0x7e,0xf6,0x5f,0x28,0x5e,0xc1,0x32,0x0a,0xfb,0xef,0x40,0x64,
+  0x12,0x47,0xba,0xcd,0xbd,0x6b,0x2b,0xf6,0xfb,0xfd,0xc3,0x23,0x13,0xf1,0xe6,0x55,0x78,0xe2,0xa7,0x93,
+  0x71,0x8d,0x8a,0x85,0xe4,0xbd,0x0a,0xfd,0xed,0x98,0x93,0x7c,0x65,0xcb,0xc3,0x66,0x19,0xd0,0x93,0x44,
+  0xe9,0x9c,0x67,0xc4,0x55,0x4d,0x20,0xb6,0x2d,0xbf,0x27,0xe2,0x58,0x26,0x33,0x4e,0x45,0x0d,0x93,0xce,
+  0xbb,0x75,0xf5,0x64,0x59,0x16,0x21,0x5c,0xfc,0xaf,0x40,0xb9,0x6a,0xdb,0x9f,0xb6,0x74,0x21,0x7e,0xd5,
+  0x81,0xde,0x13,0x55,0xca,0x1a,0xa3,0x9b,0xbf,0x98,0x48,0xb9,0xac,0x8f,0xa5,0x94,0x32,0xdc,0xa6,0x51,
+  0xe4,0x3c,0xde,0xbe,0x1f,0x2e,0xaf,0x6e,0xc6,0x48,0xd2,0x9d,0xb6,0xad,0xa3,0x56,0x03,0xfe,0x4c,0x66,
+  0x4f,0x5a,0xa6,0xaf,0x35,0x21,0x3d,0xd4,0xd7,0xaf,0xa9,0x92,0x73,0x51,0x8e,0x44,0x63,0x8e,0xe1,0x10,
+  0xb4,0xed,0x5c,0x9e,0xe7,0xec,0xa5,0xdd,0x97,0x06,0xa9,0x41,0x17,0x67,0x00,0x3b,0x2b,0x12,0xf4,0xb3,
+  0x24,0x31,0x87,0x94,0xf3,0x6a,0xfe,0xc2,0x66,0x28,0xf1,0x89,0x2a,0x25,0xe0,0x2f,0x0f,0xf7,0xbf,0xe5,
+  0x43,0x9c,0x1f,0xb4,0xe3,0x3c,0xef,0xc2,0xa3,0x43,0x65,0xee,0x0e,0x08,0x61,0x71,0x05,0x1f,0x3f,0x7c,
+  0x18,0xd5,0x96,0x71,0xc9,0x69,0x31,0xaa,0x81,0xb4,0x48,0xb7,0x4f,0x6d,0xc6,0x9f,0x8a,0xf7,0x85,0x60,
+  0xef,0xe7,0xeb,0x82,0xf1,0xff,0x26,0x36,0x76,0x7a,0x8a,0x85,0x7b,0x64,0x6f,0xee,0xca,0x94,0x98,0xd8,
+  0x49,0xff,0xc2,0xfa,0xe4,0x6f,0x9f,0x6c,0xb1,0x12,0xec,0x86,0xfa,0xfc,0x6c,0xbd,0x89,0x41,0xc8,0x40,
+  0x83,0x43,0x63,0x1a,0x7d,0xe3,0x23,0xcb,0xe3,0xa4,0xd8,0xe5,0x06,0xec,0x0a,0xfb,0xec,0x9a,0x57,0x57,
+  0x2f,0x25,0x36,0x06,0x94,0x9d,0x6a,0x7c,0xdb,0xac,0xd1,0xb9,0x83,0x25,0xe5,0x5c,0x5d,0xc7,0x33,0x17,
+  0x92,0xba,0xa4,0x62,0x27,0xfc,0xf8,0x34,0x44,0x98,0xcd,0x78,0xf5,0x2d,0x41,0xc8,0x7e,0x96,0x2e,0x1e,
+  0xf6,0xcf,0xe2,0x21,0x9f,0x2e,0x51,0xeb,0x2c,0x9c,0x9f,0xf6,0x6b,0xd5,0xeb,0xba,0xbe,0xa4,0x3b,0x4d,
+  0xb8,0x2c,0xdb,0x8b,0x90,0x65,0xf1,0x89,0xf3,0x93,0x98,0x97,0x25,0x25,0xf1,0x51,0x4e,0x21,0x5e,0xee,
+  0xae,0x87,0x4e,0xb2,0x62,0x33,0x8e,0x50,0x4d,0x83,0x3b,0xe4,0x34,0xfd,0x19,0x3f,0x71,0x9a,0x74,0xd3,
+  0x8c,0xa2,0xd1,0x45,0xef,0x20,0x8e,0xe3,0xf8,0xe7,0xf0,0x0f,0xe4,0x05,0x85,0x84,0x2c,0x06,0x00,0x00,
+};
@@ -0,0 +1,63 @@
+// HomeDing.h replacement for the actionbus test.
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+#include <vector>
+
+#define LOGGER_EERR(...) (printf("  ERR: " __VA_ARGS__), printf("\n"))
+#define LOGGER_ETRACE(...)
+
+inline long random(long howbig) {
+  return (rand() % howbig);
+}
+
+class Board {
+public:
+  unsigned long nowMillis;
+};
+
+class Element {
+public:
+  virtual ~Element() {}
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void start() {
+    active = true;
+  }
+  virtual void term() {
+    active = false;
+  }
+  virtual void loop() {}
+  virtual void pushState(std::function<void(const char *pName, const char *eValue)> /* callback */) {}
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+  static unsigned long _scanDuration(const char *value) {
+    return (strtoul(value, nullptr, 10));  // msecs only
+  }
+  static char *_printInteger(unsigned long v) {
+    static char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%lu", v);
+    return (buffer);
+  }
+
+  Board *_board = nullptr;
+  bool active = false;
+};
+
+/// @brief actions pushed into the action queue of the receiving board.
+inline std::vector<std::string> pushedActions;
+
+namespace HomeDing::Actions {
+inline void push(const String &action, const char * /* value */ = nullptr, bool /* split */ = true) {
+  pushedActions.push_back(action);
+}
+}  // namespace HomeDing::Actions
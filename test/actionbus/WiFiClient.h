@@ -0,0 +1,34 @@
+// WiFi replacement for the actionbus test.
+// Every simulated board has its own loopback address 127.0.0.<n>, the host name "board<n>"
+// resolves to this address.
+
+#pragma once
+
+#include <Arduino.h>
+
+class WiFiClient {
+public:
+  uint8_t connected() {
+    return (0);
+  }
+  void stop() {}
+};
+
+class WiFiClass {
+public:
+  int hostByName(const char *host, IPAddress &ip) {
+    int n;
+    if (sscanf(host, "board%d", &n) != 1) return (0);
+    ip = IPAddress(127, 0, 0, n);
+    return (1);
+  }
+
+  IPAddress localIP() {
+    return (currentIP);
+  }
+
+  /// @brief address of the board that is currently running.
+  IPAddress currentIP;
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,94 @@
+// WiFiUDP replacement for the actionbus test using host sockets bound to the board address.
+// Sent packets are dropped with the probability udpLoss to simulate a lossy network.
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// @brief probability of a lost packet in percent.
+inline int udpLoss = 0;
+
+/// @brief number of packets sent and dropped.
+inline unsigned long udpPackets = 0;
+inline unsigned long udpDropped = 0;
+
+class WiFiUDP {
+public:
+  uint8_t begin(uint16_t port) {
+    _fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = (uint32_t)WiFi.localIP();
+    return (bind(_fd, (sockaddr *)&addr, sizeof(addr)) == 0);
+  }
+
+  uint8_t beginMulticast(IPAddress /* group */, uint16_t port) {
+    return (begin(port));
+  }
+
+  void stop() {
+    if (_fd >= 0) close(_fd);
+    _fd = -1;
+  }
+
+  int beginPacket(IPAddress ip, uint16_t port) {
+    _to = {};
+    _to.sin_family = AF_INET;
+    _to.sin_port = htons(port);
+    _to.sin_addr.s_addr = (uint32_t)ip;
+    _len = 0;
+    return (1);
+  }
+
+  size_t write(const uint8_t *data, size_t len) {
+    memcpy(_out + _len, data, len);
+    _len += len;
+    return (len);
+  }
+
+  int endPacket() {
+    udpPackets++;
+    if (rand() % 100 < udpLoss) {
+      udpDropped++;
+      return (1);
+    }
+    return (sendto(_fd, _out, _len, 0, (sockaddr *)&_to, sizeof(_to)) == (ssize_t)_len);
+  }
+
+  int parsePacket() {
+    socklen_t len = sizeof(_from);
+    ssize_t r = recvfrom(_fd, _in, sizeof(_in), 0, (sockaddr *)&_from, &len);
+    _inLen = (r > 0) ? r : 0;
+    return (_inLen);
+  }
+
+  int read(uint8_t *buffer, size_t len) {
+    if (len > _inLen) len = _inLen;
+    memcpy(buffer, _in, len);
+    return (len);
+  }
+
+  IPAddress remoteIP() {
+    return (IPAddress((uint32_t)_from.sin_addr.s_addr));
+  }
+
+  uint16_t remotePort() {
+    return (ntohs(_from.sin_port));
+  }
+
+private:
+  int _fd = -1;
+  sockaddr_in _to = {};
+  sockaddr_in _from = {};
+  uint8_t _out[512];
+  size_t _len = 0;
+  uint8_t _in[512];
+  size_t _inLen = 0;
+};
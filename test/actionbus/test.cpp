@@ -0,0 +1,115 @@
+// Latency benchmark and reliability test of the ActionBusElement between two simulated boards.
+// The boards use the loopback addresses 127.0.0.1 and 127.0.0.2 and exchange real UDP packets.
+// Packet loss is simulated by dropping sent packets, the actions must arrive exactly once.
+
+#include <HomeDing.h>
+#include <ActionBusElement.h>
+#include <TestCheck.h>
+
+#include <chrono>
+
+struct SimBoard {
+  IPAddress ip;
+  Board board;
+  ActionBusElement bus;
+};
+
+SimBoard boards[2];
+
+static unsigned long long nowMicros() {
+  return (std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// run one loop on both boards using the real time.
+static void step() {
+  mockMillis = nowMicros() / 1000;
+  for (SimBoard &b : boards) {
+    WiFi.currentIP = b.ip;
+    b.board.nowMillis = millis();
+    b.bus.loop();
+  }
+}
+
+
+// send count actions from board 1 to board 2 and report the latency.
+static void benchmark(int loss, int count) {
+  std::vector<unsigned long> latency;
+  size_t first = pushedActions.size();
+  unsigned long packets = udpPackets;
+
+  udpLoss = loss;
+
+  for (int n = 0; n < count; n++) {
+    char action[40];
+    snprintf(action, sizeof(action), "value/v?value=%d", n);
+
+    size_t expected = pushedActions.size() + 1;
+    unsigned long long start = nowMicros();
+    WiFi.currentIP = boards[0].ip;
+    boards[0].bus.send("board2", action);
+
+    while ((pushedActions.size() < expected) && (nowMicros() - start < 2000000)) {
+      step();
+    }
+    latency.push_back(nowMicros() - start);
+  }
+
+  // receive the remaining acknowledges and repetitions
+  unsigned long long start = nowMicros();
+  while (nowMicros() - start < 300000) step();
+  udpLoss = 0;
+
+  // every action arrives exactly once and in order
+  CHECK_EQUAL((size_t)count, pushedActions.size() - first);
+  for (int n = 0; (n < count) && (first + n < pushedActions.size()); n++) {
+    char action[40];
+    snprintf(action, sizeof(action), "value/v?value=%d", n);
+    CHECK_EQUAL(std::string(action), pushedActions[first + n]);
+  }
+
+  std::sort(latency.begin(), latency.end());
+  unsigned long long sum = 0;
+  for (unsigned long l : latency) sum += l;
+
+  printf("  loss %2d%%: avg %5llu us, median %5lu us, p99 %6lu us, %4.2f packets per action\n",
+         loss, sum / count, latency[count / 2], latency[count * 99 / 100],
+         (double)(udpPackets - packets) / count);
+}
+
+
+int main() {
+  srand(1);
+
+  for (int n = 0; n < 2; n++) {
+    SimBoard &b = boards[n];
+    b.ip = IPAddress(127, 0, 0, n + 1);
+    WiFi.currentIP = b.ip;
+    b.bus._board = &b.board;
+    b.bus.set("timeout", "10");
+    b.bus.set("retries", "8");
+    b.bus.start();
+    CHECK(b.bus.active);
+  }
+
+  // actions that are too long or to unknown hosts are not sent
+  CHECK(!boards[0].bus.send("board2", String(std::string(200, 'x').c_str())));
+  CHECK(!boards[0].bus.send("nohost", "value/v?value=1"));
+
+  printf("action latency between two boards:\n");
+  benchmark(0, 1000);
+  benchmark(10, 200);
+  benchmark(20, 200);
+
+  // statistics of the receiving board
+  std::string stats;
+  boards[1].bus.pushState([&](const char *name, const char *value) {
+    stats += std::string(name) + "=" + value + " ";
+  });
+  printf("  receiver: %s\n", stats.c_str());
+
+  return (testResult("actionbus"));
+}
+
+// End.
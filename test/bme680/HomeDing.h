@@ -0,0 +1,49 @@
+// HomeDing.h replacement for the bme680 test.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define LOGGER_EERR(...)
+#define LOGGER_ETRACE(...)
+
+class Element {
+public:
+  virtual ~Element() {}
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void start() {
+    active = true;
+  }
+  virtual void term() {
+    active = false;
+  }
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+
+  bool active = false;
+};
+
+namespace HomeDing::Actions {
+inline const char *Address = "address";
+inline const char *OnTemperature = "onTemperature";
+inline const char *OnHumidity = "onHumidity";
+inline const char *OnPressure = "onPressure";
+
+class ActionString {
+public:
+  ActionString &operator=(const char *action) {
+    _text = action;
+    return (*this);
+  }
+
+private:
+  String _text;
+};
+}  // namespace HomeDing::Actions
@@ -0,0 +1,33 @@
+// WireUtils.h replacement for the bme680 test.
+// The registers of the simulated chip are in mockRegisters.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define WU_S16(data, offset) (int16_t)(data[offset + 1] << 8 | data[offset])
+#define WU_U16(data, offset) (uint16_t)(data[offset + 1] << 8 | data[offset])
+
+/// @brief the registers of the simulated chip.
+inline uint8_t mockRegisters[256];
+
+class WireUtils {
+public:
+  static bool exists(uint8_t /* address */) {
+    return (true);
+  }
+
+  static uint8_t readRegister(uint8_t /* address */, uint8_t reg) {
+    return (mockRegisters[reg]);
+  }
+
+  static uint8_t readBuffer(uint8_t /* address */, uint8_t reg, uint8_t *data, uint8_t len) {
+    memcpy(data, mockRegisters + reg, len);
+    return (len);
+  }
+
+  static uint8_t write(uint8_t /* address */, uint8_t reg, uint8_t data) {
+    mockRegisters[reg] = data;
+    return (0);
+  }
+};
@@ -0,0 +1,26 @@
+// SensorElement.h replacement for the bme680 test.
+// getProbe() is called by the test and the wait time is recorded.
+
+#pragma once
+
+class SensorElement : public Element {
+public:
+  virtual bool set(const char * /* name */, const char * /* value */) override {
+    return (false);
+  }
+
+protected:
+  int _valuesCount = 0;
+  String _stateKeys;
+  HomeDing::Actions::ActionString _actions[5];
+
+  void setWait(unsigned long waitMilliseconds) {
+    _waitDuration = waitMilliseconds;
+  }
+
+  virtual bool getProbe(String & /* values */) {
+    return (true);
+  }
+
+  unsigned long _waitDuration = 0;
+};
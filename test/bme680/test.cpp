@@ -0,0 +1,321 @@
+// Test of the BME680Element compensation against the Bosch Sensortec reference driver.
+// * the calibration registers are decoded like get_calib_data() of the driver.
+// * temperature, pressure, humidity and gas resistance of random calibration data and raw values
+//   are equal to calc_temperature(), calc_pressure(), calc_humidity() and calc_gas_resistance().
+// * the heater setting is equal to calc_heater_res() and is written when a measurement starts.
+// * no gas resistance is reported when the heater was not stable.
+
+#include <Arduino.h>
+
+#define private public
+#define protected public
+#include <HomeDing.h>
+#include <sensors/BME680Element.h>
+#undef protected
+#undef private
+
+#include <WireUtils.h>
+
+#include <TestCheck.h>
+
+#include "reference.h"
+
+#include <string>
+#include <vector>
+
+// ===== helpers =====
+
+// registers of the chip as used by the Bosch driver.
+#define REG_CALIB1 0x89
+#define REG_CALIB2 0xE1
+#define REG_DATA 0x1D
+
+static int randRange(int lo, int hi) {
+  return (lo + rand() % (hi - lo + 1));
+}
+
+static void put16(uint8_t *c, int lsb, int msb, int value) {
+  c[lsb] = (uint8_t)(value & 0xFF);
+  c[msb] = (uint8_t)((value >> 8) & 0xFF);
+}
+
+// create random calibration data in the range of real chips and store it in the registers.
+static void randomCalibration(uint8_t *c) {
+  memset(c, 0, 41);
+  put16(c, BME680_T1_LSB_REG, BME680_T1_MSB_REG, randRange(25000, 27000));
+  put16(c, BME680_T2_LSB_REG, BME680_T2_MSB_REG, randRange(25500, 27000));
+  c[BME680_T3_REG] = (uint8_t)randRange(0, 6);
+
+  put16(c, BME680_P1_LSB_REG, BME680_P1_MSB_REG, randRange(35000, 38000));
+  put16(c, BME680_P2_LSB_REG, BME680_P2_MSB_REG, randRange(-10700, -10100));
+  c[BME680_P3_REG] = (uint8_t)randRange(80, 100);
+  put16(c, BME680_P4_LSB_REG, BME680_P4_MSB_REG, randRange(6500, 8000));
+  put16(c, BME680_P5_LSB_REG, BME680_P5_MSB_REG, randRange(-200, 0));
+  c[BME680_P6_REG] = (uint8_t)randRange(25, 35);
+  c[BME680_P7_REG] = (uint8_t)randRange(30, 50);
+  put16(c, BME680_P8_LSB_REG, BME680_P8_MSB_REG, randRange(-4000, -2500));
+  put16(c, BME680_P9_LSB_REG, BME680_P9_MSB_REG, randRange(-2500, -1500));
+  c[BME680_P10_REG] = (uint8_t)randRange(25, 34);
+
+  int h1 = randRange(650, 900);
+  int h2 = randRange(950, 1100);
+  c[BME680_H2_MSB_REG] = (uint8_t)(h2 >> 4);
+  c[BME680_H1_LSB_REG] = (uint8_t)(((h2 & 0x0F) << 4) | (h1 & 0x0F));
+  c[BME680_H1_MSB_REG] = (uint8_t)(h1 >> 4);
+  c[BME680_H3_REG] = (uint8_t)randRange(0, 2);
+  c[BME680_H4_REG] = (uint8_t)randRange(40, 50);
+  c[BME680_H5_REG] = (uint8_t)randRange(15, 25);
+  c[BME680_H6_REG] = (uint8_t)randRange(110, 130);
+  c[BME680_H7_REG] = (uint8_t)randRange(-110, -90);
+
+  c[BME680_GH1_REG] = (uint8_t)randRange(-40, -1);
+  put16(c, BME680_GH2_LSB_REG, BME680_GH2_MSB_REG, randRange(-13000, -8000));
+  c[BME680_GH3_REG] = (uint8_t)randRange(10, 25);
+
+  for (int n = 0; n < 41; n++) {
+    mockRegisters[n < 25 ? REG_CALIB1 + n : REG_CALIB2 + n - 25] = c[n];
+  }
+
+  // the other bits of these registers are not part of the calibration.
+  mockRegisters[0x02] = (uint8_t)rand();
+  mockRegisters[0x00] = (uint8_t)randRange(20, 60);
+  mockRegisters[0x04] = (uint8_t)rand();
+}
+
+// decode the calibration using the reference driver.
+static void referenceCalibration(const uint8_t *c, bme680_dev &dev) {
+  memset(&dev, 0, sizeof(dev));
+  get_calib_data(c, mockRegisters[0x02], mockRegisters[0x00], mockRegisters[0x04], &dev);
+}
+
+// store the raw values in the data registers.
+static void setData(uint32_t adcT, uint32_t adcP, uint16_t adcH, uint16_t adcG, uint8_t range, bool gasValid) {
+  uint8_t *d = mockRegisters + REG_DATA;
+  memset(d, 0, 15);
+  d[0] = 0x80;
+  d[2] = (uint8_t)(adcP >> 12);
+  d[3] = (uint8_t)(adcP >> 4);
+  d[4] = (uint8_t)(adcP << 4);
+  d[5] = (uint8_t)(adcT >> 12);
+  d[6] = (uint8_t)(adcT >> 4);
+  d[7] = (uint8_t)(adcT << 4);
+  d[8] = (uint8_t)(adcH >> 8);
+  d[9] = (uint8_t)adcH;
+  d[13] = (uint8_t)(adcG >> 2);
+  d[14] = (uint8_t)((adcG << 6) | range | (gasValid ? 0x30 : 0x00));
+}
+
+// split the values of the sensor.
+static std::vector<std::string> split(const String &values) {
+  std::vector<std::string> parts;
+  std::string s = values.c_str();
+  size_t p = 0;
+  for (;;) {
+    size_t e = s.find(',', p);
+    parts.push_back(s.substr(p, e == std::string::npos ? std::string::npos : e - p));
+    if (e == std::string::npos) break;
+    p = e + 1;
+  }
+  return (parts);
+}
+
+// convert a fixed point value like "-1.05" to the integer -105.
+static long fixed(const std::string &value) {
+  std::string digits;
+  for (char ch : value) {
+    if (ch != '.') digits += ch;
+  }
+  return (strtol(digits.c_str(), nullptr, 10));
+}
+
+
+// ===== tests =====
+
+static void testCalibration() {
+  uint8_t c[41];
+  bme680_dev dev;
+
+  srand(1);
+  for (int round = 0; round < 100; round++) {
+    randomCalibration(c);
+    referenceCalibration(c, dev);
+
+    BME680Element e;
+    e._readCalibration();
+    CHECK_EQUAL(dev.calib.par_t1, e.par_t1);
+    CHECK_EQUAL(dev.calib.par_t2, e.par_t2);
+    CHECK_EQUAL(dev.calib.par_t3, e.par_t3);
+    CHECK_EQUAL(dev.calib.par_p1, e.par_p1);
+    CHECK_EQUAL(dev.calib.par_p2, e.par_p2);
+    CHECK_EQUAL(dev.calib.par_p3, e.par_p3);
+    CHECK_EQUAL(dev.calib.par_p4, e.par_p4);
+    CHECK_EQUAL(dev.calib.par_p5, e.par_p5);
+    CHECK_EQUAL(dev.calib.par_p6, e.par_p6);
+    CHECK_EQUAL(dev.calib.par_p7, e.par_p7);
+    CHECK_EQUAL(dev.calib.par_p8, e.par_p8);
+    CHECK_EQUAL(dev.calib.par_p9, e.par_p9);
+    CHECK_EQUAL(dev.calib.par_p10, e.par_p10);
+    CHECK_EQUAL(dev.calib.par_h1, e.par_h1);
+    CHECK_EQUAL(dev.calib.par_h2, e.par_h2);
+    CHECK_EQUAL(dev.calib.par_h3, e.par_h3);
+    CHECK_EQUAL(dev.calib.par_h4, e.par_h4);
+    CHECK_EQUAL(dev.calib.par_h5, e.par_h5);
+    CHECK_EQUAL(dev.calib.par_h6, e.par_h6);
+    CHECK_EQUAL(dev.calib.par_h7, e.par_h7);
+    CHECK_EQUAL(dev.calib.par_gh1, e.par_gh1);
+    CHECK_EQUAL(dev.calib.par_gh2, e.par_gh2);
+    CHECK_EQUAL(dev.calib.par_gh3, e.par_gh3);
+    CHECK_EQUAL(dev.calib.res_heat_range, e.res_heat_range);
+    CHECK_EQUAL(dev.calib.res_heat_val, e.res_heat_val);
+    CHECK_EQUAL(dev.calib.range_sw_err, e.range_sw_err);
+  }
+}
+
+
+static void testCompensation() {
+  uint8_t c[41];
+  bme680_dev dev;
+  int mismatches = 0;
+  int pressures = 0;
+
+  srand(2);
+  for (int round = 0; round < 200; round++) {
+    randomCalibration(c);
+    referenceCalibration(c, dev);
+
+    BME680Element e;
+    e._readCalibration();
+
+    for (int t = 0; t < 50; t++) {
+      // temperatures from -40 to 85 degree, humidity from 0 to 100 %.
+      uint32_t adcT = (uint32_t)(((2 * dev.calib.par_t1) + randRange(-15000, 33000)) * 8 + randRange(0, 7));
+      uint32_t adcP = (uint32_t)randRange(250000, 650000);
+      uint16_t adcH = (uint16_t)((dev.calib.par_h1 * 16) + randRange(-2000, 32000));
+      uint16_t adcG = (uint16_t)randRange(0, 1023);
+      uint8_t range = (uint8_t)randRange(0, 15);
+
+      setData(adcT, adcP, adcH, adcG, range, true);
+      int16_t refTemp = calc_temperature(adcT, &dev);
+      uint32_t refPress = calc_pressure(adcP, &dev);
+      uint32_t refHum = calc_humidity(adcH, &dev);
+      uint32_t refGas = calc_gas_resistance(adcG, range, &dev);
+
+      String values;
+      e._phase = 1;
+      CHECK(e.getProbe(values));
+      std::vector<std::string> v = split(values);
+      CHECK_EQUAL(5u, v.size());
+      if (v.size() != 5) continue;
+
+      bool ok = (fixed(v[0]) == refTemp) && (fixed(v[1]) == (long)refHum) && (strtoul(v[3].c_str(), nullptr, 10) == refGas);
+      CHECK_EQUAL((long)refTemp, fixed(v[0]));
+      CHECK_EQUAL((long)refHum, fixed(v[1]));
+      CHECK_EQUAL((unsigned long)refGas, strtoul(v[3].c_str(), nullptr, 10));
+
+      // the pressure is compared in the range the sensor supports.
+      if ((refPress >= 30000) && (refPress <= 100000)) {
+        pressures++;
+        ok = ok && (fixed(v[2]) == (long)refPress);
+        CHECK_EQUAL((long)refPress, fixed(v[2]));
+      }
+
+      int iaq = atoi(v[4].c_str());
+      CHECK((iaq >= 0) && (iaq <= 500));
+
+      if (!ok && (mismatches++ < 5)) {
+        printf("  round %d: %s expected %d,%u,%u,%u\n", round, values.c_str(), refTemp, refHum, refPress, refGas);
+      }
+    }
+  }
+  CHECK(pressures > 1000);
+}
+
+
+static void testHeater() {
+  uint8_t c[41];
+  bme680_dev dev;
+
+  srand(3);
+  for (int round = 0; round < 100; round++) {
+    randomCalibration(c);
+    referenceCalibration(c, dev);
+
+    BME680Element e;
+    e._readCalibration();
+    for (int amb = -20; amb <= 50; amb += 7) {
+      e._ambTemp = dev.amb_temp = (int8_t)amb;
+      for (uint16_t temp = 200; temp <= 400; temp += 20) {
+        CHECK_EQUAL(calc_heater_res(temp, &dev), e._heaterResistance(temp));
+      }
+    }
+  }
+
+  // starting a measurement writes the heater setting for 320 degree and the forced mode.
+  BME680Element e;
+  e._readCalibration();
+  referenceCalibration(c, dev);
+  dev.amb_temp = e._ambTemp;
+
+  String values;
+  e._phase = 0;
+  CHECK(!e.getProbe(values));
+  CHECK_EQUAL(calc_heater_res(320, &dev), mockRegisters[0x5A]);
+  CHECK_EQUAL(0x65, mockRegisters[0x64]);
+  CHECK_EQUAL(0x10, mockRegisters[0x71]);
+  CHECK_EQUAL(0x8D, mockRegisters[0x74]);
+  CHECK_EQUAL(183u, e._waitDuration);
+  CHECK_EQUAL(1, e._phase);
+
+  // the measured temperature is used for the next heater setting.
+  setData((uint32_t)(2 * dev.calib.par_t1 + 20000) * 8, 400000, 30000, 500, 5, true);
+  dev.amb_temp = (int8_t)((calc_temperature((2 * dev.calib.par_t1 + 20000) * 8, &dev) + 50) / 100);
+  CHECK(e.getProbe(values));
+  CHECK_EQUAL(dev.amb_temp, e._ambTemp);
+  CHECK(!e.getProbe(values));
+  CHECK_EQUAL(calc_heater_res(320, &dev), mockRegisters[0x5A]);
+}
+
+
+static void testNoData() {
+  uint8_t c[41];
+  bme680_dev dev;
+
+  srand(4);
+  randomCalibration(c);
+  referenceCalibration(c, dev);
+
+  BME680Element e;
+  e._readCalibration();
+
+  // data not ready: wait some more.
+  String values;
+  setData(2 * dev.calib.par_t1 * 8, 400000, 30000, 500, 5, true);
+  mockRegisters[REG_DATA] = 0x00;
+  e._phase = 1;
+  e._waitDuration = 0;
+  CHECK(!e.getProbe(values));
+  CHECK_EQUAL(10u, e._waitDuration);
+  CHECK_EQUAL(1, e._phase);
+
+  // heater not stable: no gas resistance and no iaq.
+  setData(2 * dev.calib.par_t1 * 8, 400000, 30000, 500, 5, false);
+  CHECK(e.getProbe(values));
+  std::vector<std::string> v = split(values);
+  CHECK_EQUAL(5u, v.size());
+  if (v.size() == 5) {
+    CHECK(v[3].empty());
+    CHECK(v[4].empty());
+  }
+  CHECK_EQUAL(0, e._phase);
+}
+
+
+int main() {
+  testCalibration();
+  testCompensation();
+  testHeater();
+  testNoData();
+  return (testResult("bme680"));
+}
+
+// End.
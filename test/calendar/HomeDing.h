@@ -0,0 +1,13 @@
+// HomeDing.h replacement for the calendar test using the real Board.h.
+
+#pragma once
+
+#include <Arduino.h>
+
+class WebServer;
+class FS;
+#define FILESYSTEM FS
+
+inline void optimistic_yield(uint32_t /* us */) {}
+
+#include <Board.h>
@@ -0,0 +1,5 @@
+// WiFiClient.h replacement for the calendar test.
+
+#pragma once
+
+class WiFiClient {};
@@ -0,0 +1,5 @@
+// Wire.h replacement for the calendar test.
+
+#pragma once
+
+class TwoWire {};
@@ -0,0 +1,219 @@
+// Test of the Board time functions and calendar.
+// * nextTimeOfDay() reaches the local time of day exactly, also over daylight saving time changes.
+// * the local midnight and the local quarter hours are always part of the wakeups.
+// * wakeAt() and wakeAfter() keep the wakeups sorted and one per element.
+
+#include <Arduino.h>
+
+#define private public
+#include <HomeDing.h>
+#undef private
+
+#include <TestCheck.h>
+
+#include <climits>
+
+// ===== helpers =====
+
+// set a POSIX time zone.
+static void setZone(const char *tz) {
+  setenv("TZ", tz, 1);
+  tzset();
+  Board::_localStamp = 0;
+}
+
+// return the time_t of a UTC time "yyyy-mm-dd hh:mm:ss".
+static time_t utc(const char *s) {
+  struct tm t = {};
+  sscanf(s, "%d-%d-%d %d:%d:%d", &t.tm_year, &t.tm_mon, &t.tm_mday, &t.tm_hour, &t.tm_min, &t.tm_sec);
+  t.tm_year -= 1900;
+  t.tm_mon -= 1;
+  return (timegm(&t));
+}
+
+// return the local time "yyyy-mm-dd hh:mm:ss zone".
+static std::string local(time_t t) {
+  struct tm lt;
+  char buffer[40];
+  localtime_r(&t, &lt);
+  strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S %Z", &lt);
+  return (buffer);
+}
+
+static time_t secondsOfDay(time_t t) {
+  struct tm lt;
+  localtime_r(&t, &lt);
+  return (lt.tm_hour * 60 * 60 + lt.tm_min * 60 + lt.tm_sec);
+}
+
+struct Wakeups {
+  int count = 0;
+  bool midnight = false;  // the local midnight was a wakeup.
+  bool aligned = true;    // all wakeups before reaching the time of day were on local quarter hours.
+};
+
+// follow the wakeups of an element waiting for a time of day like the AlarmElement.
+static time_t follow(time_t from, time_t tod, Wakeups &w) {
+  mockTime = from;
+
+  while (w.count < 200) {
+    time_t next = Board::nextTimeOfDay(tod);
+    CHECK(next > mockTime);
+    CHECK(next - mockTime <= 15 * 60);
+    mockTime = next;
+    w.count++;
+
+    time_t sod = secondsOfDay(next);
+    if (sod == tod) break;
+    if (sod == 0) w.midnight = true;
+    if (sod % (15 * 60)) w.aligned = false;
+  }
+  return (mockTime);
+}
+
+
+// ===== tests =====
+
+static void testTimeOfDay() {
+  Wakeups w;
+  time_t t;
+
+  setZone("CET-1CEST,M3.5.0,M10.5.0/3");
+
+  // same day
+  t = follow(utc("2026-06-10 08:00:00"), 12 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-06-10 12:00:00 CEST"), local(t));
+  CHECK_EQUAL(8, w.count);
+  CHECK(w.aligned);
+
+  // odd start and end time
+  w = Wakeups();
+  t = follow(utc("2026-06-10 08:07:13"), 9 * 60 * 60 + 59, w);
+  CHECK_EQUAL(std::string("2026-06-11 09:00:59 CEST"), local(t));
+  CHECK(w.aligned);
+  CHECK(w.midnight);
+
+  // midnight rollover
+  w = Wakeups();
+  t = follow(utc("2026-06-10 21:50:00"), 5 * 60, w);
+  CHECK_EQUAL(std::string("2026-06-11 00:05:00 CEST"), local(t));
+  CHECK_EQUAL(2, w.count);
+  CHECK(w.midnight);
+
+  // time of day already passed today
+  w = Wakeups();
+  t = follow(utc("2026-06-10 21:00:00"), 6 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-06-11 06:00:00 CEST"), local(t));
+  CHECK(w.midnight);
+
+  // alarm at midnight
+  w = Wakeups();
+  t = follow(utc("2026-06-10 21:50:00"), 0, w);
+  CHECK_EQUAL(std::string("2026-06-11 00:00:00 CEST"), local(t));
+}
+
+
+static void testDaylightSaving() {
+  Wakeups w;
+  time_t t;
+
+  setZone("CET-1CEST,M3.5.0,M10.5.0/3");
+
+  // spring forward 02:00 CET -> 03:00 CEST, 3 hours after local midnight
+  t = follow(utc("2026-03-28 23:00:00"), 4 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-03-29 04:00:00 CEST"), local(t));
+  CHECK_EQUAL(utc("2026-03-29 02:00:00"), t);
+  CHECK(w.aligned);
+
+  // fall back 03:00 CEST -> 02:00 CET, 5 hours after local midnight
+  w = Wakeups();
+  t = follow(utc("2026-10-24 22:00:00"), 4 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-10-25 04:00:00 CET"), local(t));
+  CHECK_EQUAL(utc("2026-10-25 03:00:00"), t);
+  CHECK(w.aligned);
+
+  // Chatham Islands +12:45 with daylight saving time change at 02:45 local time.
+  setZone("<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45");
+  w = Wakeups();
+  t = follow(utc("2026-09-26 12:00:00"), 5 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-09-27 05:00:00 +1345"), local(t));
+  CHECK_EQUAL(utc("2026-09-26 15:15:00"), t);
+  CHECK(w.aligned);
+}
+
+
+static void testQuarterZones() {
+  Wakeups w;
+  time_t t;
+
+  // Nepal +05:45, the local midnight is not on a UTC half hour.
+  setZone("<+0545>-5:45");
+
+  t = follow(utc("2026-06-10 18:05:00"), 5 * 60, w);
+  CHECK_EQUAL(std::string("2026-06-11 00:05:00 +0545"), local(t));
+  CHECK(w.midnight);
+
+  w = Wakeups();
+  t = follow(utc("2026-06-10 04:20:00"), 12 * 60 * 60, w);
+  CHECK_EQUAL(std::string("2026-06-10 12:00:00 +0545"), local(t));
+  CHECK(w.aligned);
+}
+
+
+static void testNoTime() {
+  setZone("UTC0");
+  mockTime = 1000;  // not synchronized
+  CHECK(Board::getLocalTime() == nullptr);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  CHECK_EQUAL((time_t)0, Board().getTime());
+#pragma GCC diagnostic pop
+  CHECK_EQUAL((time_t)1060, Board::nextTimeOfDay(12 * 60 * 60));
+}
+
+
+static void testCalendar() {
+  Board board;
+  Element *a = (Element *)0x100;
+  Element *b = (Element *)0x200;
+  Element *c = (Element *)0x300;
+
+  board.wakeAt(a, 100);
+  board.wakeAt(b, 50);
+  board.wakeAt(c, 100);
+  board.wakeAt(a, 0);  // replaces the first wakeup
+
+  CHECK_EQUAL(3u, board._calendar.size());
+  if (board._calendar.size() == 3) {
+    CHECK(board._calendar[0].elem == a);
+    CHECK(board._calendar[1].elem == b);
+    CHECK(board._calendar[2].elem == c);
+  }
+
+  // deadlines over the millis() overflow
+  mockMillis = ULONG_MAX - 10;
+  board.wakeAfter(a, 5);
+  board.wakeAfter(b, 20);
+  board.wakeAfter(c, 1);
+  board.wakeAfter(c, 2);  // replaces the first deadline
+
+  CHECK_EQUAL(3u, board._deadlines.size());
+  if (board._deadlines.size() == 3) {
+    CHECK(board._deadlines[0].elem == c);
+    CHECK(board._deadlines[1].elem == a);
+    CHECK(board._deadlines[2].elem == b);
+    CHECK_EQUAL(9ul, board._deadlines[2].at);
+  }
+}
+
+
+int main() {
+  testTimeOfDay();
+  testDaylightSaving();
+  testQuarterZones();
+  testNoTime();
+  testCalendar();
+  return (testResult("calendar"));
+}
+
+// End.
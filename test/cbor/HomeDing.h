@@ -0,0 +1,5 @@
+// HomeDing.h replacement for the cbor test.
+
+#pragma once
+
+#include <Arduino.h>
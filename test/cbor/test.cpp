@@ -0,0 +1,311 @@
+// Test and benchmark of the CBOR composer and parser.
+// * a config composed as CBOR is parsed into the same paths and values as the same config in JSON.
+// * numbers, floats, constants and tags in CBOR data, NUL bytes in the data are part of the values.
+// * bad data like truncated items, byte strings and deeply nested tags is rejected.
+// * benchmark of a config with 50 elements: size, compose and parse time of CBOR against JSON.
+
+#include <Arduino.h>
+
+#define protected public
+#include <MicroCborComposer.h>
+#include <MicroCborParser.h>
+#include <MicroJsonComposer.h>
+#include <MicroJsonParser.h>
+#undef protected
+
+#include <TestCheck.h>
+
+#include <chrono>
+#include <vector>
+
+// ===== helpers =====
+
+// a property of an element in a config.
+struct Property {
+  const char *key;
+  const char *text;  // nullptr for a number
+  long number;
+};
+
+// a realistic config with the given number of elements of the common types.
+static std::vector<std::pair<std::string, std::vector<Property>>> makeConfig(int count) {
+  std::vector<std::pair<std::string, std::vector<Property>>> config;
+
+  for (int n = 0; n < count; n++) {
+    std::string id;
+    std::vector<Property> props;
+
+    switch (n % 5) {
+      case 0:
+        id = "digitalout/led" + std::to_string(n);
+        props = { { "title", "Status LED", 0 }, { "pin", "D4", 0 }, { "invert", "true", 0 }, { "value", nullptr, 0 } };
+        break;
+      case 1:
+        id = "dht/th" + std::to_string(n);
+        props = { { "type", "DHT22", 0 }, { "pin", "D5", 0 }, { "readtime", "30s", 0 },
+                  { "ontemperature", "displaytext/temp?value=$v", 0 }, { "onhumidity", "displaytext/hum?value=$v", 0 } };
+        break;
+      case 2:
+        id = "timer/t" + std::to_string(n);
+        props = { { "mode", "loop", 0 }, { "waittime", nullptr, 2 }, { "pulsetime", nullptr, 1200 },
+                  { "cycletime", nullptr, 86400 }, { "onon", "digitalout/led?value=1", 0 }, { "onoff", "digitalout/led?value=0", 0 } };
+        break;
+      case 3:
+        id = "value/v" + std::to_string(n);
+        props = { { "min", nullptr, -40 }, { "max", nullptr, 125 }, { "step", nullptr, 1 }, { "value", nullptr, -7 } };
+        break;
+      default:
+        id = "displaytext/d" + std::to_string(n);
+        props = { { "x", nullptr, 0 }, { "y", nullptr, 300 }, { "fontsize", nullptr, 16 }, { "prefix", "Temperatur: ", 0 },
+                  { "postfix", "\xC2\xB0"
+                               "C",
+                    0 } };
+        break;
+    }
+    config.push_back({ id, props });
+  }
+  return (config);
+}
+
+// compose a config as CBOR or JSON with the same functions as the state of a board.
+template<class Composer>
+static void compose(Composer &c, const std::vector<std::pair<std::string, std::vector<Property>>> &config) {
+  c.openObject();
+  for (auto &e : config) {
+    c.addObject(e.first.c_str());
+    for (auto &p : e.second) {
+      if (p.text) {
+        c.addProperty(p.key, p.text);
+      } else {
+        c.addProperty(p.key, p.number);
+      }
+    }
+    c.closeObject();
+  }
+  c.closeObject();
+}
+
+// parse CBOR data and return all paths with values.
+static std::string parseCbor(const uint8_t *data, size_t len, bool *ok = nullptr) {
+  std::string s;
+  MicroCbor mc([&s](int /* level */, char *path, char *value) {
+    s += std::string(path) + "=" + value + ";";
+  });
+  bool ret = mc.parse(data, len);
+  if (ok) *ok = ret;
+  return (s);
+}
+
+static std::string parseCbor(const std::vector<uint8_t> &data, bool *ok = nullptr) {
+  return (parseCbor(data.data(), data.size(), ok));
+}
+
+// parse JSON and return all paths with values.
+static std::string parseJson(const char *json) {
+  std::string s;
+  MicroJson mj([&s](int /* level */, char *path, char *value) {
+    if (value) s += std::string(path) + "=" + value + ";";
+  });
+  mj.parse(json);
+  return (s);
+}
+
+static unsigned long long nowMicros() {
+  return (std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+
+// ===== tests =====
+
+static void testRoundTrip() {
+  auto config = makeConfig(50);
+
+  MicroCborComposer cc;
+  compose(cc, config);
+  MicroJsonComposer jc;
+  compose(jc, config);
+
+  bool ok = false;
+  const String &cbor = cc.data();
+  std::string values = parseCbor((const uint8_t *)cbor.c_str(), cbor.length(), &ok);
+  CHECK(ok);
+  CHECK(MicroCbor::isMap((const uint8_t *)cbor.c_str(), cbor.length()));
+  CHECK_EQUAL(parseJson(jc.stringify()), values);
+
+  CHECK(values.find("digitalout/led0/title=Status LED;") != std::string::npos);
+  CHECK(values.find("timer/t2/cycletime=86400;") != std::string::npos);
+  CHECK(values.find("value/v3/min=-40;") != std::string::npos);
+  CHECK(values.find("displaytext/d4/postfix=\xC2\xB0"
+                    "C;")
+        != std::string::npos);
+
+  // the value 0 is encoded as a NUL byte.
+  CHECK(cbor.find('\0') != std::string::npos);
+  CHECK(values.find("digitalout/led0/value=0;") != std::string::npos);
+}
+
+
+static void testNumbers() {
+  MicroCborComposer cc;
+  cc.openObject();
+  long numbers[] = { 0, 23, 24, 255, 256, 65535, 65536, 2147483647L, -1, -24, -25, -256, -257, -65537, -2147483647L - 1 };
+  for (long n : numbers) {
+    cc.addProperty(std::to_string(n).c_str(), n);
+  }
+  cc.closeObject();
+
+  std::string expected;
+  for (long n : numbers) {
+    expected += std::to_string(n) + "=" + std::to_string(n) + ";";
+  }
+  const String &cbor = cc.data();
+  CHECK_EQUAL(expected, parseCbor((const uint8_t *)cbor.c_str(), cbor.length()));
+
+  // the shortest encoding is used.
+  MicroCborComposer small;
+  small.addProperty("a", 24L);
+  CHECK_EQUAL(std::string("\x61"
+                          "a\x18\x18"),
+              std::string(small.data().c_str(), small.data().length()));
+}
+
+
+static void testFloatsAndConstants() {
+  // {"h":1.5, "f":100000.0, "d":1e300, "m":-1.7976931348623157e308, "n":NaN}
+  std::vector<uint8_t> data = {
+    0xA5,
+    0x61, 'h', 0xF9, 0x3E, 0x00,
+    0x61, 'f', 0xFA, 0x47, 0xC3, 0x50, 0x00,
+    0x61, 'd', 0xFB, 0x7E, 0x37, 0xE4, 0x3C, 0x88, 0x00, 0x75, 0x9C,
+    0x61, 'm', 0xFB, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x61, 'n', 0xF9, 0x7E, 0x00
+  };
+  CHECK_EQUAL(std::string("h=1.5;f=100000;d=1e+300;m=-1.79769e+308;n=nan;"), parseCbor(data));
+
+  // [true, false, null, 1(1363896240)] with an indefinite length, the tag is ignored.
+  data = { 0x9F, 0xF5, 0xF4, 0xF6, 0xC1, 0x1A, 0x51, 0x4B, 0x67, 0xB0, 0xFF };
+  CHECK_EQUAL(std::string("[0]=true;[1]=false;[2]=;[3]=1363896240;"), parseCbor(data));
+
+  // a long text is cut to the size of the value buffer.
+  std::vector<uint8_t> text = { 0xA1, 0x61, 't', 0x79, 0x01, 0x2C };
+  text.insert(text.end(), 300, 'x');
+  bool ok = false;
+  std::string values = parseCbor(text, &ok);
+  CHECK(ok);
+  CHECK_EQUAL(2 + 199 + 1u, values.size());
+}
+
+
+static void testBadData() {
+  bool ok = true;
+
+  // truncated data
+  std::vector<uint8_t> data = { 0xA1, 0x61, 'a', 0x19, 0x01 };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+  data = { 0xA1, 0x65, 'a' };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+  data = { 0xBF, 0x61, 'a', 0x01 };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+
+  // additional data after the item
+  data = { 0xA1, 0x61, 'a', 0x01, 0x00 };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+
+  // byte strings and keys that are no text strings are not supported.
+  data = { 0xA1, 0x61, 'a', 0x42, 0x01, 0x02 };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+  data = { 0xA1, 0x01, 0x02 };
+  parseCbor(data, &ok);
+  CHECK(!ok);
+
+  // nesting is limited, also for tags.
+  data.assign(20, 0x81);
+  data.push_back(0x01);
+  parseCbor(data, &ok);
+  CHECK(!ok);
+  data.assign(100000, 0xC1);
+  data.push_back(0x01);
+  parseCbor(data, &ok);
+  CHECK(!ok);
+  data = { 0xC1, 0xC1, 0x01 };
+  CHECK_EQUAL(std::string("=1;"), parseCbor(data, &ok));
+  CHECK(ok);
+
+  // empty data
+  CHECK(!MicroCbor::isMap(nullptr, 0));
+  parseCbor(nullptr, 0, &ok);
+  CHECK(!ok);
+}
+
+
+static void benchmark() {
+  const int count = 2000;
+  auto config = makeConfig(50);
+  volatile size_t sum = 0;
+
+  unsigned long long t0 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    MicroJsonComposer jc;
+    compose(jc, config);
+    sum += strlen(jc.stringify());
+  }
+  unsigned long long t1 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    MicroCborComposer cc;
+    compose(cc, config);
+    sum += cc.data().length();
+  }
+  unsigned long long t2 = nowMicros();
+
+  MicroJsonComposer jc;
+  compose(jc, config);
+  MicroCborComposer cc;
+  compose(cc, config);
+  const char *json = jc.stringify();
+  const String &cbor = cc.data();
+  size_t values = 0;
+
+  unsigned long long t3 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    MicroJson mj([&values](int, char *, char *value) {
+      if (value) values++;
+    });
+    mj.parse(json);
+  }
+  unsigned long long t4 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    MicroCbor mc([&values](int, char *, char *) {
+      values++;
+    });
+    mc.parse((const uint8_t *)cbor.c_str(), cbor.length());
+  }
+  unsigned long long t5 = nowMicros();
+  sum += values;
+
+  printf("config with 50 elements, %d times:\n", count);
+  printf("  JSON: %5u bytes, compose %5llu ns, parse %6llu ns\n", (unsigned)strlen(json),
+         (t1 - t0) * 1000 / count, (t4 - t3) * 1000 / count);
+  printf("  CBOR: %5u bytes, compose %5llu ns, parse %6llu ns\n", (unsigned)cbor.length(),
+         (t2 - t1) * 1000 / count, (t5 - t4) * 1000 / count);
+  CHECK(cbor.length() < strlen(json));
+  CHECK(t5 - t4 < t4 - t3);
+}
+
+
+int main() {
+  testRoundTrip();
+  testNumbers();
+  testFloatsAndConstants();
+  testBadData();
+  benchmark();
+  return (testResult("cbor"));
+}
+
+// End.
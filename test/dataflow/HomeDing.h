@@ -0,0 +1,93 @@
+// HomeDing.h replacement for the dataflow test.
+// The board dispatches actions to the elements in a list.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <core/Logger.h>
+#include <core/Actions.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#define LIST_SEPARATOR ','
+#define ELEM_PARAMETER '?'
+#define ELEM_VALUE '='
+
+struct _pchar_less {
+  bool operator()(const char *a, const char *b) const {
+    return strcmp(a, b) < 0;
+  }
+};
+
+inline char *strlwr(char *s) {
+  for (char *p = s; *p; p++) *p = tolower(*p);
+  return (s);
+}
+
+class Element {
+public:
+  enum CATEGORY : uint16_t {
+    All = 0xFFFF
+  };
+
+  virtual ~Element() {}
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void loop() {}
+  virtual bool getOutputs(std::function<void(const String &action)> /* callback */) {
+    return (false);
+  }
+
+  static String getItemValue(String data, int index) {
+    int start = 0;
+    for (int n = 0; (n < index) && (start >= 0); n++) {
+      start = data.indexOf(',', start);
+      if (start >= 0) start++;
+    }
+    if (start < 0) return (String());
+    int end = data.indexOf(',', start);
+    return (end < 0 ? data.substring(start) : data.substring(start, end));
+  }
+
+  const char *id = "";
+  bool active = true;
+};
+
+class Board {
+public:
+  void add(Element *e) {
+    elements.push_back(e);
+  }
+
+  void forEach(Element::CATEGORY /* cat */, std::function<void(Element *e)> callback) {
+    for (Element *e : elements) callback(e);
+  }
+
+  Element *findById(const char *id) {
+    for (Element *e : elements) {
+      if (strcasecmp(e->id, id) == 0) return (e);
+    }
+    return (nullptr);
+  }
+
+  bool dispatchAction(Element *target, const char *name, const char *value) {
+    return (target->set(name, value));
+  }
+
+  // dispatch a text action "type/id?name=value".
+  void dispatchAction(String action) {
+    int p = action.indexOf('?');
+    int v = action.indexOf('=');
+    String id = action.substring(0, p);
+    String name = (v > 0) ? action.substring(p + 1, v) : action.substring(p + 1);
+    String value = (v > 0) ? action.substring(v + 1) : String();
+    Element *e = findById(id.c_str());
+    if (e) e->set(name.c_str(), value.c_str());
+  }
+
+  std::vector<Element *> elements;
+};
@@ -0,0 +1,9 @@
+// core/Logger.h replacement for the dataflow test.
+
+#pragma once
+
+#define LOGGER_ERR(...)
+#define LOGGER_INFO(...)
+#define LOGGER_TRACE(...)
+#define LOGGER_EERR(...)
+#define LOGGER_ETRACE(...)
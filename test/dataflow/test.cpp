@@ -0,0 +1,269 @@
+// Test of the dataflow graph with the action queue.
+// * actions to nodes are dispatched in the order of the queue.
+// * a chain of nodes is evaluated in one pass, a node with 2 inputs is evaluated once.
+// * nodes in a cycle are not part of the graph and use the queue.
+// * a node that gets a new value from a later node is evaluated in another pass, up to 4 passes.
+
+#include <Arduino.h>
+
+#include <HomeDing.h>
+#include <core/Dataflow.h>
+
+#include <TestCheck.h>
+
+#include <string>
+#include <vector>
+
+using namespace HomeDing;
+
+// ===== helpers =====
+
+/// @brief the set values and evaluations in the order they happened.
+static std::vector<std::string> events;
+
+// add element calculating a + b and sending the result to onvalue.
+// Actions in onhidden are not reported as outputs.
+class AddNode : public Element {
+public:
+  AddNode(const char *elementId) {
+    id = elementId;
+  }
+
+  virtual bool set(const char *name, const char *value) override {
+    if (strcmp(name, "a") == 0) {
+      a = atoi(value);
+      _needUpdate = true;
+    } else if (strcmp(name, "b") == 0) {
+      b = atoi(value);
+      _needUpdate = true;
+    } else if (strcmp(name, "onvalue") == 0) {
+      onValue = value;
+    } else if (strcmp(name, "onhidden") == 0) {
+      onHidden = value;
+    } else {
+      return (false);
+    }
+    return (true);
+  }
+
+  virtual void loop() override {
+    if (_needUpdate) {
+      _needUpdate = false;
+      evaluations++;
+      events.push_back(std::string(id) + "=" + std::to_string(a + b));
+      Actions::push(onValue, a + b);
+      Actions::push(onHidden, a + b);
+    }
+  }
+
+  virtual bool getOutputs(std::function<void(const String &action)> callback) override {
+    if (onValue) callback(onValue);
+    return (true);
+  }
+
+  int a = 0;
+  int b = 0;
+  int evaluations = 0;
+  Actions::ActionString onValue;
+  Actions::ActionString onHidden;
+
+private:
+  bool _needUpdate = false;
+};
+
+// element that records the set values.
+class SinkElement : public Element {
+public:
+  SinkElement(const char *elementId) {
+    id = elementId;
+  }
+
+  virtual bool set(const char *name, const char *value) override {
+    events.push_back(std::string(id) + "?" + name + "=" + value);
+    return (true);
+  }
+};
+
+// dispatch all queued actions.
+static void dispatchAll(Board &board) {
+  for (int n = 0; (n < 1000) && (!Actions::queueIsEmpty()); n++) {
+    Actions::dispatchNext(&board);
+  }
+}
+
+static std::string joinEvents() {
+  std::string s;
+  for (auto &e : events) {
+    if (!s.empty()) s += ",";
+    s += e;
+  }
+  events.clear();
+  return (s);
+}
+
+
+// ===== tests =====
+
+static void testOrder() {
+  Board board;
+  AddNode a("add/a"), b("add/b");
+  SinkElement sink("sink/s");
+  board.add(&a);
+  board.add(&b);
+  board.add(&sink);
+  a.set("onvalue", "add/b?a=$v");
+  b.set("onvalue", "sink/s?value=$v");
+  b.set("b", "100");
+  Dataflow::build(&board);
+
+  CHECK(Dataflow::isActive());
+  CHECK_EQUAL(0, Dataflow::indexOf(&a));
+  CHECK_EQUAL(1, Dataflow::indexOf(&b));
+  CHECK_EQUAL(-1, Dataflow::indexOf(&sink));
+
+  Actions::ActionString toSink, toA;
+  toSink = "sink/s?value=$v";
+  toA = "add/a?a=$v";
+
+  // the action to the node is dispatched after the action that was queued before.
+  events.clear();
+  Actions::push(toSink, "first");
+  Actions::push(toA, "5");
+  Actions::push(toSink, "last");
+  CHECK_EQUAL(0, a.evaluations);
+  CHECK_EQUAL(std::string(""), joinEvents());
+
+  // the chain a -> b is evaluated when the action is dispatched,
+  // the output of b to the sink is queued after "last".
+  dispatchAll(board);
+  CHECK_EQUAL(std::string("sink/s?value=first,add/a=5,add/b=105,sink/s?value=last,sink/s?value=105"), joinEvents());
+  CHECK_EQUAL(1, a.evaluations);
+  CHECK_EQUAL(1, b.evaluations);
+
+  // text actions are set on the element and the node sends its output in its own loop.
+  Actions::push("add/a?a=7");
+  dispatchAll(board);
+  CHECK_EQUAL(1, a.evaluations);
+  a.loop();
+  b.loop();
+  CHECK_EQUAL(std::string("add/a=7"), joinEvents());
+  dispatchAll(board);
+  CHECK_EQUAL(std::string("add/b=107,sink/s?value=107"), joinEvents());
+}
+
+
+static void testDiamond() {
+  Board board;
+  AddNode d("add/d"), c("add/c"), b("add/b"), a("add/a");
+  // added in reverse order, the graph sorts them.
+  board.add(&d);
+  board.add(&c);
+  board.add(&b);
+  board.add(&a);
+  a.set("onvalue", "add/b?a=$v,add/c?a=$v");
+  b.set("onvalue", "add/d?a=$v");
+  c.set("onvalue", "add/d?b=$v");
+  c.set("b", "10");
+  Dataflow::build(&board);
+
+  CHECK_EQUAL(0, Dataflow::indexOf(&a));
+  CHECK_EQUAL(3, Dataflow::indexOf(&d));
+
+  Actions::ActionString toA;
+  toA = "add/a?a=$v";
+  events.clear();
+  Actions::push(toA, "1");
+  dispatchAll(board);
+
+  // d is evaluated once after both inputs have been updated.
+  CHECK_EQUAL(1, d.evaluations);
+  CHECK_EQUAL(12, d.a + d.b);
+  std::string e = joinEvents();
+  CHECK((e == "add/a=1,add/b=1,add/c=11,add/d=12") || (e == "add/a=1,add/c=11,add/b=1,add/d=12"));
+
+  Actions::push(toA, "2");
+  Actions::push(toA, "3");
+  dispatchAll(board);
+  CHECK_EQUAL(3, d.evaluations);
+  CHECK_EQUAL(16, d.a + d.b);
+}
+
+
+static void testCycle() {
+  Board board;
+  AddNode x("add/x"), y("add/y"), z("add/z");
+  board.add(&x);
+  board.add(&y);
+  board.add(&z);
+  x.set("onvalue", "add/y?a=$v");
+  y.set("onvalue", "add/x?a=$v");
+  z.set("onvalue", "add/x?b=$v");
+  Dataflow::build(&board);
+
+  // x and y are in a cycle, z is a node.
+  CHECK_EQUAL(-1, Dataflow::indexOf(&x));
+  CHECK_EQUAL(-1, Dataflow::indexOf(&y));
+  CHECK_EQUAL(0, Dataflow::indexOf(&z));
+
+  // the action to x is queued and dispatched, x is not evaluated by the graph.
+  Actions::ActionString toZ;
+  toZ = "add/z?a=$v";
+  events.clear();
+  Actions::push(toZ, "4");
+  dispatchAll(board);
+  CHECK_EQUAL(1, z.evaluations);
+  CHECK_EQUAL(0, x.evaluations);
+  CHECK_EQUAL(4, x.b);
+  CHECK_EQUAL(std::string("add/z=4"), joinEvents());
+}
+
+
+static void testPasses() {
+  Board board;
+  AddNode p("add/p"), q("add/q"), r("add/r");
+  board.add(&p);
+  board.add(&q);
+  board.add(&r);
+  // r sets p that was evaluated before without reporting it as an output.
+  p.set("onvalue", "add/q?a=$v");
+  q.set("onvalue", "add/r?a=$v");
+  r.set("onhidden", "add/p?b=$v");
+  r.set("b", "1");
+  Dataflow::build(&board);
+
+  CHECK_EQUAL(0, Dataflow::indexOf(&p));
+  CHECK_EQUAL(1, Dataflow::indexOf(&q));
+  CHECK_EQUAL(2, Dataflow::indexOf(&r));
+
+  // the values p -> q -> r -> p never get stable: the evaluation stops after 4 passes.
+  Actions::ActionString toP;
+  toP = "add/p?a=$v";
+  events.clear();
+  Actions::push(toP, "0");
+  dispatchAll(board);
+  CHECK_EQUAL(4, p.evaluations);
+  CHECK_EQUAL(4, q.evaluations);
+  CHECK_EQUAL(4, r.evaluations);
+  CHECK_EQUAL(std::string("add/p=0,add/q=0,add/r=1,add/p=1,add/q=1,add/r=2,add/p=2,add/q=2,add/r=3,add/p=3,add/q=3,add/r=4"),
+              joinEvents());
+  CHECK(Actions::queueIsEmpty());
+
+  // the remaining new value of p is evaluated with the next value.
+  Actions::ActionString toR;
+  toR = "add/r?b=$v";
+  Actions::push(toR, "0");
+  dispatchAll(board);
+  CHECK_EQUAL(std::string("add/p=4,add/q=4,add/r=4,add/p=4,add/q=4,add/r=4,add/p=4,add/q=4,add/r=4,add/p=4,add/q=4,add/r=4"),
+              joinEvents());
+}
+
+
+int main() {
+  testOrder();
+  testDiamond();
+  testCycle();
+  testPasses();
+  return (testResult("dataflow"));
+}
+
+// End.
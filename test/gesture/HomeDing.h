@@ -0,0 +1,5 @@
+// HomeDing.h replacement for the gesture test.
+
+#pragma once
+
+#include <Arduino.h>
@@ -0,0 +1,148 @@
+// Test of the gesture recognition in TouchGesture using the touch traces in traces.txt.
+// * every trace results in the expected gesture.
+// * a long press is reported while touched and not again at the release.
+// * the velocity and the scale of a pinch are calculated.
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <displays/TouchGesture.h>
+
+#include <TestCheck.h>
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+static const char *gestureNames[] = { "none", "swipeleft", "swiperight", "swipeup", "swipedown", "longpress", "pinch" };
+
+struct Trace {
+  std::string expected;
+  std::string description;
+  std::vector<TouchGesture::Sample> samples;
+};
+
+// ===== helpers =====
+
+// read the traces from the file.
+static std::vector<Trace> readTraces(const char *fileName) {
+  std::vector<Trace> traces;
+  std::ifstream file(fileName);
+  std::string line;
+  Trace t;
+
+  while (std::getline(file, line)) {
+    if ((line.empty()) || (line[0] == '#')) continue;
+
+    std::istringstream in(line);
+    if (line.rfind("trace ", 0) == 0) {
+      std::string word;
+      in >> word >> t.expected;
+      in >> std::ws;
+      std::getline(in, t.description);
+      t.samples.clear();
+
+    } else if (line == "end") {
+      traces.push_back(t);
+
+    } else {
+      unsigned long ms;
+      int x, y, spread;
+      in >> ms >> x >> y >> spread;
+      t.samples.push_back({ ms, (int16_t)x, (int16_t)y, (uint16_t)spread });
+    }
+  }
+  return (traces);
+}
+
+// play a trace and return the recognized gesture.
+static TouchGesture::GESTURE play(TouchGesture &g, Trace &t, int *longPress = nullptr) {
+  TouchGesture::GESTURE res = TouchGesture::None;
+  int lp = 0;
+
+  for (TouchGesture::Sample &s : t.samples) {
+    if (g.add(s.ms, s.x, s.y, s.spread) == TouchGesture::LongPress) {
+      res = TouchGesture::LongPress;
+      lp++;
+    }
+  }
+  TouchGesture::GESTURE e = g.end();
+  if (res == TouchGesture::None) res = e;
+  if (longPress) *longPress = lp;
+  return (res);
+}
+
+
+// ===== tests =====
+
+static void testTraces() {
+  std::vector<Trace> traces = readTraces("gesture/traces.txt");
+  TouchGesture g;
+
+  CHECK(traces.size() >= 15);
+  for (Trace &t : traces) {
+    int lp;
+    const char *name = gestureNames[play(g, t, &lp)];
+    if (t.expected != name) {
+      printf("  trace '%s': %s expected, %s recognized\n", t.description.c_str(), t.expected.c_str(), name);
+    }
+    CHECK_EQUAL(t.expected, std::string(name));
+    CHECK(lp <= 1);
+    CHECK(!g.isActive());
+  }
+}
+
+
+static void testLongPress() {
+  TouchGesture g;
+
+  // reported once with the sample reaching the long press time.
+  CHECK_EQUAL(TouchGesture::None, g.add(1000, 100, 100));
+  CHECK_EQUAL(TouchGesture::None, g.add(1790, 104, 98));
+  CHECK_EQUAL(TouchGesture::LongPress, g.add(1800, 103, 99));
+  CHECK_EQUAL(TouchGesture::None, g.add(1900, 103, 99));
+  CHECK_EQUAL(TouchGesture::None, g.end());
+
+  // moving out of the slop distance prevents the long press, also when moving back.
+  CHECK_EQUAL(TouchGesture::None, g.add(1000, 100, 100));
+  CHECK_EQUAL(TouchGesture::None, g.add(1400, 120, 100));
+  CHECK_EQUAL(TouchGesture::None, g.add(2000, 100, 100));
+  CHECK_EQUAL(TouchGesture::None, g.end());
+}
+
+
+static void testVelocity() {
+  TouchGesture g;
+
+  // 30 samples, the last 100 msec with 5 pixels per 20 msec.
+  for (int i = 0; i < 30; i++) {
+    g.add(1000 + i * 20, 100 + i * 5, 200 - i * 2);
+  }
+  CHECK_EQUAL(TouchGesture::SwipeRight, g.end());
+  CHECK_EQUAL(250, g.velocityX);
+  CHECK_EQUAL(-100, g.velocityY);
+
+  // pinch scale
+  g.add(1000, 100, 100, 100);
+  g.add(1020, 100, 100, 150);
+  g.add(1040, 100, 100, 250);
+  CHECK_EQUAL(TouchGesture::Pinch, g.end());
+  CHECK_EQUAL(250, g.scale);
+
+  // the second finger touches later
+  g.add(1000, 100, 100, 0);
+  g.add(1020, 100, 100, 200);
+  g.add(1040, 100, 100, 100);
+  CHECK_EQUAL(TouchGesture::Pinch, g.end());
+  CHECK_EQUAL(50, g.scale);
+}
+
+
+int main() {
+  testTraces();
+  testLongPress();
+  testVelocity();
+  return (testResult("gesture"));
+}
+
+// End.
@@ -0,0 +1,42 @@
+// HomeDing.h replacement for the httppool test.
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <ArrayString.h>
+
+#define LOGGER_EERR(...) (printf("  ERR: " __VA_ARGS__), printf("\n"))
+#define LOGGER_ETRACE(...)
+
+inline void hd_yield() {}
+
+class Board {
+public:
+  void deferSleepMode() {}
+  static unsigned long getSeconds() {
+    return (millis() / 1000);
+  }
+};
+
+class Element {
+public:
+  virtual ~Element() {}
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void start() {
+    active = true;
+  }
+  virtual void loop() {}
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+
+  Board *_board = nullptr;
+  bool active = false;
+};
@@ -0,0 +1,98 @@
+// WiFiClient and WiFi replacement for the httppool test using host sockets.
+// Connections to port 80 are redirected to the port of the stand-in server.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <errno.h>
+
+/// @brief port of the stand-in server on localhost.
+inline uint16_t mockServerPort = 0;
+
+class WiFiClient {
+public:
+  ~WiFiClient() {
+    stop();
+  }
+
+  int connect(IPAddress ip, uint16_t port) {
+    stop();
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port == 80 ? mockServerPort : port);
+    addr.sin_addr.s_addr = (uint32_t)ip;
+    if (::connect(_fd, (sockaddr *)&addr, sizeof(addr)) != 0) {
+      stop();
+      return (0);
+    }
+    return (1);
+  }
+
+  uint8_t connected() {
+    if (_fd < 0) return (0);
+    if (available() > 0) return (1);
+    char c;
+    ssize_t r = recv(_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return ((r > 0) || ((r < 0) && (errno == EAGAIN || errno == EWOULDBLOCK)));
+  }
+
+  int available() {
+    int n = 0;
+    if ((_fd < 0) || (ioctl(_fd, FIONREAD, &n) != 0)) return (0);
+    return (n);
+  }
+
+  size_t write(const char *s) {
+    return ((_fd < 0) ? 0 : send(_fd, s, strlen(s), MSG_NOSIGNAL));
+  }
+
+  size_t readBytes(char *buffer, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+      ssize_t r = recv(_fd, buffer + got, len - got, 0);
+      if (r <= 0) break;
+      got += r;
+    }
+    return (got);
+  }
+
+  String readStringUntil(char term) {
+    String s;
+    char c;
+    while (recv(_fd, &c, 1, 0) == 1) {
+      if (c == term) break;
+      s.concat(c);
+    }
+    return (s);
+  }
+
+  void stop() {
+    if (_fd >= 0) close(_fd);
+    _fd = -1;
+  }
+
+private:
+  int _fd = -1;
+};
+
+
+/// @brief WiFi replacement counting the DNS requests.
+class WiFiClass {
+public:
+  int hostByName(const char * /* host */, IPAddress &ip) {
+    dnsRequests++;
+    ip = IPAddress(127, 0, 0, 1);
+    return (1);
+  }
+
+  int dnsRequests = 0;
+};
+
+inline WiFiClass WiFi;
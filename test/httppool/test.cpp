@@ -0,0 +1,189 @@
+// Test of the HttpPool, HttpClientElement and RemoteElement against a local http stand-in server.
+// * kept-alive connections are reused for several requests.
+// * DNS results are cached until the TTL expires.
+// * several actions to the same remote element are sent in one request.
+
+#include <HomeDing.h>
+#include <RemoteElement.h>
+#include <core/HttpPool.h>
+#include <TestCheck.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ===== stand-in server =====
+
+std::mutex serverLock;
+std::vector<std::string> serverRequests;  // request lines received
+std::atomic<int> serverConnections(0);    // accepted connections
+std::atomic<bool> serverClose(false);     // answer with "Connection: close" and close
+
+static void serveConnection(int fd) {
+  std::string buffer;
+  char data[512];
+
+  for (;;) {
+    size_t end = buffer.find("\r\n\r\n");
+    if (end == std::string::npos) {
+      ssize_t r = recv(fd, data, sizeof(data), 0);
+      if (r <= 0) break;
+      buffer.append(data, r);
+      continue;
+    }
+
+    std::string line = buffer.substr(0, buffer.find("\r\n"));
+    buffer.erase(0, end + 4);
+    {
+      std::lock_guard<std::mutex> g(serverLock);
+      serverRequests.push_back(line);
+    }
+
+    bool close = serverClose;
+    std::string reply = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 2\r\n";
+    reply += (close ? "Connection: close\r\n\r\n{}" : "Connection: keep-alive\r\n\r\n{}");
+    send(fd, reply.c_str(), reply.size(), MSG_NOSIGNAL);
+    if (close) break;
+  }
+  ::close(fd);
+}
+
+static void startServer() {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  bind(fd, (sockaddr *)&addr, sizeof(addr));
+  listen(fd, 8);
+
+  socklen_t len = sizeof(addr);
+  getsockname(fd, (sockaddr *)&addr, &len);
+  mockServerPort = ntohs(addr.sin_port);
+
+  std::thread([fd]() {
+    for (;;) {
+      int c = accept(fd, nullptr, nullptr);
+      if (c < 0) break;
+      serverConnections++;
+      std::thread(serveConnection, c).detach();
+    }
+  }).detach();
+}
+
+static std::vector<std::string> takeRequests() {
+  std::lock_guard<std::mutex> g(serverLock);
+  std::vector<std::string> r;
+  r.swap(serverRequests);
+  return (r);
+}
+
+// ===== test helpers =====
+
+Board board;
+
+// run the element until all requests are done.
+static void run(RemoteElement &e) {
+  for (int n = 0; n < 5000; n++) {
+    e.loop();
+    if (!e.isActive()) {
+      e.loop();  // start the next queued request
+      if (!e.isActive()) return;
+    }
+    usleep(200);
+  }
+  printf("  requests not completed\n");
+}
+
+static void dispatch(RemoteElement &e, const char *target, const char *name, const char *value) {
+  String t(target), n(name), v(value);
+  e.dispatchAction(t, n, v);
+}
+
+
+int main() {
+  startServer();
+  mockMillis = 1000;
+
+  RemoteElement e;
+  e._board = &board;
+  e.set("host", "standin");
+  e.start();
+
+  // ===== keep-alive: three requests on one connection, one DNS request
+  dispatch(e, "device/0", "a", "1");
+  run(e);
+  dispatch(e, "device/0", "a", "2");
+  run(e);
+  dispatch(e, "device/0", "a", "3");
+  run(e);
+
+  auto reqs = takeRequests();
+  CHECK_EQUAL(3u, reqs.size());
+  CHECK_EQUAL(1, serverConnections.load());
+  CHECK_EQUAL(1, WiFi.dnsRequests);
+
+  // ===== a server closing the connection: the next request uses a new connection
+  serverClose = true;
+  dispatch(e, "device/0", "b", "1");
+  run(e);
+  dispatch(e, "device/0", "b", "2");
+  run(e);
+  serverClose = false;
+
+  reqs = takeRequests();
+  CHECK_EQUAL(2u, reqs.size());
+  CHECK_EQUAL(2, serverConnections.load());
+
+  // ===== idle connections are closed by the pool
+  dispatch(e, "device/0", "c", "1");
+  run(e);
+  mockMillis += HTTPPOOL_IDLE_TIMEOUT + 1;
+  dispatch(e, "device/0", "c", "2");
+  run(e);
+
+  reqs = takeRequests();
+  CHECK_EQUAL(2u, reqs.size());
+  CHECK_EQUAL(4, serverConnections.load());
+
+  // ===== DNS results are cached until the TTL expires
+  int dns = WiFi.dnsRequests;
+  mockMillis += HTTPPOOL_DNS_TTL / 2;
+  dispatch(e, "device/0", "d", "1");
+  run(e);
+  CHECK_EQUAL(dns, WiFi.dnsRequests);
+
+  mockMillis += HTTPPOOL_DNS_TTL / 2 + 1;
+  dispatch(e, "device/0", "d", "2");
+  run(e);
+  CHECK_EQUAL(dns + 1, WiFi.dnsRequests);
+
+  mockMillis += 1000;
+  dispatch(e, "device/0", "d", "3");
+  run(e);
+  CHECK_EQUAL(dns + 1, WiFi.dnsRequests);
+  takeRequests();
+
+  // ===== batching: actions to the same element while a request is running
+  dispatch(e, "device/0", "on", "1");  // sent immediately
+  dispatch(e, "value/1", "a", "1");
+  dispatch(e, "value/1", "b", "2");
+  dispatch(e, "value/1", "c", "3");
+  dispatch(e, "device/0", "off", "1");
+  dispatch(e, "value/1", "d", "4");
+  run(e);
+
+  reqs = takeRequests();
+  CHECK_EQUAL(4u, reqs.size());
+  if (reqs.size() == 4) {
+    CHECK_EQUAL(std::string("GET /api/state/device/0?on=1 HTTP/1.1"), reqs[0]);
+    CHECK_EQUAL(std::string("GET /api/state/value/1?a=1&b=2&c=3 HTTP/1.1"), reqs[1]);
+    CHECK_EQUAL(std::string("GET /api/state/device/0?off=1 HTTP/1.1"), reqs[2]);
+    CHECK_EQUAL(std::string("GET /api/state/value/1?d=4 HTTP/1.1"), reqs[3]);
+  }
+
+  return (testResult("httppool"));
+}
+
+// End.
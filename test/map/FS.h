@@ -0,0 +1,5 @@
+// FS.h replacement for the map test.
+
+#pragma once
+
+class FS;
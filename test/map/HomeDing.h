@@ -0,0 +1,81 @@
+// HomeDing.h replacement for the map test.
+
+#pragma once
+
+#include <Arduino.h>
+#include <ArrayString.h>
+
+#include <functional>
+#include <vector>
+
+#define LOGGER_EERR(...)
+#define LOGGER_ETRACE(...)
+
+class Board;
+
+class Element {
+public:
+  virtual ~Element() {}
+  virtual void init(Board *board) {
+    _board = board;
+  }
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void loop() {}
+  virtual void pushState(std::function<void(const char *pName, const char *eValue)> /* callback */) {}
+  virtual bool getOutputs(std::function<void(const String &action)> /* callback */) {
+    return (false);
+  }
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static bool _atob(const char *value) {
+    return ((*value == '1') || (*value == 't') || (*value == 'T'));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+  static bool _stristartswith(const char *s, const char *prefix) {
+    return (strncasecmp(s, prefix, strlen(prefix)) == 0);
+  }
+  static bool _scanIndexParam(const char *name, size_t &index, String &indexName) {
+    const char *p = strchr(name, '[');
+    if (p) {
+      index = (size_t)strtoul(p + 1, nullptr, 10);
+      p = strchr(p, '/');
+    }
+    if (p) indexName = p + 1;
+    return (p);
+  }
+
+  Board *_board = nullptr;
+};
+
+/// @brief actions pushed into the action queue.
+inline std::vector<std::string> pushedActions;
+
+namespace HomeDing::Actions {
+inline const char *Value = "value";
+inline const char *Type = "type";
+inline const char *OnValue = "onValue";
+
+class ActionString {
+public:
+  ActionString &operator=(const char *action) {
+    _text = action;
+    return (*this);
+  }
+  operator const String &() const {
+    return (_text);
+  }
+
+private:
+  String _text;
+};
+
+inline void push(const String &action, const String &value) {
+  if (!action.isEmpty()) pushedActions.push_back(std::string(action.c_str()) + "=" + value.c_str());
+}
+}  // namespace HomeDing::Actions
@@ -0,0 +1,211 @@
+// Test and benchmark of the segment table of the MapElement.
+// * random rules map every value to the same rule as the linear scan of all rules.
+// * float bounds, rules without bounds and the actions of a rule.
+// * benchmark of mapping values with 24 rules: linear scan against the segment table.
+
+#include <Arduino.h>
+
+#define private public
+#include <HomeDing.h>
+#include <MapElement.h>
+#undef private
+
+#include <TestCheck.h>
+
+#include <chrono>
+
+// ===== helpers =====
+
+// find the first fitting rule by comparing the value with the bounds of all rules.
+static int linearScan(MapElement &m, const char *value) {
+  size_t count = std::max(std::max(m._mMin.size(), m._mMax.size()), std::max(m._mValue.size(), m._mActions.size()));
+
+  for (size_t n = 0; n < count; n++) {
+    String lo = m._mMin[n];
+    String hi = m._mMax[n];
+    int cLo = 0, cHi = 0;
+
+    if (m._type == MapElement::MapType::Str) {
+      if (!lo.isEmpty()) cLo = strcasecmp(value, lo.c_str());
+      if (!hi.isEmpty()) cHi = strcasecmp(value, hi.c_str());
+
+    } else if (m._type == MapElement::MapType::Float) {
+      float v = strtof(value, nullptr);
+      if (!lo.isEmpty()) cLo = (v < strtof(lo.c_str(), nullptr)) ? -1 : 0;
+      if (!hi.isEmpty()) cHi = (v > strtof(hi.c_str(), nullptr)) ? 1 : 0;
+
+    } else {
+      int v = atoi(value);
+      if (!lo.isEmpty()) cLo = (v < lo.toInt()) ? -1 : 0;
+      if (!hi.isEmpty()) cHi = (v > hi.toInt()) ? 1 : 0;
+    }
+    if ((cLo >= 0) && (cHi <= 0)) return (n);
+  }
+  return (-1);
+}
+
+// map a value and return the index of the found rule or -1.
+static int map(MapElement &m, const char *value) {
+  m._currentMapIndex = -1;
+  m._needUpdate = false;
+  m.set(HomeDing::Actions::Value, value);
+  return (m._needUpdate ? m._currentMapIndex : -1);
+}
+
+static void setRule(MapElement &m, int n, const char *name, const char *value) {
+  char buffer[40];
+  snprintf(buffer, sizeof(buffer), "rules[%d]/%s", n, name);
+  m.set(buffer, value);
+}
+
+static void setRule(MapElement &m, int n, const char *name, int value) {
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "%d", value);
+  setRule(m, n, name, buffer);
+}
+
+static unsigned long long nowMicros() {
+  return (std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+
+// ===== tests =====
+
+static void testRandomRules() {
+  static const char *words[] = { "a", "b", "ba", "c", "m", "mm", "x", "z", "B", "Zz" };
+  char value[16];
+  int mismatches = 0;
+
+  srand(1);
+  for (int round = 0; round < 1000; round++) {
+    MapElement m;
+    bool isString = (round % 3 == 0);
+    if (isString) m.set(HomeDing::Actions::Type, "string");
+
+    // rules with min and max, only min, only max, equal or no bounds.
+    int rules = 1 + rand() % 25;
+    for (int n = 0; n < rules; n++) {
+      int kind = rand() % 5;
+      if (isString) {
+        if (kind != 0) setRule(m, n, "min", words[rand() % 10]);
+        if (kind != 1) setRule(m, n, "max", words[rand() % 10]);
+      } else if (kind == 4) {
+        setRule(m, n, "equal", rand() % 100 - 50);
+      } else {
+        int lo = rand() % 100 - 50;
+        if (kind != 0) setRule(m, n, "min", lo);
+        if (kind != 1) setRule(m, n, "max", lo + rand() % 30);
+      }
+      snprintf(value, sizeof(value), "r%d", n);
+      setRule(m, n, "value", value);
+    }
+
+    for (int t = 0; t < 100; t++) {
+      if (isString) {
+        strcpy(value, words[rand() % 10]);
+      } else {
+        snprintf(value, sizeof(value), "%d", rand() % 140 - 70);
+      }
+      int expected = linearScan(m, value);
+      int found = map(m, value);
+      if ((expected != found) && (mismatches++ < 5)) {
+        printf("  round %d value '%s': rule %d expected, rule %d found\n", round, value, expected, found);
+      }
+      CHECK_EQUAL(expected, found);
+    }
+  }
+}
+
+
+static void testFloat() {
+  MapElement m;
+  m.set(HomeDing::Actions::Type, "float");
+  setRule(m, 0, "max", "0.5");
+  setRule(m, 1, "min", "0.5");
+  setRule(m, 1, "max", "1.5");
+  setRule(m, 2, "value", "high");
+
+  CHECK_EQUAL(0, map(m, "0.2"));
+  CHECK_EQUAL(0, map(m, "0.5"));
+  CHECK_EQUAL(1, map(m, "0.51"));
+  CHECK_EQUAL(1, map(m, "1.5"));
+  CHECK_EQUAL(2, map(m, "1.6"));
+  CHECK_EQUAL(std::string("high"), std::string(m._value.c_str()));
+
+  // changing the type compiles the rules again.
+  m.set(HomeDing::Actions::Type, "int");
+  CHECK_EQUAL(1, map(m, "1"));
+}
+
+
+static void testActions() {
+  MapElement m;
+  setRule(m, 0, "max", 9);
+  setRule(m, 0, "value", "low");
+  setRule(m, 0, "onValue", "display/t?text=$v");
+  setRule(m, 1, "min", 10);
+  m.set(HomeDing::Actions::OnValue, "value/v?value=$v");
+
+  pushedActions.clear();
+  m.set(HomeDing::Actions::Value, "5");
+  m.loop();
+  m.set(HomeDing::Actions::Value, "42");
+  m.loop();
+  m.loop();  // nothing new
+
+  CHECK_EQUAL(3u, pushedActions.size());
+  if (pushedActions.size() == 3) {
+    CHECK_EQUAL(std::string("display/t?text=$v=low"), pushedActions[0]);
+    CHECK_EQUAL(std::string("value/v?value=$v=low"), pushedActions[1]);
+    CHECK_EQUAL(std::string("value/v?value=$v=42"), pushedActions[2]);
+  }
+
+  // no rule fits
+  m.set("rules[1]/max", "20");
+  CHECK_EQUAL(-1, map(m, "21"));
+}
+
+
+static void benchmark() {
+  const int count = 200000;
+  MapElement m;
+  char value[16];
+  volatile int sum = 0;
+
+  for (int n = 0; n < 24; n++) {
+    setRule(m, n, "min", n * 10);
+    setRule(m, n, "max", n * 10 + 9);
+    setRule(m, n, "value", "x");
+  }
+
+  unsigned long long t0 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    snprintf(value, sizeof(value), "%d", (i * 7) % 240);
+    sum += linearScan(m, value);
+  }
+  unsigned long long t1 = nowMicros();
+  for (int i = 0; i < count; i++) {
+    snprintf(value, sizeof(value), "%d", (i * 7) % 240);
+    m.set(HomeDing::Actions::Value, value);
+    sum += m._currentMapIndex;
+  }
+  unsigned long long t2 = nowMicros();
+
+  printf("map %d values with 24 rules:\n", count);
+  printf("  linear scan:   %5llu ns per value\n", (t1 - t0) * 1000 / count);
+  printf("  segment table: %5llu ns per value, %d segments\n", (t2 - t1) * 1000 / count, (int)m._segments.size());
+  CHECK(t2 - t1 < t1 - t0);
+}
+
+
+int main() {
+  testRandomRules();
+  testFloat();
+  testActions();
+  benchmark();
+  return (testResult("map"));
+}
+
+// End.
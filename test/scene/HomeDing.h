@@ -0,0 +1,117 @@
+// HomeDing.h replacement for the scene test.
+
+#pragma once
+
+#include <Arduino.h>
+#include <ArrayString.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#define LOGGER_EERR(...)
+#define LOGGER_ETRACE(...)
+
+class Element;
+
+class Board {
+public:
+  /// @brief the time the scene wants to be woken up.
+  void wakeAfter(Element * /* elem */, unsigned long msecs) {
+    wakeTime = millis() + msecs;
+  }
+
+  unsigned long wakeTime = 0;
+};
+
+class Element {
+public:
+  enum CATEGORY : uint16_t {
+    Standard = 0x0001
+  };
+
+  virtual ~Element() {}
+  virtual void init(Board *board) {
+    _board = board;
+  }
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void start() {
+    active = true;
+  }
+  virtual void term() {
+    active = false;
+  }
+  virtual void loop() {}
+  virtual void pushState(std::function<void(const char *pName, const char *eValue)> /* callback */) {}
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static int _atoi(const char *value, int min, int max) {
+    return (constrain(_atoi(value), min, max));
+  }
+  static bool _atob(const char *value) {
+    return ((*value == '1') || (*value == 't') || (*value == 'T'));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+  static bool _stristartswith(const char *s, const char *prefix) {
+    return (strncasecmp(s, prefix, strlen(prefix)) == 0);
+  }
+
+  // durations like "2s" or "500ms" in msec.
+  static unsigned long _scanDuration(const char *value) {
+    char *pEnd;
+    unsigned long ret = strtoul(value, &pEnd, 10);
+    return (strcmp(pEnd, "ms") == 0 ? ret : ret * 1000);
+  }
+
+  static bool _scanIndexParam(const char *name, size_t &index, String &indexName) {
+    const char *p = strchr(name, '[');
+    if (p) {
+      index = (size_t)strtoul(p + 1, nullptr, 10);
+      p = strchr(p, ']');
+    }
+    if (p) p = strchr(p, '/');
+    if (p) indexName = p + 1;
+    return (p);
+  }
+
+  const char *id = "";
+  bool active = false;
+  CATEGORY category = CATEGORY::Standard;
+  Board *_board = nullptr;
+};
+
+/// @brief sent actions with the time in msecs.
+inline std::vector<std::string> sentActions;
+
+namespace HomeDing::Actions {
+inline const char *Start = "start";
+inline const char *Stop = "stop";
+inline const char *Next = "next";
+inline const char *Prev = "prev";
+inline const char *Step = "step";
+
+class ActionString {
+public:
+  ActionString &operator=(const String &action) {
+    _text = action;
+    return (*this);
+  }
+  operator const String &() const {
+    return (_text);
+  }
+
+private:
+  String _text;
+};
+
+inline void push(const ActionString &action) {
+  const String &text = action;
+  sentActions.push_back(std::string(text.c_str()) + "@" + std::to_string(millis()));
+}
+}  // namespace HomeDing::Actions
@@ -0,0 +1,215 @@
+// Test of the sequencing of the SceneElement.
+// * steps are sent with the delay of the scene or the delay of the step.
+// * tracks run in parallel, the scene ends when all tracks have finished.
+// * repeat starts the scene again, stop ends it.
+// * next and prev step through a scene without delay.
+// * scenes with a priority stop and block scenes with the same or a lower priority.
+
+#include <Arduino.h>
+
+#define private public
+#include <HomeDing.h>
+#include <SceneElement.h>
+#undef private
+
+#include <TestCheck.h>
+
+// ===== helpers =====
+
+struct TestScene {
+  Board board;
+  SceneElement scene;
+
+  TestScene(const char *elementId) {
+    scene.id = elementId;
+    scene.init(&board);
+    scene.start();
+  }
+  ~TestScene() {
+    scene.term();
+  }
+};
+
+// run the loop of the scenes every 10 msecs until the given time.
+static void runUntil(std::vector<TestScene *> scenes, unsigned long until) {
+  while (mockMillis < until) {
+    mockMillis += 10;
+    for (TestScene *t : scenes) {
+      if (t->scene._running && (t->board.wakeTime <= mockMillis)) t->scene.loop();
+    }
+  }
+}
+
+static void runUntil(TestScene &t, unsigned long until) {
+  runUntil(std::vector<TestScene *>{ &t }, until);
+}
+
+static std::string joinActions() {
+  std::string s;
+  for (auto &a : sentActions) {
+    if (!s.empty()) s += ",";
+    s += a;
+  }
+  sentActions.clear();
+  return (s);
+}
+
+// start a scene at time 0 and run its first loop.
+static void startScene(TestScene &t) {
+  mockMillis = 0;
+  sentActions.clear();
+  t.scene.set(HomeDing::Actions::Start, "1");
+  t.scene.loop();
+}
+
+
+// ===== tests =====
+
+static void testDelay() {
+  TestScene t("scene/s");
+  t.scene.set("delay", "1s");
+  t.scene.set("steps[0]", "a");
+  t.scene.set("steps[1]", "b");
+  t.scene.set("steps[2]", "c");
+
+  startScene(t);
+  CHECK(t.scene._running);
+  CHECK_EQUAL(1000ul, t.board.wakeTime);
+  runUntil(t, 5000);
+  CHECK_EQUAL(std::string("a@0,b@1000,c@2000"), joinActions());
+  CHECK(!t.scene._running);
+
+  // the delay of a step is used instead of the delay of the scene.
+  t.scene.set("steps[1]/delay", "300ms");
+  t.scene.set("steps[0]/delay", "50ms");
+  startScene(t);
+  runUntil(t, 5000);
+  CHECK_EQUAL(std::string("a@50,b@350,c@1350"), joinActions());
+}
+
+
+static void testTracks() {
+  TestScene t("scene/s");
+  t.scene.set("delay", "1s");
+  t.scene.set("steps[0]/actions", "a");
+  t.scene.set("steps[1]/actions", "x");
+  t.scene.set("steps[1]/track", "1");
+  t.scene.set("steps[2]/actions", "b");
+  t.scene.set("steps[3]/actions", "y");
+  t.scene.set("steps[3]/track", "1");
+  t.scene.set("steps[3]/delay", "300ms");
+  t.scene.set("steps[4]/actions", "z");
+  t.scene.set("steps[4]/track", "1");
+
+  // both tracks start at once, track 1 ends after track 0.
+  startScene(t);
+  runUntil(t, 1200);
+  CHECK(t.scene._running);
+  runUntil(t, 5000);
+  CHECK_EQUAL(std::string("a@0,x@0,y@300,b@1000,z@1300"), joinActions());
+  CHECK(!t.scene._running);
+
+  // track numbers are limited.
+  t.scene.set("steps[5]/actions", "w");
+  t.scene.set("steps[5]/track", "9");
+  startScene(t);
+  CHECK_EQUAL(SCENE_MAX_TRACKS - 1, t.scene._stepConfig[5].track);
+}
+
+
+static void testRepeat() {
+  TestScene t("scene/s");
+  t.scene.set("delay", "100ms");
+  t.scene.set("repeat", "true");
+  t.scene.set("steps[0]", "a");
+  t.scene.set("steps[1]", "b");
+
+  // the scene starts again after the delay.
+  startScene(t);
+  runUntil(t, 350);
+  CHECK_EQUAL(std::string("a@0,b@100,a@200,b@300"), joinActions());
+  CHECK(t.scene._running);
+
+  t.scene.set(HomeDing::Actions::Stop, "1");
+  CHECK(!t.scene._running);
+  runUntil(t, 1000);
+  CHECK_EQUAL(std::string(""), joinActions());
+}
+
+
+static void testNextPrev() {
+  TestScene t("scene/s");
+  t.scene.set("delay", "-1");
+  t.scene.set("steps[0]", "a");
+  t.scene.set("steps[1]", "b");
+  t.scene.set("steps[2]", "c");
+
+  // only the first step is sent on start.
+  startScene(t);
+  runUntil(t, 5000);
+  CHECK_EQUAL(std::string("a@0"), joinActions());
+
+  t.scene.set(HomeDing::Actions::Next, "1");
+  runUntil(t, 5100);
+  t.scene.set(HomeDing::Actions::Next, "1");
+  runUntil(t, 5200);
+  t.scene.set(HomeDing::Actions::Next, "1");  // no more steps
+  runUntil(t, 5300);
+  t.scene.set(HomeDing::Actions::Prev, "1");
+  runUntil(t, 5400);
+  CHECK_EQUAL(std::string("b@5010,c@5110,b@5310"), joinActions());
+}
+
+
+static void testPriority() {
+  TestScene light("scene/light"), alarm("scene/alarm"), info("scene/info"), alarm2("scene/alarm2");
+  std::vector<TestScene *> all = { &light, &alarm, &info, &alarm2 };
+  for (TestScene *t : all) {
+    t->scene.set("delay", "1s");
+    t->scene.set("steps[0]", t->scene.id);
+    t->scene.set("steps[1]", t->scene.id);
+  }
+  alarm.scene.set("priority", "2");
+  info.scene.set("priority", "1");
+  alarm2.scene.set("priority", "2");
+
+  // a scene with a priority stops a scene without a priority.
+  startScene(light);
+  alarm.scene.set(HomeDing::Actions::Start, "1");
+  CHECK(!light.scene._running);
+  CHECK(alarm.scene._running);
+
+  // scenes with a lower priority or without a priority are not started.
+  info.scene.set(HomeDing::Actions::Start, "1");
+  light.scene.set(HomeDing::Actions::Start, "1");
+  CHECK(!info.scene._running);
+  CHECK(!light.scene._running);
+
+  // a scene with the same priority stops the running scene.
+  alarm2.scene.set(HomeDing::Actions::Start, "1");
+  CHECK(!alarm.scene._running);
+  CHECK(alarm2.scene._running);
+  runUntil(all, 3000);
+  CHECK_EQUAL(std::string("scene/light@0,scene/alarm2@10,scene/alarm2@1010"), joinActions());
+
+  // without a running scene with a higher priority all scenes can start,
+  // info stops the light scene again.
+  CHECK(!alarm2.scene._running);
+  light.scene.set(HomeDing::Actions::Start, "1");
+  CHECK(light.scene._running);
+  info.scene.set(HomeDing::Actions::Start, "1");
+  CHECK(info.scene._running);
+  CHECK(!light.scene._running);
+}
+
+
+int main() {
+  testDelay();
+  testTracks();
+  testRepeat();
+  testNextPrev();
+  testPriority();
+  return (testResult("scene"));
+}
+
+// End.
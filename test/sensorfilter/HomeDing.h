@@ -0,0 +1,90 @@
+// HomeDing.h replacement for the sensorfilter test.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#define LOGGER_EERR(...)
+#define LOGGER_ETRACE(...)
+
+class Board {
+public:
+  unsigned long nowMillis = 0;
+};
+
+class Element {
+public:
+  virtual ~Element() {}
+  virtual void init(Board *board) {
+    _board = board;
+  }
+  virtual bool set(const char * /* name */, const char * /* value */) {
+    return (false);
+  }
+  virtual void start() {
+    active = true;
+  }
+  virtual void term() {
+    active = false;
+  }
+  virtual void loop() {}
+  virtual void pushState(std::function<void(const char *pName, const char *eValue)> /* callback */) {}
+
+  static int _atoi(const char *value) {
+    return (strtol(value, nullptr, 0));
+  }
+  static bool _atob(const char *value) {
+    return ((*value == '1') || (*value == 't') || (*value == 'T'));
+  }
+  static int _stricmp(const char *a, const char *b) {
+    return (strcasecmp(a, b));
+  }
+
+  // durations like "30s", "2m" or "500ms" in msec.
+  static unsigned long _scanDuration(const char *value) {
+    char *pEnd;
+    unsigned long ret = strtoul(value, &pEnd, 10);
+    if (strcmp(pEnd, "ms") == 0) return (ret);
+    if (*pEnd == 'm') return (ret * 60 * 1000);
+    return (ret * 1000);
+  }
+
+  static String getItemValue(String data, int index) {
+    int start = 0;
+    for (int n = 0; (n < index) && (start >= 0); n++) {
+      start = data.indexOf(',', start);
+      if (start >= 0) start++;
+    }
+    if (start < 0) return (String());
+    int end = data.indexOf(',', start);
+    return (end < 0 ? data.substring(start) : data.substring(start, end));
+  }
+
+  bool active = false;
+  Board *_board = nullptr;
+};
+
+/// @brief values sent by the sensor.
+inline std::vector<std::string> sentValues;
+
+namespace HomeDing::Actions {
+
+class ActionString {
+public:
+  ActionString &operator=(const char *action) {
+    _text = action;
+    return (*this);
+  }
+
+private:
+  String _text;
+};
+
+inline void pushItem(const ActionString & /* action */, const String &values, int n) {
+  if (n == 0) sentValues.push_back(values.c_str());
+}
+}  // namespace HomeDing::Actions
@@ -0,0 +1,266 @@
+// Test of the value filters of the SensorElement.
+// * median, average and smooth (exponential) filters while the window fills and when it is full.
+// * changing the filtersize restarts the filters, filters per value.
+// * values within the deadband are suppressed and counted.
+// * the adaptive read time and its reset when readtime is changed.
+
+#include <Arduino.h>
+
+#define private public
+#define protected public
+#include <HomeDing.h>
+#include <sensors/SensorElement.h>
+#undef protected
+#undef private
+
+#include <TestCheck.h>
+
+// ===== helpers =====
+
+// sensor returning the given values.
+class TestSensor : public SensorElement {
+public:
+  TestSensor(int count) {
+    _valuesCount = count;
+    init(&board);
+    set("warmuptime", "0");
+  }
+
+  virtual bool getProbe(String &values) override {
+    values = probe;
+    reads++;
+    lastReadTime = board.nowMillis;
+    return (true);
+  }
+
+  Board board;
+  String probe;
+  int reads = 0;
+  unsigned long lastReadTime = 0;
+};
+
+// let the sensor read the value and return the msecs since the last read.
+static unsigned long nextRead(TestSensor &s, const char *value) {
+  unsigned long last = s.lastReadTime;
+  int reads = s.reads;
+
+  if (!s.active) s.start();
+  s.probe = value;
+  for (int n = 0; (n < 100000) && ((s.reads == reads) || (s._state != 1)); n++) {
+    s.board.nowMillis += 100;
+    mockMillis = s.board.nowMillis;
+    s.loop();
+  }
+  return (s.lastReadTime - last);
+}
+
+// check that the time between 2 reads is the read time.
+// The state machine needs a loop to start reading and another one to send.
+static bool isReadTime(unsigned long expected, unsigned long duration) {
+  return ((duration >= expected) && (duration <= expected + 200));
+}
+
+// read the value and return the filtered value.
+static std::string filtered(TestSensor &s, const char *value) {
+  nextRead(s, value);
+  return (s._lastValues.c_str());
+}
+
+
+// ===== tests =====
+
+static void testMedian() {
+  TestSensor s(1);
+  s.set("filter", "median");
+
+  // the window fills up to 5 values.
+  CHECK_EQUAL(std::string("10"), filtered(s, "10"));
+  CHECK_EQUAL(std::string("50"), filtered(s, "50"));
+  CHECK_EQUAL(std::string("20"), filtered(s, "20"));
+  CHECK_EQUAL(std::string("30"), filtered(s, "30"));
+  CHECK_EQUAL(std::string("30"), filtered(s, "40"));
+  CHECK_EQUAL(5, s._filters[0].count);
+
+  // 10 leaves the window: 20,30,40,50,100
+  CHECK_EQUAL(std::string("40"), filtered(s, "100"));
+  CHECK_EQUAL(5, s._filters[0].count);
+
+  // a single spike is removed.
+  CHECK_EQUAL(std::string("40"), filtered(s, "999"));
+  CHECK_EQUAL(std::string("40"), filtered(s, "40"));
+
+  // a new filtersize restarts the window.
+  s.set("filtersize", "3");
+  CHECK_EQUAL(0, s._filters[0].count);
+  CHECK(s._filters[0].data == nullptr);
+  CHECK_EQUAL(std::string("7"), filtered(s, "7"));
+  CHECK_EQUAL(std::string("9"), filtered(s, "9"));
+  CHECK_EQUAL(std::string("8"), filtered(s, "8"));
+  CHECK_EQUAL(std::string("9"), filtered(s, "12"));
+  CHECK_EQUAL(3, s._filters[0].count);
+}
+
+
+static void testAverage() {
+  TestSensor s(1);
+  s.set("filtersize", "4");
+  s.set("filter", "average");
+
+  CHECK_EQUAL(std::string("1.0"), filtered(s, "1.0"));
+  CHECK_EQUAL(std::string("1.5"), filtered(s, "2.0"));
+  CHECK_EQUAL(std::string("2.0"), filtered(s, "3.0"));
+  CHECK_EQUAL(std::string("2.5"), filtered(s, "4.0"));
+  // 1.0 leaves the window
+  CHECK_EQUAL(std::string("4.5"), filtered(s, "9.0"));
+}
+
+
+static void testSmooth() {
+  TestSensor s(1);
+  s.set("filtersize", "4");
+  s.set("filter", "smooth");
+
+  // the first value starts the smoothing, then alpha = 1/4.
+  CHECK_EQUAL(std::string("10.0"), filtered(s, "10.0"));
+  CHECK_EQUAL(std::string("12.5"), filtered(s, "20.0"));
+  CHECK_EQUAL(std::string("14.4"), filtered(s, "20.0"));
+  CHECK_EQUAL(1, s._filters[0].count);
+
+  // the smoothed value reaches a constant value.
+  for (int n = 0; n < 40; n++) filtered(s, "20.0");
+  CHECK_EQUAL(std::string("20.0"), filtered(s, "20.0"));
+}
+
+
+static void testFilterList() {
+  TestSensor s(2);
+  s.set("filter", "median,none");
+
+  CHECK_EQUAL(std::string("10,10"), filtered(s, "10,10"));
+  CHECK_EQUAL(std::string("90,90"), filtered(s, "90,90"));
+  CHECK_EQUAL(std::string("11,11"), filtered(s, "11,11"));
+
+  // the last filter is used for the remaining values.
+  CHECK_EQUAL(2, s._filters[0].type);
+  CHECK_EQUAL(0, s._filters[1].type);
+  CHECK_EQUAL(0, s._filters[5].type);
+}
+
+
+static void testDeadband() {
+  TestSensor s(2);
+  s.set("deadband", "0.5,2");
+  sentValues.clear();
+
+  CHECK_EQUAL(std::string("20.0,50"), filtered(s, "20.0,50"));
+  CHECK_EQUAL(1u, s._sentCount);
+  CHECK_EQUAL(0u, s._suppressedCount);
+
+  // all values within the deadband: not sent.
+  CHECK_EQUAL(std::string("20.0,50"), filtered(s, "20.3,51"));
+  CHECK_EQUAL(std::string("20.0,50"), filtered(s, "19.6,48"));
+  CHECK_EQUAL(1u, s._sentCount);
+  CHECK_EQUAL(2u, s._suppressedCount);
+
+  // the difference is checked against the last sent value, not the last read value.
+  CHECK_EQUAL(std::string("20.6,50"), filtered(s, "20.6,50"));
+  CHECK_EQUAL(2u, s._sentCount);
+
+  // one value outside of its deadband sends all values.
+  CHECK_EQUAL(std::string("20.6,53"), filtered(s, "20.6,53"));
+  CHECK_EQUAL(3u, s._sentCount);
+
+  // a missing value is a change.
+  CHECK_EQUAL(std::string("20.6,"), filtered(s, "20.6,"));
+  CHECK_EQUAL(4u, s._sentCount);
+  CHECK_EQUAL(2u, s._suppressedCount);
+
+  CHECK_EQUAL(4u, sentValues.size());
+  if (sentValues.size() == 4) {
+    CHECK_EQUAL(std::string("20.0,50"), sentValues[0]);
+    CHECK_EQUAL(std::string("20.6,"), sentValues[3]);
+  }
+
+  // the counters are part of the state.
+  std::string state;
+  s.pushState([&](const char *name, const char *value) {
+    state += std::string(name) + "=" + value + ";";
+  });
+  CHECK(state.find("sent=4;") != std::string::npos);
+  CHECK(state.find("suppressed=2;") != std::string::npos);
+}
+
+
+static void testFilterAndDeadband() {
+  TestSensor s(1);
+  s.set("filter", "median");
+  s.set("filtersize", "3");
+  s.set("deadband", "1");
+
+  CHECK_EQUAL(std::string("20"), filtered(s, "20"));
+  // the medians 21, 20 and 21 are within the deadband of 20
+  CHECK_EQUAL(std::string("20"), filtered(s, "21"));
+  CHECK_EQUAL(std::string("20"), filtered(s, "20"));
+  CHECK_EQUAL(std::string("20"), filtered(s, "25"));
+  // the median 25 is outside
+  CHECK_EQUAL(std::string("25"), filtered(s, "26"));
+  CHECK_EQUAL(3u, s._suppressedCount);
+}
+
+
+static void testReadTime() {
+  TestSensor s(1);
+  s.set("readtime", "60s");
+  s.set("minreadtime", "10s");
+
+  nextRead(s, "1");
+  CHECK_EQUAL(30000ul, s._curReadTime);
+
+  // changing values: the read time is halved down to minreadtime.
+  CHECK(isReadTime(30000, nextRead(s, "2")));
+  CHECK_EQUAL(15000ul, s._curReadTime);
+  CHECK(isReadTime(15000, nextRead(s, "3")));
+  CHECK_EQUAL(10000ul, s._curReadTime);
+  CHECK(isReadTime(10000, nextRead(s, "4")));
+  CHECK_EQUAL(10000ul, s._curReadTime);
+
+  // stable values: the read time is doubled up to readtime.
+  CHECK(isReadTime(10000, nextRead(s, "4")));
+  CHECK_EQUAL(20000ul, s._curReadTime);
+  CHECK(isReadTime(20000, nextRead(s, "4")));
+  CHECK_EQUAL(40000ul, s._curReadTime);
+  CHECK(isReadTime(40000, nextRead(s, "4")));
+  CHECK_EQUAL(60000ul, s._curReadTime);
+  CHECK(isReadTime(60000, nextRead(s, "4")));
+  CHECK_EQUAL(60000ul, s._curReadTime);
+
+  // a new readtime is used at once, also when the read time was reduced.
+  nextRead(s, "5");
+  CHECK_EQUAL(30000ul, s._curReadTime);
+  s.set("readtime", "20s");
+  CHECK_EQUAL(20000ul, s._curReadTime);
+  CHECK(isReadTime(20000, nextRead(s, "5")));
+  CHECK(isReadTime(20000, nextRead(s, "5")));
+
+  // without minreadtime the read time is fixed.
+  TestSensor f(1);
+  f.set("readtime", "5s");
+  nextRead(f, "1");
+  CHECK(isReadTime(5000, nextRead(f, "2")));
+  CHECK(isReadTime(5000, nextRead(f, "2")));
+  CHECK_EQUAL(5000ul, f._curReadTime);
+}
+
+
+int main() {
+  testMedian();
+  testAverage();
+  testSmooth();
+  testFilterList();
+  testDeadband();
+  testFilterAndDeadband();
+  testReadTime();
+  return (testResult("sensorfilter"));
+}
+
+// End.
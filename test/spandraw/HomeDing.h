@@ -0,0 +1,14 @@
+// HomeDing.h replacement for the spandraw test using the real DisplayAdapter.h.
+
+#pragma once
+
+#include <Arduino.h>
+
+class WebServer;
+class FS;
+#define FILESYSTEM FS
+
+inline void optimistic_yield(uint32_t /* us */) {}
+
+#include <Board.h>
+#include <displays/DisplayAdapter.h>
@@ -0,0 +1,5 @@
+// WiFiClient.h replacement for the spandraw test.
+
+#pragma once
+
+class WiFiClient {};
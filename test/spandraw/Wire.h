@@ -0,0 +1,5 @@
+// Wire.h replacement for the spandraw test.
+
+#pragma once
+
+class TwoWire {};
@@ -0,0 +1,349 @@
+// Test and benchmark of the span based drawing functions in SpanDraw.
+// * the spans cover the same pixels as drawing pixel by pixel.
+// * primitives and pixels outside the display are clipped and never passed to the adapter.
+// * antialiased polygons blend the edge pixels by their coverage.
+// * pixels per second and pixels per adapter call on a mock framebuffer
+//   compared to drawing every pixel using the HomeDing::writeColor() function.
+
+#include <Arduino.h>
+#include <HomeDing.h>
+
+#include <displays/SpanDraw.h>
+
+#include <TestCheck.h>
+
+#include <chrono>
+#include <vector>
+
+// ===== parts of DisplayAdapter.cpp used by the test =====
+
+namespace HomeDing {
+DisplayAdapter *displayAdapter = nullptr;
+
+std::function<void(int16_t x, int16_t y)> writeColor(uint32_t color) {
+  return [color](int16_t x, int16_t y) {
+    displayAdapter->writePixel(x, y, color);
+  };
+}
+}  // namespace HomeDing
+
+bool DisplayAdapter::setup(Board *b) {
+  board = b;
+  return (true);
+}
+bool DisplayAdapter::start() {
+  return (true);
+}
+void DisplayAdapter::clear() {}
+void DisplayAdapter::fillRect(int16_t, int16_t, int16_t, int16_t, uint32_t) {}
+BoundingBox DisplayAdapter::drawText(int16_t x, int16_t y, int16_t, const char *, uint32_t) {
+  return (BoundingBox(x, y, x, y));
+}
+void DisplayAdapter::setBrightness(uint8_t) {}
+
+
+// ===== mock framebuffer =====
+
+/// @brief Display adapter drawing into memory.
+/// Every call of writePixel or writeSpan counts as one transfer to the display
+/// like a SPI display with setting the address window (11 bytes) and 2 bytes per pixel.
+class FrameBuffer : public DisplayAdapter {
+public:
+  FrameBuffer(int16_t w, int16_t h, bool spans) {
+    displayBox = BoundingBox(0, 0, w, h);
+    _w = w;
+    _h = h;
+    _spans = spans;
+    pixels.assign(w * h, 0);
+  }
+
+  void writePixel(int16_t x, int16_t y, uint32_t color) override {
+    calls++;
+    bytes += 11 + 2;
+    if ((x < 0) || (x >= _w) || (y < 0) || (y >= _h)) {
+      outside++;
+    } else {
+      pixels[y * _w + x] = color;
+    }
+  }
+
+  void writeSpan(int16_t y, int16_t x0, int16_t x1, uint32_t color) override {
+    if (!_spans) {
+      DisplayAdapter::writeSpan(y, x0, x1, color);
+    } else if ((y < 0) || (y >= _h) || (x0 < 0) || (x1 >= _w) || (x0 > x1)) {
+      calls++;
+      outside++;
+    } else {
+      calls++;
+      bytes += 11 + 2 * (x1 - x0 + 1);
+      std::fill(&pixels[y * _w + x0], &pixels[y * _w + x1] + 1, color);
+    }
+  }
+
+  uint32_t at(int16_t x, int16_t y) {
+    return (pixels[y * _w + x]);
+  }
+
+  long count(uint32_t color) {
+    return (std::count(pixels.begin(), pixels.end(), color));
+  }
+
+  std::vector<uint32_t> pixels;
+  long calls = 0;
+  long bytes = 0;
+  long outside = 0;
+
+private:
+  int16_t _w, _h;
+  bool _spans;
+};
+
+
+// draw a clock face with filled hands like the AnalogClock and DisplayCircle elements.
+static void drawScene(DisplayAdapter *da, int16_t cx, int16_t cy, int16_t r) {
+  SpanDraw::drawCircle(da, cx, cy, r, 0xFFFFFF, 0x202020, true);
+  for (int a = 0; a < 60; a++) {
+    float rad = M_PI * a / 30;
+    int16_t dx = lround(sin(rad) * r);
+    int16_t dy = lround(-cos(rad) * r);
+    SpanDraw::drawLine(da, cx + dx * 9 / 10, cy + dy * 9 / 10, cx + dx, cy + dy, 0x808080);
+  }
+  SpanDraw::drawThickLine(da, cx, cy, cx + r / 2, cy - r / 3, 5, 0xFFFF00);
+  SpanDraw::drawThickLine(da, cx, cy, cx - r / 4, cy + r * 3 / 4, 3, 0x00FFFF);
+  int16_t hand[] = { cx, (int16_t)(cy - r + 4), (int16_t)(cx + 4), cy, cx, (int16_t)(cy + 8), (int16_t)(cx - 4), cy };
+  SpanDraw::fillPolygon(da, hand, 4, 0xFF0000);
+  SpanDraw::fillCircle(da, cx, cy, 3, 0xFFFFFF);
+}
+
+
+// ===== tests =====
+
+static void testCoverage() {
+  FrameBuffer spans(240, 240, true);
+  FrameBuffer pixels(240, 240, false);
+
+  drawScene(&spans, 120, 120, 110);
+  drawScene(&pixels, 120, 120, 110);
+
+  CHECK(spans.pixels == pixels.pixels);
+  CHECK(spans.calls * 10 < pixels.calls);
+
+  // the circle covers about pi * r^2 pixels.
+  FrameBuffer circle(240, 240, true);
+  SpanDraw::fillCircle(&circle, 120, 120, 100, 1);
+  long n = circle.count(1);
+  CHECK((n > 31000) && (n < 31800));
+
+  // symmetric
+  bool sym = true;
+  for (int y = 1; y < 240; y++) {
+    for (int x = 1; x < 240; x++) {
+      if (circle.at(x, y) != circle.at(240 - x, y)) sym = false;
+      if (circle.at(x, y) != circle.at(x, 240 - y)) sym = false;
+    }
+  }
+  CHECK(sym);
+
+  // end points of lines are included
+  FrameBuffer line(100, 100, true);
+  SpanDraw::drawLine(&line, 10, 20, 80, 55, 1);
+  CHECK_EQUAL(1u, line.at(10, 20));
+  CHECK_EQUAL(1u, line.at(80, 55));
+  CHECK_EQUAL(71l, line.count(1));
+}
+
+
+static void testClipping() {
+  // drawing at the border must be the same as the inner part of a larger display.
+  FrameBuffer small(100, 80, true);
+  FrameBuffer large(300, 280, true);
+
+  drawScene(&small, 90, 10, 60);
+  drawScene(&large, 90 + 100, 10 + 100, 60);
+
+  CHECK_EQUAL(0l, small.outside);
+  bool same = true;
+  for (int y = 0; y < 80; y++) {
+    for (int x = 0; x < 100; x++) {
+      if (small.at(x, y) != large.at(x + 100, y + 100)) same = false;
+    }
+  }
+  CHECK(same);
+
+  // completely outside
+  SpanDraw::fillCircle(&small, -50, -50, 20, 1);
+  SpanDraw::drawLine(&small, 200, 0, 300, 70, 1);
+  int16_t poly[] = { -10, -10, -1, -10, -1, 90 };
+  SpanDraw::fillPolygon(&small, poly, 3, 1);
+  CHECK_EQUAL(0l, small.outside);
+  CHECK_EQUAL(0l, small.count(1));
+
+  // PixelSpans
+  {
+    SpanDraw::PixelSpans ps(&small);
+    for (int x = -20; x < 120; x++) ps.add(x, 40, 2);
+    ps.add(5, -1, 2);
+    ps.add(5, 80, 2);
+  }
+  CHECK_EQUAL(0l, small.outside);
+  CHECK_EQUAL(100l, small.count(2));
+}
+
+
+static void testPixelSpans() {
+  FrameBuffer spans(200, 200, true);
+  FrameBuffer pixels(200, 200, false);
+  uint32_t colors[] = { 1, 1, 1, 2, 3 };
+
+  // pixels in the order of a path widget: rows with some color changes and repeated pixels.
+  srand(4711);
+  std::vector<int> list;
+  for (int y = 10; y < 190; y++) {
+    int x0 = 100 - (rand() % 90);
+    int x1 = 100 + (rand() % 90);
+    for (int x = x0; x <= x1; x++) {
+      list.push_back(x);
+      list.push_back(y);
+      list.push_back(colors[(x / 16) % 5]);
+      if (rand() % 10 == 0) {
+        list.push_back(x);  // repeated pixel
+        list.push_back(y);
+        list.push_back(colors[(x / 16) % 5]);
+      }
+    }
+  }
+
+  HomeDing::displayAdapter = &pixels;
+  for (size_t i = 0; i < list.size(); i += 3) {
+    HomeDing::writeColor(list[i + 2])(list[i], list[i + 1]);
+  }
+
+  {
+    SpanDraw::PixelSpans ps(&spans);
+    for (size_t i = 0; i < list.size(); i += 3) {
+      ps.add(list[i], list[i + 1], list[i + 2]);
+    }
+  }
+
+  CHECK(spans.pixels == pixels.pixels);
+  CHECK(spans.calls * 8 < pixels.calls);
+}
+
+
+static void testPolygonAA() {
+  FrameBuffer fb(40, 40, true);
+
+  // pixel aligned square has no edge pixels.
+  int16_t square[] = { 160, 160, 320, 160, 320, 320, 160, 320 };
+  SpanDraw::fillPolygonAA(&fb, square, 4, 0xFFFFFF, 0);
+  CHECK_EQUAL(100l, fb.count(0xFFFFFF));
+  CHECK_EQUAL(100l, 40 * 40 - fb.count(0));
+
+  // square shifted by half a pixel.
+  FrameBuffer half(40, 40, true);
+  int16_t shifted[] = { 168, 168, 328, 168, 328, 328, 168, 328 };
+  SpanDraw::fillPolygonAA(&half, shifted, 4, 0xFFFFFF, 0);
+  CHECK_EQUAL(81l, half.count(0xFFFFFF));
+  CHECK_EQUAL(36l, half.count(0x808080));  // half covered edges
+  CHECK_EQUAL(4l, half.count(0x404040));   // quarter covered corners
+  CHECK_EQUAL(0x808080u, half.at(10, 15));
+  CHECK_EQUAL(0x404040u, half.at(20, 20));
+
+  // blending with the background color
+  FrameBuffer blend(40, 40, true);
+  SpanDraw::fillPolygonAA(&blend, shifted, 4, 0xFF0000, 0x0000FF);
+  CHECK_EQUAL(0x800080u, blend.at(10, 15));
+
+  // the covered area of a thin tilted polygon
+  FrameBuffer thin(40, 40, true);
+  int16_t hand[] = { 40, 40, 60, 24, 600, 580, 584, 596 };
+  SpanDraw::fillPolygonAA(&thin, hand, 4, 0x404040, 0);
+  long sum = 0;
+  for (uint32_t p : thin.pixels) sum += p & 0xFF;
+  CHECK((sum > 4530) && (sum < 4810));  // 73 pixels * 0x40
+
+  // clipping
+  FrameBuffer clip(40, 40, true);
+  int16_t outside[] = { -200, -200, 300, -100, 800, 900, -100, 300 };
+  SpanDraw::fillPolygonAA(&clip, outside, 4, 0xFFFFFF, 0);
+  CHECK_EQUAL(0l, clip.outside);
+}
+
+
+// ===== benchmark =====
+
+static double seconds(std::function<void()> fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  return (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+// print pixels per second drawn on the host and estimated on a 40 MHz SPI bus.
+static void report(const char *name, long pixels, double secs, FrameBuffer &fb) {
+  printf("  %-10s %7.1f Mpixel/s, %5.1f pixels per call, %6.1f kpixel/s on SPI 40MHz\n",
+         name, pixels / secs / 1e6, (double)pixels / fb.calls, pixels / (fb.bytes * 8 / 40e6) / 1e3);
+}
+
+static void benchmark() {
+  const int loops = 200;
+  long count;
+
+  // the number of pixels of one scene.
+  FrameBuffer c(320, 240, false);
+  drawScene(&c, 160, 120, 110);
+  count = c.calls * loops;
+  printf("  scene: %ld pixels\n", c.calls);
+
+  FrameBuffer pixels(320, 240, false);
+  double t = seconds([&]() {
+    for (int n = 0; n < loops; n++) drawScene(&pixels, 160, 120, 110);
+  });
+  report("writePixel", count, t, pixels);
+
+  FrameBuffer spans(320, 240, true);
+  t = seconds([&]() {
+    for (int n = 0; n < loops; n++) drawScene(&spans, 160, 120, 110);
+  });
+  report("writeSpans", count, t, spans);
+
+  // pixel based drawing like the gfxDraw path widgets.
+  std::vector<int16_t> list;
+  for (int y = 0; y < 240; y++) {
+    for (int x = 40 + (y % 40); x < 280 - (y % 30); x++) {
+      list.push_back(x);
+      list.push_back(y);
+    }
+  }
+  count = loops * list.size() / 2;
+
+  FrameBuffer colors(320, 240, true);
+  HomeDing::displayAdapter = &colors;
+  t = seconds([&]() {
+    for (int n = 0; n < loops; n++) {
+      auto fn = HomeDing::writeColor(n);
+      for (size_t i = 0; i < list.size(); i += 2) fn(list[i], list[i + 1]);
+    }
+  });
+  report("writeColor", count, t, colors);
+
+  FrameBuffer merged(320, 240, true);
+  t = seconds([&]() {
+    for (int n = 0; n < loops; n++) {
+      SpanDraw::PixelSpans ps(&merged);
+      for (size_t i = 0; i < list.size(); i += 2) ps.add(list[i], list[i + 1], n);
+    }
+  });
+  report("PixelSpans", count, t, merged);
+}
+
+
+int main() {
+  testCoverage();
+  testClipping();
+  testPixelSpans();
+  testPolygonAA();
+  benchmark();
+  return (testResult("spandraw"));
+}
+
+// End.
@@ -0,0 +1,277 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino core replacement to compile HomeDing sources on the host for testing.
+ *
+ * @author Matthias Hertel, https://www.mathertel.de
+ *
+ * @Copyright Copyright (c) by Matthias Hertel, https://www.mathertel.de.
+ *
+ * This work is licensed under a BSD style license,
+ * https://www.mathertel.de/License.aspx.
+ *
+ * More information on https://www.mathertel.de/Arduino
+ *
+ * Changelog:
+ * * 18.10.2026 created by Matthias Hertel
+ *
+ * @details
+@verbatim
+Only the functions that are used by the tested sources are available.
+The time returned by millis() and micros() is controlled by the test using mockMillis,
+the time returned by time() using mockTime.
+@endverbatim
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <time.h>
+
+#include <string>
+#include <functional>
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define IRAM_ATTR
+
+#define constrain(v, lo, hi) ((v) < (lo) ? (lo) : ((v) > (hi) ? (hi) : (v)))
+
+/// @brief The simulated time in msecs.
+inline unsigned long mockMillis = 0;
+
+inline unsigned long millis() {
+  return (mockMillis);
+}
+
+inline unsigned long micros() {
+  return (mockMillis * 1000);
+}
+
+inline void delay(unsigned long ms) {
+  mockMillis += ms;
+}
+
+/// @brief The simulated time_t returned by time().
+inline time_t mockTime = 0;
+
+inline time_t _mockTime(time_t *t) {
+  if (t) *t = mockTime;
+  return (mockTime);
+}
+#define time(t) _mockTime(t)
+
+inline void yield() {}
+
+inline char *dtostrf(double v, int width, unsigned int prec, char *buf) {
+  sprintf(buf, "%*.*f", width, prec, v);
+  return (buf);
+}
+
+inline char *itoa(int v, char *buf, int base) {
+  sprintf(buf, (base == 16) ? "%x" : "%d", v);
+  return (buf);
+}
+
+#if defined(__GLIBC__) && ((__GLIBC__ < 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ < 38)))
+// strlcpy and strlcat are part of the Arduino cores but not of older glibc versions.
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = (len < size) ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return (len);
+}
+
+inline size_t strlcat(char *dst, const char *src, size_t size) {
+  size_t len = strnlen(dst, size);
+  if (len == size) return (len + strlen(src));
+  return (len + strlcpy(dst + len, src, size - len));
+}
+#endif
+
+/// @brief String class with the Arduino API based on std::string.
+class String : public std::string {
+public:
+  String() {}
+  String(const char *s) : std::string(s ? s : "") {}
+  String(const std::string &s) : std::string(s) {}
+  String(char c) : std::string(1, c) {}
+  String(int v) : std::string(std::to_string(v)) {}
+  String(unsigned int v) : std::string(std::to_string(v)) {}
+  String(long v) : std::string(std::to_string(v)) {}
+  String(unsigned long v) : std::string(std::to_string(v)) {}
+  String(float v, unsigned int decimals = 2) {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    assign(buf);
+  }
+
+  unsigned int length() const {
+    return (size());
+  }
+  bool isEmpty() const {
+    return (empty());
+  }
+  explicit operator bool() const {
+    return (!empty());
+  }
+  void reserve(unsigned int n) {
+    std::string::reserve(n);
+  }
+
+  bool concat(const String &s) {
+    append(s);
+    return (true);
+  }
+  bool concat(const char *s) {
+    append(s);
+    return (true);
+  }
+  bool concat(const char *s, unsigned int n) {
+    append(s, n);
+    return (true);
+  }
+  bool concat(char c) {
+    push_back(c);
+    return (true);
+  }
+  bool concat(long v) {
+    append(std::to_string(v));
+    return (true);
+  }
+
+  String &operator+=(const String &s) {
+    append(s);
+    return (*this);
+  }
+  String &operator+=(const char *s) {
+    append(s);
+    return (*this);
+  }
+  String &operator+=(char c) {
+    push_back(c);
+    return (*this);
+  }
+
+  bool equals(const String &s) const {
+    return (compare(s) == 0);
+  }
+  bool equalsIgnoreCase(const String &s) const {
+    return (strcasecmp(c_str(), s.c_str()) == 0);
+  }
+  bool startsWith(const String &s) const {
+    return (compare(0, s.size(), s) == 0);
+  }
+  bool endsWith(const String &s) const {
+    return ((size() >= s.size()) && (compare(size() - s.size(), s.size(), s) == 0));
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t p = find(c, from);
+    return (p == npos ? -1 : (int)p);
+  }
+  int indexOf(const String &s, unsigned int from = 0) const {
+    size_t p = find(s, from);
+    return (p == npos ? -1 : (int)p);
+  }
+  int lastIndexOf(char c) const {
+    size_t p = rfind(c);
+    return (p == npos ? -1 : (int)p);
+  }
+
+  String substring(unsigned int from) const {
+    return (from < size() ? String(substr(from)) : String());
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    return (from < size() ? String(substr(from, to - from)) : String());
+  }
+
+  void replace(const String &find, const String &repl) {
+    if (find.empty()) return;
+    size_t p = 0;
+    while ((p = std::string::find(find, p)) != npos) {
+      std::string::replace(p, find.size(), repl);
+      p += repl.size();
+    }
+  }
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+    if (index < size()) erase(index, count);
+  }
+  void trim() {
+    size_t b = find_first_not_of(" \t\r\n");
+    size_t e = find_last_not_of(" \t\r\n");
+    if (b == npos) {
+      clear();
+    } else {
+      assign(substr(b, e - b + 1));
+    }
+  }
+  void toLowerCase() {
+    for (char &c : *this) c = tolower(c);
+  }
+
+  long toInt() const {
+    return (atol(c_str()));
+  }
+  float toFloat() const {
+    return (atof(c_str()));
+  }
+  char charAt(unsigned int i) const {
+    return (i < size() ? at(i) : '\0');
+  }
+};
+
+inline String operator+(const String &a, const String &b) {
+  return (String(static_cast<const std::string &>(a) + static_cast<const std::string &>(b)));
+}
+inline String operator+(const String &a, const char *b) {
+  return (String(static_cast<const std::string &>(a) + b));
+}
+
+/// @brief IPv4 address.
+class IPAddress {
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    _addr = a | (b << 8) | (c << 16) | ((uint32_t)d << 24);
+  }
+  IPAddress(uint32_t addr) : _addr(addr) {}
+  operator uint32_t() const {
+    return (_addr);
+  }
+  uint8_t operator[](int i) const {
+    return ((_addr >> (8 * i)) & 0xFF);
+  }
+  bool fromString(const char *s) {
+    unsigned int a, b, c, d;
+    if (sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4) return (false);
+    *this = IPAddress(a, b, c, d);
+    return (true);
+  }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return (String(buf));
+  }
+
+private:
+  uint32_t _addr = 0;
+};
+
+// End.
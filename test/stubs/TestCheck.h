@@ -0,0 +1,34 @@
+// Minimal check macros for the host tests.
+
+#pragma once
+
+#include <stdio.h>
+
+inline int testChecks = 0;
+inline int testFailures = 0;
+
+/// @brief check a condition and report it when failed.
+#define CHECK(cond)                                                    \
+  do {                                                                 \
+    testChecks++;                                                      \
+    if (!(cond)) {                                                     \
+      testFailures++;                                                  \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    }                                                                  \
+  } while (0)
+
+/// @brief check two values for equality and report both when different.
+#define CHECK_EQUAL(expected, actual)                                            \
+  do {                                                                           \
+    testChecks++;                                                                \
+    if (!((expected) == (actual))) {                                             \
+      testFailures++;                                                            \
+      printf("%s:%d: check failed: %s == %s\n", __FILE__, __LINE__, #expected, #actual); \
+    }                                                                            \
+  } while (0)
+
+/// @brief print the summary and return the exit code of the test.
+inline int testResult(const char *name) {
+  printf("%s: %d checks, %d failed\n", name, testChecks, testFailures);
+  return (testFailures ? 1 : 0);
+}